@@ -1044,14 +1044,16 @@ inline AlignedAllocationData CommandListCoreFamily<gfxCoreFamily>::getAlignedAll
     uintptr_t alignedPtr = 0u;
     bool hostPointerNeedsFlush = false;
 
-    if (srcAllocFound == false) {
+    if (srcAllocFound) {
+        alloc = device->getDriverHandle()->getSvmAllocsManager()->obtainGraphicsAllocation(*allocData, device->getRootDeviceIndex());
+    }
+
+    if (alloc == nullptr) {
         alloc = device->getDriverHandle()->allocateMemoryFromHostPtr(device, buffer, bufferSize);
         hostPtrMap.insert(std::make_pair(buffer, alloc));
 
         alignedPtr = static_cast<uintptr_t>(alloc->getGpuAddress() - offset);
     } else {
-        alloc = allocData->gpuAllocation;
-
         alignedPtr = reinterpret_cast<uintptr_t>(buffer) - offset;
 
         if (allocData->memoryType == InternalMemoryType::HOST_UNIFIED_MEMORY ||
@@ -19,6 +19,8 @@
 #include "hw_helpers.h"
 #include "igfxfmid.h"
 
+#include <algorithm>
+
 namespace L0 {
 
 CommandQueueAllocatorFn commandQueueFactory[IGFX_MAX_PRODUCT] = {};
@@ -56,7 +58,7 @@ void CommandQueueImp::submitBatchBuffer(size_t offset, NEO::ResidencyContainer &
                                  commandStream->getUsed(), commandStream, endingCmdPtr);
 
     csr->submitBatchBuffer(batchBuffer, residencyContainer);
-    buffers.setCurrentFlushStamp(csr->obtainCurrentFlushStamp());
+    buffers.setCurrentFlushStamp(csr->obtainCurrentFlushStamp(), csr->peekTaskCount());
 }
 
 ze_result_t CommandQueueImp::synchronize(uint32_t timeout) {
@@ -110,44 +112,84 @@ ze_command_queue_mode_t CommandQueueImp::getSynchronousMode() {
     return desc.mode;
 }
 
-void CommandQueueImp::CommandBufferManager::initialize(Device *device, size_t sizeRequested) {
-    size_t alignedSize = alignUp<size_t>(sizeRequested, MemoryConstants::pageSize64k);
-    NEO::AllocationProperties properties{device->getRootDeviceIndex(), true, alignedSize,
-                                         NEO::GraphicsAllocation::AllocationType::COMMAND_BUFFER,
-                                         device->isMultiDeviceCapable(),
-                                         false,
-                                         NEO::SubDevice::unspecifiedSubDeviceIndex};
-
-    buffers[BUFFER_ALLOCATION::FIRST] = device->getDriverHandle()->getMemoryManager()->allocateGraphicsMemoryWithProperties(properties);
+constexpr size_t CommandQueueImp::CommandBufferManager::defaultBuffersCount;
+constexpr size_t CommandQueueImp::CommandBufferManager::defaultMaxBuffersCount;
 
-    UNRECOVERABLE_IF(nullptr == buffers[BUFFER_ALLOCATION::FIRST]);
-    memset(buffers[BUFFER_ALLOCATION::FIRST]->getUnderlyingBuffer(), 0, buffers[BUFFER_ALLOCATION::FIRST]->getUnderlyingBufferSize());
+void CommandQueueImp::CommandBufferManager::initialize(Device *device, size_t sizeRequested) {
+    this->device = device;
+    this->bufferSize = alignUp<size_t>(sizeRequested, MemoryConstants::pageSize64k);
 
-    buffers[BUFFER_ALLOCATION::SECOND] = device->getDriverHandle()->getMemoryManager()->allocateGraphicsMemoryWithProperties(properties);
+    size_t buffersCount = defaultBuffersCount;
+    if (NEO::DebugManager.flags.CommandQueueBuffersCount.get() != -1) {
+        buffersCount = std::max(static_cast<size_t>(NEO::DebugManager.flags.CommandQueueBuffersCount.get()), defaultBuffersCount);
+    }
+    maxBuffersCount = std::max(defaultMaxBuffersCount, buffersCount);
+    if (NEO::DebugManager.flags.CommandQueueMaxBuffersCount.get() != -1) {
+        maxBuffersCount = std::max(static_cast<size_t>(NEO::DebugManager.flags.CommandQueueMaxBuffersCount.get()), buffersCount);
+    }
 
-    UNRECOVERABLE_IF(nullptr == buffers[BUFFER_ALLOCATION::SECOND]);
-    memset(buffers[BUFFER_ALLOCATION::SECOND]->getUnderlyingBuffer(), 0, buffers[BUFFER_ALLOCATION::SECOND]->getUnderlyingBufferSize());
-    flushId[BUFFER_ALLOCATION::FIRST] = 0u;
-    flushId[BUFFER_ALLOCATION::SECOND] = 0u;
+    buffers.reserve(maxBuffersCount);
+    for (size_t i = 0; i < buffersCount; i++) {
+        CommandBuffer buffer;
+        buffer.allocation = allocateBuffer();
+        buffers.push_back(buffer);
+    }
+    bufferUse = 0u;
 }
 
 void CommandQueueImp::CommandBufferManager::destroy(NEO::MemoryManager *memoryManager) {
-    memoryManager->freeGraphicsMemory(buffers[BUFFER_ALLOCATION::FIRST]);
-    memoryManager->freeGraphicsMemory(buffers[BUFFER_ALLOCATION::SECOND]);
+    NEO::printDebugString(NEO::DebugManager.flags.PrintDebugMessages.get(), stdout,
+                          "Command queue buffers: %u, switches: %llu, grown: %llu, blocking waits: %llu\n",
+                          static_cast<uint32_t>(buffers.size()), static_cast<unsigned long long>(statistics.switchesCount),
+                          static_cast<unsigned long long>(statistics.growthsCount), static_cast<unsigned long long>(statistics.blockingWaitsCount));
+
+    for (auto &buffer : buffers) {
+        memoryManager->freeGraphicsMemory(buffer.allocation);
+    }
+    buffers.clear();
 }
 
 void CommandQueueImp::CommandBufferManager::switchBuffers(NEO::CommandStreamReceiver *csr) {
-    if (bufferUse == BUFFER_ALLOCATION::FIRST) {
-        bufferUse = BUFFER_ALLOCATION::SECOND;
-    } else {
-        bufferUse = BUFFER_ALLOCATION::FIRST;
+    UNRECOVERABLE_IF(csr == nullptr);
+    statistics.switchesCount++;
+
+    auto nextBufferUse = (bufferUse + 1) % buffers.size();
+    if (isBufferInUse(buffers[nextBufferUse], csr) && buffers.size() < maxBuffersCount) {
+        // whole ring is in flight, insert a fresh buffer before the oldest one instead of waiting for it
+        CommandBuffer buffer;
+        buffer.allocation = allocateBuffer();
+        nextBufferUse = bufferUse + 1;
+        buffers.insert(buffers.begin() + nextBufferUse, buffer);
+        statistics.growthsCount++;
+    }
+    bufferUse = nextBufferUse;
+
+    auto &buffer = buffers[bufferUse];
+    if (isBufferInUse(buffer, csr)) {
+        statistics.blockingWaitsCount++;
+        csr->waitForFlushStamp(buffer.flushId);
+        csr->waitForCompletionWithTimeout(false, 0, buffer.taskCount);
     }
+}
+
+NEO::GraphicsAllocation *CommandQueueImp::CommandBufferManager::allocateBuffer() {
+    NEO::AllocationProperties properties{device->getRootDeviceIndex(), true, bufferSize,
+                                         NEO::GraphicsAllocation::AllocationType::COMMAND_BUFFER,
+                                         device->isMultiDeviceCapable(),
+                                         false,
+                                         NEO::SubDevice::unspecifiedSubDeviceIndex};
+
+    auto allocation = device->getDriverHandle()->getMemoryManager()->allocateGraphicsMemoryWithProperties(properties);
+    UNRECOVERABLE_IF(nullptr == allocation);
+    memset(allocation->getUnderlyingBuffer(), 0, allocation->getUnderlyingBufferSize());
+    return allocation;
+}
 
-    NEO::FlushStamp completionId = flushId[bufferUse];
-    if (completionId != 0u) {
-        UNRECOVERABLE_IF(csr == nullptr);
-        csr->waitForFlushStamp(completionId);
+bool CommandQueueImp::CommandBufferManager::isBufferInUse(const CommandBuffer &buffer, NEO::CommandStreamReceiver *csr) const {
+    if (buffer.flushId == 0u && buffer.taskCount == 0u) {
+        return false;
     }
+    return *csr->getTagAddress() < buffer.taskCount;
 }
 
 } // namespace L0
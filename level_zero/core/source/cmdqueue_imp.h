@@ -26,12 +26,17 @@ namespace L0 {
 struct CommandList;
 struct Kernel;
 struct CommandQueueImp : public CommandQueue {
+    // Ring of command buffers. A buffer is reused only after the GPU has finished its last submission;
+    // when the next buffer is still in flight the ring grows up to maxBuffersCount before blocking.
     class CommandBufferManager {
       public:
-        enum BUFFER_ALLOCATION : uint32_t {
-            FIRST = 0,
-            SECOND,
-            COUNT
+        static constexpr size_t defaultBuffersCount = 2;
+        static constexpr size_t defaultMaxBuffersCount = 8;
+
+        struct Statistics {
+            uint64_t switchesCount = 0;
+            uint64_t blockingWaitsCount = 0;
+            uint64_t growthsCount = 0;
         };
 
         void initialize(Device *device, size_t sizeRequested);
@@ -39,17 +44,34 @@ struct CommandQueueImp : public CommandQueue {
         void switchBuffers(NEO::CommandStreamReceiver *csr);
 
         NEO::GraphicsAllocation *getCurrentBufferAllocation() {
-            return buffers[bufferUse];
+            return buffers[bufferUse].allocation;
         }
 
-        void setCurrentFlushStamp(NEO::FlushStamp flushStamp) {
-            flushId[bufferUse] = flushStamp;
+        void setCurrentFlushStamp(NEO::FlushStamp flushStamp, uint32_t taskCount) {
+            buffers[bufferUse].flushId = flushStamp;
+            buffers[bufferUse].taskCount = taskCount;
         }
 
-      private:
-        NEO::GraphicsAllocation *buffers[BUFFER_ALLOCATION::COUNT];
-        NEO::FlushStamp flushId[BUFFER_ALLOCATION::COUNT];
-        BUFFER_ALLOCATION bufferUse = BUFFER_ALLOCATION::FIRST;
+        size_t getBuffersCount() const { return buffers.size(); }
+        size_t getMaxBuffersCount() const { return maxBuffersCount; }
+        const Statistics &getStatistics() const { return statistics; }
+
+      protected:
+        struct CommandBuffer {
+            NEO::GraphicsAllocation *allocation = nullptr;
+            NEO::FlushStamp flushId = 0u;
+            uint32_t taskCount = 0u;
+        };
+
+        NEO::GraphicsAllocation *allocateBuffer();
+        bool isBufferInUse(const CommandBuffer &buffer, NEO::CommandStreamReceiver *csr) const;
+
+        std::vector<CommandBuffer> buffers;
+        size_t bufferUse = 0u;
+        size_t maxBuffersCount = defaultMaxBuffersCount;
+        Device *device = nullptr;
+        size_t bufferSize = 0u;
+        Statistics statistics;
     };
     static constexpr size_t defaultQueueCmdBufferSize = 128 * MemoryConstants::kiloByte;
     static constexpr size_t minCmdBufferPtrAlign = 8;
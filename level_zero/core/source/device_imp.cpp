@@ -147,12 +147,17 @@ ze_result_t DeviceImp::evictImage(ze_image_handle_t hImage) {
 }
 
 ze_result_t DeviceImp::evictMemory(void *ptr, size_t size) {
-    auto alloc = getDriverHandle()->getSvmAllocsManager()->getSVMAllocs()->get(ptr);
+    auto svmAllocsManager = getDriverHandle()->getSvmAllocsManager();
+    auto alloc = svmAllocsManager->getSVMAllocs()->get(ptr);
     if (alloc == nullptr) {
         return ZE_RESULT_ERROR_INVALID_ARGUMENT;
     }
+    auto gpuAllocation = svmAllocsManager->obtainGraphicsAllocation(*alloc, neoDevice->getRootDeviceIndex());
+    if (gpuAllocation == nullptr) {
+        return ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY;
+    }
     NEO::MemoryOperationsHandler *memoryOperationsIface = neoDevice->getRootDeviceEnvironment().memoryOperationsInterface.get();
-    auto success = memoryOperationsIface->evict(*alloc->gpuAllocation);
+    auto success = memoryOperationsIface->evict(*gpuAllocation);
     return changeMemoryOperationStatusToL0ResultType(success);
 }
 
@@ -355,12 +360,17 @@ ze_result_t DeviceImp::makeImageResident(ze_image_handle_t hImage) {
 }
 
 ze_result_t DeviceImp::makeMemoryResident(void *ptr, size_t size) {
-    auto alloc = getDriverHandle()->getSvmAllocsManager()->getSVMAllocs()->get(ptr);
+    auto svmAllocsManager = getDriverHandle()->getSvmAllocsManager();
+    auto alloc = svmAllocsManager->getSVMAllocs()->get(ptr);
     if (alloc == nullptr) {
         return ZE_RESULT_ERROR_INVALID_ARGUMENT;
     }
+    auto gpuAllocation = svmAllocsManager->obtainGraphicsAllocation(*alloc, neoDevice->getRootDeviceIndex());
+    if (gpuAllocation == nullptr) {
+        return ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY;
+    }
     NEO::MemoryOperationsHandler *memoryOperationsIface = neoDevice->getRootDeviceEnvironment().memoryOperationsInterface.get();
-    auto success = memoryOperationsIface->makeResident(ArrayRef<NEO::GraphicsAllocation *>(&alloc->gpuAllocation, 1));
+    auto success = memoryOperationsIface->makeResident(ArrayRef<NEO::GraphicsAllocation *>(&gpuAllocation, 1));
     return changeMemoryOperationStatusToL0ResultType(success);
 }
 
@@ -15,6 +15,7 @@
 #include <level_zero/ze_api.h>
 
 #include <memory>
+#include <mutex>
 #include <vector>
 
 struct _ze_kernel_handle_t {};
@@ -42,7 +43,8 @@ struct KernelImmutableData {
     }
 
     uint32_t getIsaSize() const;
-    NEO::GraphicsAllocation *getIsaGraphicsAllocation() const { return isaGraphicsAllocation.get(); }
+    // ISA is allocated and uploaded on first use, so kernels never created in the module do not consume memory
+    NEO::GraphicsAllocation *getIsaGraphicsAllocation() const;
 
     uint64_t getPrivateMemorySize() const;
     NEO::GraphicsAllocation *getPrivateMemoryGraphicsAllocation() const { return privateMemoryGraphicsAllocation.get(); }
@@ -61,8 +63,14 @@ struct KernelImmutableData {
 
   protected:
     Device *device = nullptr;
+    void createIsaGraphicsAllocation() const;
+
     NEO::KernelDescriptor *kernelDescriptor = nullptr;
-    std::unique_ptr<NEO::GraphicsAllocation> isaGraphicsAllocation = nullptr;
+    NEO::KernelInfo *kernelInfo = nullptr;
+    NEO::MemoryManager *memoryManager = nullptr;
+    uint32_t rootDeviceIndex = 0u;
+    mutable std::once_flag isaAllocationOnceFlag;
+    mutable std::unique_ptr<NEO::GraphicsAllocation> isaGraphicsAllocation = nullptr;
     std::unique_ptr<NEO::GraphicsAllocation> privateMemoryGraphicsAllocation = nullptr;
 
     uint32_t crossThreadDataSize = 0;
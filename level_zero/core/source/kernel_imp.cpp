@@ -69,15 +69,12 @@ void KernelImmutableData::initialize(NEO::KernelInfo *kernelInfo, NEO::MemoryMan
     UNRECOVERABLE_IF(kernelInfo == nullptr);
     this->kernelDescriptor = &kernelInfo->kernelDescriptor;
 
-    auto kernelIsaSize = kernelInfo->heapInfo.pKernelHeader->KernelHeapSize;
-
-    auto allocation = memoryManager.allocateGraphicsMemoryWithProperties(
-        {device->getRootDeviceIndex(), kernelIsaSize, NEO::GraphicsAllocation::AllocationType::KERNEL_ISA});
-    UNRECOVERABLE_IF(allocation == nullptr);
-    if (kernelInfo->heapInfo.pKernelHeap != nullptr) {
-        memoryManager.copyMemoryToAllocation(allocation, kernelInfo->heapInfo.pKernelHeap, kernelIsaSize);
+    this->kernelInfo = kernelInfo;
+    this->memoryManager = &memoryManager;
+    this->rootDeviceIndex = device->getRootDeviceIndex();
+    if (NEO::DebugManager.flags.DeferKernelIsaAllocation.get() == 0) {
+        createIsaGraphicsAllocation();
     }
-    isaGraphicsAllocation.reset(allocation);
 
     this->crossThreadDataSize = this->kernelDescriptor->kernelAttributes.crossThreadDataSize;
 
@@ -149,8 +146,28 @@ void KernelImmutableData::initialize(NEO::KernelInfo *kernelInfo, NEO::MemoryMan
     }
 }
 
+NEO::GraphicsAllocation *KernelImmutableData::getIsaGraphicsAllocation() const {
+    std::call_once(isaAllocationOnceFlag, [this]() { createIsaGraphicsAllocation(); });
+    return isaGraphicsAllocation.get();
+}
+
+void KernelImmutableData::createIsaGraphicsAllocation() const {
+    if (isaGraphicsAllocation) {
+        return;
+    }
+    auto kernelIsaSize = kernelInfo->heapInfo.pKernelHeader->KernelHeapSize;
+
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(
+        {rootDeviceIndex, kernelIsaSize, NEO::GraphicsAllocation::AllocationType::KERNEL_ISA});
+    UNRECOVERABLE_IF(allocation == nullptr);
+    if (kernelInfo->heapInfo.pKernelHeap != nullptr) {
+        memoryManager->copyMemoryToAllocation(allocation, kernelInfo->heapInfo.pKernelHeap, kernelIsaSize);
+    }
+    isaGraphicsAllocation.reset(allocation);
+}
+
 uint32_t KernelImmutableData::getIsaSize() const {
-    return static_cast<uint32_t>(isaGraphicsAllocation->getUnderlyingBufferSize());
+    return static_cast<uint32_t>(getIsaGraphicsAllocation()->getUnderlyingBufferSize());
 }
 
 uint64_t KernelImmutableData::getPrivateMemorySize() const {
@@ -488,7 +505,11 @@ ze_result_t KernelImp::setArgBuffer(uint32_t argIndex, size_t argSize, const voi
 
     auto requestedAddress = *reinterpret_cast<void *const *>(argVal);
     auto svmAllocsManager = module->getDevice()->getDriverHandle()->getSvmAllocsManager();
-    NEO::GraphicsAllocation *alloc = svmAllocsManager->getSVMAllocs()->get(requestedAddress)->gpuAllocation;
+    NEO::GraphicsAllocation *alloc = svmAllocsManager->obtainGraphicsAllocation(*svmAllocsManager->getSVMAllocs()->get(requestedAddress),
+                                                                               module->getDevice()->getRootDeviceIndex());
+    if (alloc == nullptr) {
+        return ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY;
+    }
 
     return setArgBufferWithAlloc(argIndex, argVal, alloc);
 }
@@ -539,6 +560,7 @@ ze_result_t KernelImp::initialize(const ze_kernel_desc_t *desc) {
     if (this->kernelImmData == nullptr) {
         return ZE_RESULT_ERROR_INVALID_ARGUMENT;
     }
+    kernelImmData->getIsaGraphicsAllocation();
 
     for (const auto &argT : kernelImmData->getDescriptor().payloadMappings.explicitArgs) {
         switch (argT.type) {
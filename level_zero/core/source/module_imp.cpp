@@ -7,10 +7,12 @@
 
 #include "level_zero/core/source/module_imp.h"
 
+#include "shared/source/command_stream/scratch_space_registry.h"
 #include "shared/source/compiler_interface/compiler_interface.h"
 #include "shared/source/compiler_interface/intermediate_representations.h"
 #include "shared/source/device/device.h"
 #include "shared/source/device_binary_format/device_binary_formats.h"
+#include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/helpers/string.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
@@ -27,6 +29,7 @@
 #include "compiler_options.h"
 #include "program_debug_data.h"
 
+#include <algorithm>
 #include <memory>
 
 namespace L0 {
@@ -291,6 +294,9 @@ ModuleImp::ModuleImp(Device *device, NEO::Device *neoDevice, ModuleBuildLog *mod
 }
 
 ModuleImp::~ModuleImp() {
+    if (registeredPerThreadScratchSize) {
+        device->getNEODevice()->getRootDeviceEnvironment().scratchSpaceRegistry->unregisterPerThreadScratchSize(registeredPerThreadScratchSize);
+    }
     kernelImmDatas.clear();
     delete translationUnit;
 }
@@ -334,14 +340,21 @@ bool ModuleImp::initialize(const ze_module_desc_t *desc, NEO::Device *neoDevice)
     }
 
     kernelImmDatas.reserve(this->translationUnit->programInfo.kernelInfos.size());
+    uint32_t maxPerThreadScratchSize = 0u;
     for (auto &ki : this->translationUnit->programInfo.kernelInfos) {
         std::unique_ptr<KernelImmutableData> kernelImmData{new KernelImmutableData(this->device)};
         kernelImmData->initialize(ki, *(getDevice()->getDriverHandle()->getMemoryManager()),
                                   device->getNEODevice(),
                                   device->getNEODevice()->getDeviceInfo().computeUnitsUsedForScratch,
                                   this->translationUnit->globalConstBuffer, this->translationUnit->globalVarBuffer);
+        maxPerThreadScratchSize = std::max(maxPerThreadScratchSize, kernelImmData->getDescriptor().kernelAttributes.perThreadScratchSize[0]);
         kernelImmDatas.push_back(std::move(kernelImmData));
     }
+    // lets command queues allocate scratch for the whole module on first kernel needing it
+    if (maxPerThreadScratchSize) {
+        device->getNEODevice()->getRootDeviceEnvironment().scratchSpaceRegistry->registerPerThreadScratchSize(maxPerThreadScratchSize);
+        registeredPerThreadScratchSize = maxPerThreadScratchSize;
+    }
     this->maxGroupSize = static_cast<uint32_t>(this->translationUnit->device->getNEODevice()->getDeviceInfo().maxWorkGroupSize);
 
     return this->linkBinary();
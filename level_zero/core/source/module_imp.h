@@ -70,6 +70,7 @@ struct ModuleImp : public Module {
     ModuleBuildLog *moduleBuildLog = nullptr;
     NEO::GraphicsAllocation *exportedFunctionsSurface = nullptr;
     uint32_t maxGroupSize = 0U;
+    uint32_t registeredPerThreadScratchSize = 0U;
     std::vector<std::unique_ptr<KernelImmutableData>> kernelImmDatas;
     NEO::Linker::RelocatedSymbolsMap symbols;
     bool debugEnabled = false;
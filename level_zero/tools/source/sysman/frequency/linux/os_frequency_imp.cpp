@@ -5,6 +5,8 @@
  *
  */
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
+
 #include "level_zero/core/source/device.h"
 
 #include "drm_neo.h"
@@ -13,6 +15,10 @@
 #include "sysman/frequency/os_frequency.h"
 #include "sysman/linux/os_sysman_imp.h"
 #include "sysman/linux/sysfs_access.h"
+#include "sysman/linux/sysfs_sampler.h"
+
+#include <memory>
+#include <vector>
 
 namespace L0 {
 
@@ -29,6 +35,7 @@ class LinuxFrequencyImp : public OsFrequency {
     ze_result_t getMaxVal(double &maxVal) override;
     ze_result_t getMinVal(double &minVal) override;
     ze_result_t getThrottleReasons(uint32_t &throttleReasons) override;
+    ze_result_t getState(zet_freq_state_t &state) override;
 
     LinuxFrequencyImp(OsSysman *pOsSysman);
     ~LinuxFrequencyImp() override = default;
@@ -38,7 +45,18 @@ class LinuxFrequencyImp : public OsFrequency {
     LinuxFrequencyImp &operator=(const LinuxFrequencyImp &obj) = delete;
 
   private:
+    enum StateFile : uint32_t {
+        request = 0,
+        tdp,
+        efficient,
+        actual,
+        count
+    };
+    static void setState(zet_freq_state_t &state, const int64_t *values);
+
     SysfsAccess *pSysfsAccess;
+    std::vector<std::string> stateFiles;
+    std::unique_ptr<SysfsSampler> pStateSampler;
 
     static const std::string minFreqFile;
     static const std::string maxFreqFile;
@@ -168,10 +186,46 @@ ze_result_t LinuxFrequencyImp::getThrottleReasons(uint32_t &throttleReasons) {
     return ZE_RESULT_SUCCESS;
 }
 
+void LinuxFrequencyImp::setState(zet_freq_state_t &state, const int64_t *values) {
+    state.request = static_cast<double>(values[StateFile::request]);
+    state.tdp = static_cast<double>(values[StateFile::tdp]);
+    state.efficient = static_cast<double>(values[StateFile::efficient]);
+    state.actual = static_cast<double>(values[StateFile::actual]);
+}
+
+ze_result_t LinuxFrequencyImp::getState(zet_freq_state_t &state) {
+    if (pStateSampler) {
+        SysfsSample sample;
+        constexpr uint32_t allStateFilesMask = (1u << StateFile::count) - 1;
+        if (pStateSampler->getLatestSample(sample) && (sample.validMask & allStateFilesMask) == allStateFilesMask) {
+            setState(state, sample.values.data());
+            return ZE_RESULT_SUCCESS;
+        }
+    }
+
+    std::vector<int> vals;
+    std::vector<ze_result_t> results;
+    ze_result_t result = pSysfsAccess->readMultiple(stateFiles, vals, results);
+    if (ZE_RESULT_SUCCESS != result) {
+        return result;
+    }
+    int64_t values[StateFile::count];
+    std::copy(vals.begin(), vals.end(), values);
+    setState(state, values);
+    return ZE_RESULT_SUCCESS;
+}
+
 LinuxFrequencyImp::LinuxFrequencyImp(OsSysman *pOsSysman) {
     LinuxSysmanImp *pLinuxSysmanImp = static_cast<LinuxSysmanImp *>(pOsSysman);
 
     pSysfsAccess = &pLinuxSysmanImp->getSysfsAccess();
+    stateFiles = {requestFreqFile, tdpFreqFile, efficientFreqFile, actualFreqFile};
+
+    auto samplingPeriod = NEO::DebugManager.flags.SysmanSamplingPeriodMicroseconds.get();
+    if (samplingPeriod > 0) {
+        pStateSampler = std::make_unique<SysfsSampler>(*pSysfsAccess, stateFiles, std::chrono::microseconds(samplingPeriod));
+        pStateSampler->start();
+    }
 }
 
 OsFrequency *OsFrequency::create(OsSysman *pOsSysman) {
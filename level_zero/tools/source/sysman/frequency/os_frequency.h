@@ -26,6 +26,8 @@ class OsFrequency {
     virtual ze_result_t getMaxVal(double &maxVal) = 0;
     virtual ze_result_t getMinVal(double &minVal) = 0;
     virtual ze_result_t getThrottleReasons(uint32_t &throttleReasons) = 0;
+    // Reads request, tdp, efficient and actual frequencies at once
+    virtual ze_result_t getState(zet_freq_state_t &state) = 0;
 
     static OsFrequency *create(OsSysman *pOsSysman);
     virtual ~OsFrequency() {}
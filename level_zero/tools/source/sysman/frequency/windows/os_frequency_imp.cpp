@@ -22,6 +22,7 @@ class WddmFrequencyImp : public OsFrequency {
     ze_result_t getMaxVal(double &maxVal) override;
     ze_result_t getMinVal(double &minVal) override;
     ze_result_t getThrottleReasons(uint32_t &throttleReasons) override;
+    ze_result_t getState(zet_freq_state_t &state) override;
 };
 
 ze_result_t WddmFrequencyImp::getMin(double &min) {
@@ -68,6 +69,10 @@ ze_result_t WddmFrequencyImp::getThrottleReasons(uint32_t &throttleReasons) {
     return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
+ze_result_t WddmFrequencyImp::getState(zet_freq_state_t &state) {
+    return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
 OsFrequency *OsFrequency::create(OsSysman *pOsSysman) {
     WddmFrequencyImp *pWddmFrequencyImp = new WddmFrequencyImp();
     return static_cast<OsFrequency *>(pWddmFrequencyImp);
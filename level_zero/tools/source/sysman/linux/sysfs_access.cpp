@@ -12,6 +12,7 @@
 #include <array>
 #include <cerrno>
 #include <cstdio>
+#include <fcntl.h>
 
 namespace L0 {
 
@@ -26,6 +27,8 @@ static ze_result_t getResult(int err) {
 }
 
 const std::string SysfsAccess::charDevPath = "/sys/dev/char/";
+// sysfs attributes are at most one page long
+constexpr size_t maxAttributeSize = 4096u;
 
 std::string SysfsAccess::fullPath(const std::string file) {
     return std::string(dirname + file);
@@ -53,27 +56,63 @@ SysfsAccess *SysfsAccess::create(const std::string path) {
     return new SysfsAccess(path);
 }
 
-ze_result_t SysfsAccess::readAsString(const std::string file, std::string &val) {
-    std::ifstream sysfs;
+SysfsAccess::~SysfsAccess() {
+    for (auto &cachedFd : fdCache) {
+        ::close(cachedFd.second);
+    }
+}
+
+int SysfsAccess::getCachedFd(const std::string &file) {
+    std::lock_guard<std::mutex> lock(fdCacheMutex);
+    auto it = fdCache.find(file);
+    if (it != fdCache.end()) {
+        return it->second;
+    }
+    int fd = ::open(fullPath(file).c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd >= 0) {
+        fdCache.insert({file, fd});
+    }
+    return fd;
+}
+
+void SysfsAccess::closeCachedFd(const std::string &file, int fd) {
+    std::lock_guard<std::mutex> lock(fdCacheMutex);
+    auto it = fdCache.find(file);
+    if (it != fdCache.end() && it->second == fd) {
+        fdCache.erase(it);
+        ::close(fd);
+    }
+}
+
+ze_result_t SysfsAccess::readFromCachedFd(const std::string &file, std::string &val) {
+    std::array<char, maxAttributeSize> buf;
     val.clear();
 
-    sysfs.open(fullPath(file).c_str());
-    if (sysfs.fail()) {
+    int fd = getCachedFd(file);
+    if (fd < 0) {
         return getResult(errno);
     }
-    sysfs >> val;
-    if (sysfs.fail()) {
-        sysfs.close();
-        return getResult(errno);
+    ssize_t len = ::pread(fd, buf.data(), buf.size(), 0);
+    if (len < 0) {
+        auto err = errno;
+        // Attribute may be gone (e.g. device unbound), reopen it on next read
+        closeCachedFd(file, fd);
+        return getResult(err);
     }
-    sysfs.close();
 
-    if (val.back() == '\n') {
-        val.pop_back();
+    // Same as stream extraction, value is first whitespace delimited token
+    std::istringstream stream(std::string(buf.data(), static_cast<size_t>(len)));
+    stream >> val;
+    if (stream.fail()) {
+        return ZE_RESULT_ERROR_UNKNOWN;
     }
     return ZE_RESULT_SUCCESS;
 }
 
+ze_result_t SysfsAccess::readAsString(const std::string file, std::string &val) {
+    return readFromCachedFd(file, val);
+}
+
 ze_result_t SysfsAccess::readAsLines(const std::string file, std::vector<std::string> &val) {
     std::string line;
     std::ifstream sysfs;
@@ -134,11 +173,11 @@ ze_result_t SysfsAccess::canWrite(const std::string file) {
     return ZE_RESULT_SUCCESS;
 }
 
-ze_result_t SysfsAccess::read(const std::string file, int &val) {
+ze_result_t SysfsAccess::readAsInt(const std::string &file, int &val) {
     std::string str;
     ze_result_t result;
 
-    result = readAsString(file, str);
+    result = readFromCachedFd(file, str);
     if (ZE_RESULT_SUCCESS != result) {
         return result;
     }
@@ -152,6 +191,24 @@ ze_result_t SysfsAccess::read(const std::string file, int &val) {
     return ZE_RESULT_SUCCESS;
 }
 
+ze_result_t SysfsAccess::read(const std::string file, int &val) {
+    return readAsInt(file, val);
+}
+
+ze_result_t SysfsAccess::readMultiple(const std::vector<std::string> &files, std::vector<int> &vals, std::vector<ze_result_t> &results) {
+    ze_result_t firstFailure = ZE_RESULT_SUCCESS;
+    vals.assign(files.size(), 0);
+    results.assign(files.size(), ZE_RESULT_SUCCESS);
+
+    for (size_t i = 0; i < files.size(); i++) {
+        results[i] = readAsInt(files[i], vals[i]);
+        if (ZE_RESULT_SUCCESS != results[i] && ZE_RESULT_SUCCESS == firstFailure) {
+            firstFailure = results[i];
+        }
+    }
+    return firstFailure;
+}
+
 ze_result_t SysfsAccess::read(const std::string file, double &val) {
     std::string str;
     ze_result_t result;
@@ -13,12 +13,14 @@
 #include <fstream>
 #include <iostream>
 #include <list>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <sys/stat.h>
 #include <sys/sysmacros.h>
 #include <sys/types.h>
 #include <unistd.h>
+#include <unordered_map>
 #include <vector>
 
 namespace L0 {
@@ -27,6 +29,11 @@ class SysfsAccess {
   public:
     static SysfsAccess *create(const int fd);
     static SysfsAccess *create(const std::string path);
+    ~SysfsAccess();
+
+    // Don't allow copies of the SysfsAccess object
+    SysfsAccess(const SysfsAccess &obj) = delete;
+    SysfsAccess &operator=(const SysfsAccess &obj) = delete;
 
     ze_result_t canRead(const std::string file);
     ze_result_t canWrite(const std::string file);
@@ -35,6 +42,8 @@ class SysfsAccess {
     ze_result_t read(const std::string file, std::vector<std::string> &val) { return this->readAsLines(file, val); }
     ze_result_t read(const std::string file, int &val);
     ze_result_t read(const std::string file, double &val);
+    // Reads all files in one call, per file status is returned in results, return value is first failure
+    ze_result_t readMultiple(const std::vector<std::string> &files, std::vector<int> &vals, std::vector<ze_result_t> &results);
 
     ze_result_t write(const std::string file, const std::string val) { return this->writeAsString(file, val); }
     ze_result_t write(const std::string file, const int val);
@@ -45,6 +54,10 @@ class SysfsAccess {
   private:
     ze_result_t readAsString(const std::string file, std::string &val);
     ze_result_t readAsLines(const std::string file, std::vector<std::string> &val);
+    ze_result_t readAsInt(const std::string &file, int &val);
+    ze_result_t readFromCachedFd(const std::string &file, std::string &val);
+    int getCachedFd(const std::string &file);
+    void closeCachedFd(const std::string &file, int fd);
     ze_result_t writeAsString(const std::string file, const std::string val);
     std::string fullPath(const std::string file);
 
@@ -53,6 +66,10 @@ class SysfsAccess {
 
     std::string dirname;
     static const std::string charDevPath;
+
+    // Attribute files are kept open and read with pread from offset 0, which makes sysfs regenerate the value
+    std::mutex fdCacheMutex;
+    std::unordered_map<std::string, int> fdCache;
 };
 
 } // namespace L0
@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "sysman/linux/sysfs_sampler.h"
+
+#include "shared/source/helpers/debug_helpers.h"
+
+#include <algorithm>
+
+namespace L0 {
+
+constexpr uint32_t SysfsSample::maxAttributesCount;
+constexpr uint32_t SysfsSampler::ringSize;
+
+SysfsSampler::SysfsSampler(SysfsAccess &sysfsAccess, const std::vector<std::string> &files, std::chrono::microseconds period)
+    : sysfsAccess(sysfsAccess), files(files), period(period) {
+    UNRECOVERABLE_IF(files.size() > SysfsSample::maxAttributesCount);
+    for (auto &slot : ring) {
+        for (auto &value : slot.values) {
+            value.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+SysfsSampler::~SysfsSampler() {
+    stop();
+}
+
+void SysfsSampler::start() {
+    std::lock_guard<std::mutex> lock(stopMutex);
+    if (samplingThread) {
+        return;
+    }
+    keepRunning = true;
+    samplingThread = NEO::Thread::create(samplingThreadFunc, this);
+}
+
+void SysfsSampler::stop() {
+    {
+        std::lock_guard<std::mutex> lock(stopMutex);
+        keepRunning = false;
+    }
+    stopCondition.notify_all();
+    if (samplingThread) {
+        samplingThread->join();
+        samplingThread.reset();
+    }
+}
+
+void *SysfsSampler::samplingThreadFunc(void *self) {
+    auto sampler = static_cast<SysfsSampler *>(self);
+    std::unique_lock<std::mutex> lock(sampler->stopMutex);
+    while (sampler->keepRunning) {
+        lock.unlock();
+        sampler->takeSample();
+        lock.lock();
+        sampler->stopCondition.wait_for(lock, sampler->period, [sampler] { return !sampler->keepRunning; });
+    }
+    return nullptr;
+}
+
+void SysfsSampler::takeSample() {
+    std::vector<int> vals;
+    std::vector<ze_result_t> results;
+    sysfsAccess.readMultiple(files, vals, results);
+    auto timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+
+    // Single producer, only sampling thread (or caller when thread is not started) writes
+    uint64_t sequenceNumber = samplesCount.load(std::memory_order_relaxed) + 1;
+    auto &slot = ring[(sequenceNumber - 1) % ringSize];
+
+    slot.sequence.store(2 * sequenceNumber - 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    uint32_t validMask = 0u;
+    for (size_t i = 0; i < files.size(); i++) {
+        if (ZE_RESULT_SUCCESS == results[i]) {
+            validMask |= 1u << i;
+        }
+        slot.values[i].store(vals[i], std::memory_order_relaxed);
+    }
+    slot.validMask.store(validMask, std::memory_order_relaxed);
+    slot.timestamp.store(static_cast<uint64_t>(timestamp), std::memory_order_relaxed);
+
+    slot.sequence.store(2 * sequenceNumber, std::memory_order_release);
+    samplesCount.store(sequenceNumber, std::memory_order_release);
+}
+
+bool SysfsSampler::readSlot(uint64_t sequenceNumber, SysfsSample &sample) const {
+    auto &slot = ring[(sequenceNumber - 1) % ringSize];
+    auto sequenceBefore = slot.sequence.load(std::memory_order_acquire);
+    if (sequenceBefore != 2 * sequenceNumber) {
+        return false;
+    }
+
+    sample.sequenceNumber = sequenceNumber;
+    sample.timestamp = slot.timestamp.load(std::memory_order_relaxed);
+    sample.validMask = slot.validMask.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < sample.values.size(); i++) {
+        sample.values[i] = slot.values[i].load(std::memory_order_relaxed);
+    }
+
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return slot.sequence.load(std::memory_order_relaxed) == sequenceBefore;
+}
+
+bool SysfsSampler::getLatestSample(SysfsSample &sample) const {
+    // Retry only when sampler overwrote the slot while it was copied, which requires lapping whole ring
+    while (true) {
+        auto sequenceNumber = getSamplesCount();
+        if (sequenceNumber == 0u) {
+            return false;
+        }
+        if (readSlot(sequenceNumber, sample)) {
+            return true;
+        }
+    }
+}
+
+uint32_t SysfsSampler::getSamples(uint64_t afterSequenceNumber, std::vector<SysfsSample> &samples) const {
+    auto lastSequenceNumber = getSamplesCount();
+    auto firstSequenceNumber = std::max(afterSequenceNumber + 1, lastSequenceNumber >= ringSize ? lastSequenceNumber - ringSize + 1 : 1u);
+
+    uint32_t samplesRead = 0u;
+    SysfsSample sample;
+    for (auto sequenceNumber = firstSequenceNumber; sequenceNumber <= lastSequenceNumber; sequenceNumber++) {
+        // Slots overwritten in the meantime are skipped
+        if (readSlot(sequenceNumber, sample)) {
+            samples.push_back(sample);
+            samplesRead++;
+        }
+    }
+    return samplesRead;
+}
+
+} // namespace L0
@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/os_interface/os_thread.h"
+
+#include "sysman/linux/sysfs_access.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace L0 {
+
+struct SysfsSample {
+    static constexpr uint32_t maxAttributesCount = 8u;
+
+    uint64_t sequenceNumber = 0u;
+    uint64_t timestamp = 0u; // steady clock, nanoseconds
+    uint32_t validMask = 0u; // bit i set when values[i] was read successfully
+    std::array<int64_t, maxAttributesCount> values = {};
+};
+
+// Periodically reads set of integer sysfs attributes on background thread.
+// Samples are published to fixed size ring guarded by per slot sequence counters (seqlock),
+// so readers never block the sampling thread and the sampling thread never waits for readers.
+class SysfsSampler {
+  public:
+    static constexpr uint32_t ringSize = 64u;
+
+    SysfsSampler(SysfsAccess &sysfsAccess, const std::vector<std::string> &files, std::chrono::microseconds period);
+    ~SysfsSampler();
+
+    // Don't allow copies of the SysfsSampler object
+    SysfsSampler(const SysfsSampler &obj) = delete;
+    SysfsSampler &operator=(const SysfsSampler &obj) = delete;
+
+    void start();
+    void stop();
+    void takeSample();
+
+    bool getLatestSample(SysfsSample &sample) const;
+    // Appends samples newer than given sequence number which are still present in ring, oldest first
+    uint32_t getSamples(uint64_t afterSequenceNumber, std::vector<SysfsSample> &samples) const;
+    uint64_t getSamplesCount() const { return samplesCount.load(std::memory_order_acquire); }
+    std::chrono::microseconds getPeriod() const { return period; }
+
+  protected:
+    struct Slot {
+        std::atomic<uint64_t> sequence{0u}; // odd while being written, 2 * sequenceNumber when published
+        std::atomic<uint64_t> timestamp{0u};
+        std::atomic<uint32_t> validMask{0u};
+        std::array<std::atomic<int64_t>, SysfsSample::maxAttributesCount> values;
+    };
+
+    static void *samplingThreadFunc(void *self);
+    bool readSlot(uint64_t sequenceNumber, SysfsSample &sample) const;
+
+    SysfsAccess &sysfsAccess;
+    std::vector<std::string> files;
+    std::chrono::microseconds period;
+
+    std::array<Slot, ringSize> ring;
+    std::atomic<uint64_t> samplesCount{0u};
+
+    std::mutex stopMutex;
+    std::condition_variable stopCondition;
+    bool keepRunning = false;
+    std::unique_ptr<NEO::Thread> samplingThread;
+};
+
+} // namespace L0
@@ -14,6 +14,8 @@
 #include "sysman/sysman_device/os_sysman_device.h"
 #include "sysman/sysman_device/sysman_device_imp.h"
 
+#include <algorithm>
+#include <sys/utsname.h>
 #include <unistd.h>
 
 namespace L0 {
@@ -35,12 +37,12 @@ class LinuxSysmanDeviceImp : public OsSysmanDevice {
 
   private:
     SysfsAccess *pSysfsAccess;
-    LinuxSysmanImp *pLinuxSysmanImp;
     static const std::string deviceDir;
     static const std::string vendorFile;
     static const std::string deviceFile;
     static const std::string subsystemVendorFile;
     static const std::string driverFile;
+    static const std::string driverModuleVersionFile;
 };
 
 const std::string vendorIntel("Intel(R) Corporation");
@@ -50,6 +52,7 @@ const std::string LinuxSysmanDeviceImp::vendorFile("device/vendor");
 const std::string LinuxSysmanDeviceImp::deviceFile("device/device");
 const std::string LinuxSysmanDeviceImp::subsystemVendorFile("device/subsystem_vendor");
 const std::string LinuxSysmanDeviceImp::driverFile("device/driver");
+const std::string LinuxSysmanDeviceImp::driverModuleVersionFile("device/driver/module/version");
 
 void LinuxSysmanDeviceImp::getSerialNumber(int8_t (&serialNumber)[ZET_STRING_PROPERTY_SIZE]) {
     std::copy(unknown.begin(), unknown.end(), serialNumber);
@@ -109,31 +112,35 @@ void LinuxSysmanDeviceImp::getVendorName(int8_t (&vendorName)[ZET_STRING_PROPERT
 }
 
 void LinuxSysmanDeviceImp::getDriverVersion(int8_t (&driverVersion)[ZET_STRING_PROPERTY_SIZE]) {
-    std::string output, command, strVal, driver;
-    //First get the driver name
+    std::string strVal;
+    //First make sure driver is bound to the device
     ze_result_t result = pSysfsAccess->readSymLink(driverFile, strVal);
     if (ZE_RESULT_SUCCESS != result) {
         std::copy(unknown.begin(), unknown.end(), driverVersion);
         driverVersion[unknown.size()] = '\0';
         return;
     }
-    const auto loc = strVal.find_last_of('/');
-    driver = strVal.substr(loc + 1);
-    //create the command like: modinfo -F vermagic i915
-    command = "modinfo -F vermagic " + driver;
-    result = pLinuxSysmanImp->systemCmd(command, output);
+
+    //Out of tree modules export their version in sysfs, in-tree driver is versioned with the kernel,
+    //which is what modinfo reports as vermagic
+    result = pSysfsAccess->read(driverModuleVersionFile, strVal);
     if (ZE_RESULT_SUCCESS != result) {
-        std::copy(unknown.begin(), unknown.end(), driverVersion);
-        driverVersion[unknown.size()] = '\0';
-        return;
+        struct utsname kernelInfo;
+        if (uname(&kernelInfo) != 0) {
+            std::copy(unknown.begin(), unknown.end(), driverVersion);
+            driverVersion[unknown.size()] = '\0';
+            return;
+        }
+        strVal = kernelInfo.release;
     }
 
-    //After below copy Not appending null in driverVersion, as output is null terminated
-    std::copy(output.begin(), output.end(), driverVersion);
+    auto versionSize = std::min(strVal.size(), static_cast<size_t>(ZET_STRING_PROPERTY_SIZE - 1));
+    std::copy(strVal.begin(), strVal.begin() + versionSize, driverVersion);
+    driverVersion[versionSize] = '\0';
 }
 
 LinuxSysmanDeviceImp::LinuxSysmanDeviceImp(OsSysman *pOsSysman) {
-    pLinuxSysmanImp = static_cast<LinuxSysmanImp *>(pOsSysman);
+    LinuxSysmanImp *pLinuxSysmanImp = static_cast<LinuxSysmanImp *>(pOsSysman);
 
     pSysfsAccess = &pLinuxSysmanImp->getSysfsAccess();
 }
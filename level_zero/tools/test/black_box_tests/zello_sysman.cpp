@@ -0,0 +1,145 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <level_zero/ze_api.h>
+#include <level_zero/zet_api.h>
+
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+// Queries frequency state repeatedly from several threads.
+// Sysfs attributes are read through cached descriptors, so every query after the first one reuses them.
+// Run with NEOReadDebugKeys=1 and SysmanSamplingPeriodMicroseconds=<period> to read states from sampler ring instead,
+// then concurrent readers race with the sampler thread publishing new samples.
+
+constexpr uint32_t threadCount = 4;
+constexpr uint32_t queriesPerThread = 10000;
+
+bool isStateValid(const zet_freq_state_t &state, const zet_freq_properties_t &properties) {
+    for (auto frequency : {state.request, state.tdp, state.efficient, state.actual}) {
+        // torn sample would mix values of different files or contain garbage
+        if (frequency < 0 || (properties.max > 0 && frequency > properties.max)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char *argv[]) {
+    // Initialize driver
+    ze_result_t res = zeInit(ZE_INIT_FLAG_NONE);
+    if (res) {
+        std::terminate();
+    }
+    res = zetInit(ZE_INIT_FLAG_NONE);
+    if (res) {
+        std::terminate();
+    }
+
+    // Retrieve driver
+    uint32_t driverCount = 0;
+    res = zeDriverGet(&driverCount, nullptr);
+    if (res || driverCount == 0) {
+        std::terminate();
+    }
+    ze_driver_handle_t driverHandle;
+    res = zeDriverGet(&driverCount, &driverHandle);
+    if (res) {
+        std::terminate();
+    }
+
+    // Retrieve device
+    uint32_t deviceCount = 0;
+    res = zeDeviceGet(driverHandle, &deviceCount, nullptr);
+    if (res || deviceCount == 0) {
+        std::terminate();
+    }
+    ze_device_handle_t device;
+    deviceCount = 1;
+    res = zeDeviceGet(driverHandle, &deviceCount, &device);
+    if (res) {
+        std::terminate();
+    }
+
+    // Retrieve sysman
+    zet_sysman_handle_t sysman;
+    res = zetSysmanGet(reinterpret_cast<zet_device_handle_t>(device), ZET_SYSMAN_VERSION_CURRENT, &sysman);
+    if (res) {
+        std::terminate();
+    }
+
+    zet_sysman_properties_t sysmanProperties = {};
+    res = zetSysmanDeviceGetProperties(sysman, &sysmanProperties);
+    if (res) {
+        std::terminate();
+    }
+    std::cout << "Sysman : \n"
+              << " * driver version : " << reinterpret_cast<const char *>(sysmanProperties.driverVersion) << "\n";
+
+    // Retrieve frequency domains
+    uint32_t frequencyCount = 0;
+    res = zetSysmanFrequencyGet(sysman, &frequencyCount, nullptr);
+    if (res) {
+        std::terminate();
+    }
+    std::vector<zet_sysman_freq_handle_t> frequencies(frequencyCount);
+    res = zetSysmanFrequencyGet(sysman, &frequencyCount, frequencies.data());
+    if (res) {
+        std::terminate();
+    }
+
+    bool outputValidationSuccessful = true;
+    for (auto frequency : frequencies) {
+        zet_freq_properties_t properties = {};
+        res = zetSysmanFrequencyGetProperties(frequency, &properties);
+        if (res) {
+            std::terminate();
+        }
+
+        std::atomic<uint32_t> failedQueries(0);
+        std::atomic<uint32_t> invalidStates(0);
+        std::vector<std::thread> threads;
+        for (uint32_t i = 0; i < threadCount; i++) {
+            threads.push_back(std::thread([&]() {
+                for (uint32_t query = 0; query < queriesPerThread; query++) {
+                    zet_freq_state_t state = {};
+                    if (zetSysmanFrequencyGetState(frequency, &state) != ZE_RESULT_SUCCESS) {
+                        failedQueries++;
+                    } else if (!isStateValid(state, properties)) {
+                        invalidStates++;
+                    }
+                }
+            }));
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+
+        zet_freq_state_t state = {};
+        res = zetSysmanFrequencyGetState(frequency, &state);
+        if (res) {
+            std::terminate();
+        }
+        std::cout << "Frequency domain : \n"
+                  << " * min : " << properties.min << " max : " << properties.max << "\n"
+                  << " * request : " << state.request << " tdp : " << state.tdp
+                  << " efficient : " << state.efficient << " actual : " << state.actual << "\n"
+                  << " * failed queries : " << failedQueries << " invalid states : " << invalidStates
+                  << " of " << threadCount * queriesPerThread << "\n";
+
+        if (failedQueries != 0 || invalidStates != 0) {
+            outputValidationSuccessful = false;
+        }
+    }
+
+    std::cout << "\nZello Sysman Results validation " << (outputValidationSuccessful ? "PASSED" : "FAILED") << "\n";
+
+    return 0;
+}
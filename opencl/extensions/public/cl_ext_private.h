@@ -58,6 +58,9 @@ using cl_mem_advice_intel = cl_uint;
 using cl_unified_shared_memory_type_intel = cl_uint;
 using cl_unified_shared_memory_capabilities_intel = cl_bitfield;
 
+struct _cl_command_graph_intel;
+using cl_command_graph_intel = _cl_command_graph_intel *;
+
 /******************************
  * Internal only cl_mem_flags *
  ******************************/
@@ -142,3 +145,10 @@ using cl_unified_shared_memory_capabilities_intel = cl_bitfield;
 
 /* cl_queue_properties */
 #define CL_QUEUE_SLICE_COUNT_INTEL 0x10021
+
+/******************************
+*        COMMAND GRAPH        *
+*******************************/
+
+/* cl_command_type */
+#define CL_COMMAND_COMMAND_GRAPH_INTEL 0x10030
@@ -25,6 +25,7 @@
 #include "opencl/source/api/additional_extensions.h"
 #include "opencl/source/aub/aub_center.h"
 #include "opencl/source/built_ins/vme_builtin.h"
+#include "opencl/source/command_queue/command_graph.h"
 #include "opencl/source/command_queue/command_queue.h"
 #include "opencl/source/context/context.h"
 #include "opencl/source/context/driver_diagnostics.h"
@@ -4010,6 +4011,10 @@ void *CL_API_CALL clGetExtensionFunctionAddress(const char *funcName) {
     RETURN_FUNC_PTR_IF_EXIST(clGetKernelMaxConcurrentWorkGroupCountINTEL);
     RETURN_FUNC_PTR_IF_EXIST(clGetKernelSuggestedLocalWorkSizeINTEL);
     RETURN_FUNC_PTR_IF_EXIST(clEnqueueNDCountKernelINTEL);
+    RETURN_FUNC_PTR_IF_EXIST(clBeginCommandGraphCaptureINTEL);
+    RETURN_FUNC_PTR_IF_EXIST(clEndCommandGraphCaptureINTEL);
+    RETURN_FUNC_PTR_IF_EXIST(clEnqueueCommandGraphINTEL);
+    RETURN_FUNC_PTR_IF_EXIST(clReleaseCommandGraphINTEL);
 
     void *ret = sharingFactory.getExtensionFunctionAddress(funcName);
     if (ret != nullptr) {
@@ -4465,7 +4470,12 @@ cl_int CL_API_CALL clSetKernelArgSVMPointer(cl_kernel kernel,
                 return retVal;
             }
         } else {
-            pSvmAlloc = svmData->gpuAllocation;
+            pSvmAlloc = svmManager->obtainGraphicsAllocation(*svmData, pKernel->getDevice().getRootDeviceIndex());
+            if (pSvmAlloc == nullptr) {
+                retVal = CL_OUT_OF_RESOURCES;
+                TRACING_EXIT(clSetKernelArgSVMPointer, &retVal);
+                return retVal;
+            }
         }
     }
 
@@ -4523,13 +4533,19 @@ cl_int CL_API_CALL clSetKernelExecInfo(cl_kernel kernel,
         }
 
         for (uint32_t i = 0; i < numPointers; i++) {
-            auto svmData = pKernel->getContext().getSVMAllocsManager()->getSVMAlloc((const void *)pSvmPtrList[i]);
+            auto svmAllocsManager = pKernel->getContext().getSVMAllocsManager();
+            auto svmData = svmAllocsManager->getSVMAlloc((const void *)pSvmPtrList[i]);
             if (svmData == nullptr) {
                 retVal = CL_INVALID_VALUE;
                 TRACING_EXIT(clSetKernelExecInfo, &retVal);
                 return retVal;
             }
-            GraphicsAllocation *svmAlloc = svmData->gpuAllocation;
+            GraphicsAllocation *svmAlloc = svmAllocsManager->obtainGraphicsAllocation(*svmData, pKernel->getDevice().getRootDeviceIndex());
+            if (svmAlloc == nullptr) {
+                retVal = CL_OUT_OF_RESOURCES;
+                TRACING_EXIT(clSetKernelExecInfo, &retVal);
+                return retVal;
+            }
 
             if (paramName == CL_KERNEL_EXEC_INFO_SVM_PTRS) {
                 pKernel->setSvmKernelExecInfo(svmAlloc);
@@ -5467,3 +5483,78 @@ cl_int CL_API_CALL clEnqueueNDCountKernelINTEL(cl_command_queue commandQueue,
     DBG_LOG_INPUTS("event", NEO::FileLoggerInstance().getEvents(reinterpret_cast<const uintptr_t *>(event), 1u));
     return retVal;
 }
+
+cl_int CL_API_CALL clBeginCommandGraphCaptureINTEL(cl_command_queue commandQueue) {
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("commandQueue", commandQueue);
+
+    CommandQueue *pCommandQueue = nullptr;
+    retVal = validateObjects(WithCastToInternal(commandQueue, &pCommandQueue));
+    if (CL_SUCCESS != retVal) {
+        return retVal;
+    }
+
+    retVal = pCommandQueue->beginGraphCapture();
+    return retVal;
+}
+
+cl_command_graph_intel CL_API_CALL clEndCommandGraphCaptureINTEL(cl_command_queue commandQueue,
+                                                                 cl_int *errcodeRet) {
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("commandQueue", commandQueue);
+
+    CommandGraph *pCommandGraph = nullptr;
+    CommandQueue *pCommandQueue = nullptr;
+    retVal = validateObjects(WithCastToInternal(commandQueue, &pCommandQueue));
+    if (CL_SUCCESS == retVal) {
+        pCommandGraph = pCommandQueue->endGraphCapture(retVal);
+    }
+
+    if (errcodeRet) {
+        *errcodeRet = retVal;
+    }
+    return pCommandGraph;
+}
+
+cl_int CL_API_CALL clEnqueueCommandGraphINTEL(cl_command_queue commandQueue,
+                                              cl_command_graph_intel commandGraph,
+                                              cl_event *event) {
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("commandQueue", commandQueue, "commandGraph", commandGraph,
+                   "event", NEO::FileLoggerInstance().getEvents(reinterpret_cast<const uintptr_t *>(event), 1));
+
+    CommandQueue *pCommandQueue = nullptr;
+    retVal = validateObjects(WithCastToInternal(commandQueue, &pCommandQueue));
+    if (CL_SUCCESS != retVal) {
+        return retVal;
+    }
+
+    auto pCommandGraph = castToObject<CommandGraph>(commandGraph);
+    if (!pCommandGraph) {
+        retVal = CL_INVALID_VALUE;
+        return retVal;
+    }
+
+    retVal = pCommandQueue->enqueueCommandGraph(*pCommandGraph, event);
+
+    DBG_LOG_INPUTS("event", NEO::FileLoggerInstance().getEvents(reinterpret_cast<const uintptr_t *>(event), 1u));
+    return retVal;
+}
+
+cl_int CL_API_CALL clReleaseCommandGraphINTEL(cl_command_graph_intel commandGraph) {
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("commandGraph", commandGraph);
+
+    auto pCommandGraph = castToObject<CommandGraph>(commandGraph);
+    if (!pCommandGraph) {
+        retVal = CL_INVALID_VALUE;
+        return retVal;
+    }
+
+    pCommandGraph->release();
+    return retVal;
+}
@@ -1053,6 +1053,21 @@ cl_int CL_API_CALL clEnqueueNDCountKernelINTEL(
     const cl_event *eventWaitList,
     cl_event *event);
 
+cl_int CL_API_CALL clBeginCommandGraphCaptureINTEL(
+    cl_command_queue commandQueue);
+
+cl_command_graph_intel CL_API_CALL clEndCommandGraphCaptureINTEL(
+    cl_command_queue commandQueue,
+    cl_int *errcodeRet);
+
+cl_int CL_API_CALL clEnqueueCommandGraphINTEL(
+    cl_command_queue commandQueue,
+    cl_command_graph_intel commandGraph,
+    cl_event *event);
+
+cl_int CL_API_CALL clReleaseCommandGraphINTEL(
+    cl_command_graph_intel commandGraph);
+
 // OpenCL 2.2
 
 cl_int CL_API_CALL clSetProgramSpecializationConstant(
@@ -0,0 +1,32 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/aub/dirty_page_tracker.h"
+
+namespace NEO {
+
+constexpr size_t DirtyPageTracker::pageSize;
+std::atomic<uint64_t> DirtyPageTracker::lastStreamId{0u};
+
+bool DirtyPageTracker::isTrackingAllowed(GraphicsAllocation::AllocationType allocationType) {
+    switch (allocationType) {
+    case GraphicsAllocation::AllocationType::COMMAND_BUFFER:
+    case GraphicsAllocation::AllocationType::CONSTANT_SURFACE:
+    case GraphicsAllocation::AllocationType::FILL_PATTERN:
+    case GraphicsAllocation::AllocationType::INDIRECT_OBJECT_HEAP:
+    case GraphicsAllocation::AllocationType::INSTRUCTION_HEAP:
+    case GraphicsAllocation::AllocationType::INTERNAL_HEAP:
+    case GraphicsAllocation::AllocationType::KERNEL_ISA:
+    case GraphicsAllocation::AllocationType::LINEAR_STREAM:
+    case GraphicsAllocation::AllocationType::RING_BUFFER:
+    case GraphicsAllocation::AllocationType::SURFACE_STATE_HEAP:
+        return true;
+    default:
+        return false;
+    }
+}
+} // namespace NEO
@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/hash.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/memory_manager/graphics_allocation.h"
+#include "shared/source/memory_manager/memory_constants.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+
+namespace NEO {
+
+struct DirtyPageStatistics {
+    uint64_t bytesWritten = 0u;
+    uint64_t bytesSkipped = 0u;
+};
+
+class DirtyPageTracker {
+  public:
+    static constexpr size_t pageSize = MemoryConstants::pageSize;
+
+    DirtyPageTracker() { startNewStream(); }
+
+    // Invalidates page hashes recorded for previous stream, e.g. when new AUB file is opened
+    void startNewStream() { streamId = ++lastStreamId; }
+
+    // Calls writeRange(offset, size) for every run of pages changed since the hashes were recorded and records new hashes
+    template <typename WriteRangeT>
+    void writeDirtyRanges(GraphicsAllocation::PageHashes &pageHashes, const void *cpuAddress, size_t size, WriteRangeT &&writeRange) {
+        bool hashesValid = (pageHashes.streamId == streamId);
+        auto numPages = (size + pageSize - 1) / pageSize;
+        if (!hashesValid) {
+            pageHashes.hashes.clear();
+            pageHashes.streamId = streamId;
+        }
+        auto numKnownPages = pageHashes.hashes.size();
+        pageHashes.hashes.resize(numPages);
+
+        size_t dirtyRunStart = 0u;
+        size_t dirtyRunSize = 0u;
+        for (size_t page = 0u; page < numPages; page++) {
+            auto pageOffset = page * pageSize;
+            auto currentPageSize = std::min(pageSize, size - pageOffset);
+            auto hash = Hash::hash(reinterpret_cast<const char *>(ptrOffset(cpuAddress, pageOffset)), currentPageSize);
+
+            if (page < numKnownPages && pageHashes.hashes[page] == hash) {
+                if (dirtyRunSize) {
+                    writeRange(dirtyRunStart, dirtyRunSize);
+                    dirtyRunSize = 0u;
+                }
+                statistics.bytesSkipped += currentPageSize;
+                continue;
+            }
+
+            pageHashes.hashes[page] = hash;
+            if (dirtyRunSize == 0u) {
+                dirtyRunStart = pageOffset;
+            }
+            dirtyRunSize += currentPageSize;
+            statistics.bytesWritten += currentPageSize;
+        }
+        if (dirtyRunSize) {
+            writeRange(dirtyRunStart, dirtyRunSize);
+        }
+    }
+
+    // GPU writes are not visible in page hashes, only allocations that GPU never writes can be tracked
+    static bool isTrackingAllowed(GraphicsAllocation::AllocationType allocationType);
+
+    const DirtyPageStatistics &getStatistics() const { return statistics; }
+
+  protected:
+    static std::atomic<uint64_t> lastStreamId;
+    uint64_t streamId = 0u;
+    DirtyPageStatistics statistics;
+};
+} // namespace NEO
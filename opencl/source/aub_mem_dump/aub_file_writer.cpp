@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/aub_mem_dump/aub_file_writer.h"
+
+#include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/os_interface/os_thread.h"
+
+#include <cstring>
+
+namespace AubMemDump {
+
+constexpr size_t AubFileWriter::defaultBufferSize;
+constexpr size_t AubFileWriter::maxPendingBuffers;
+
+AubFileWriter::AubFileWriter(std::ofstream &fileHandle, size_t bufferSize) : fileHandle(fileHandle), bufferSize(bufferSize) {
+    currentBuffer.reserve(bufferSize);
+    worker = NEO::Thread::create(run, reinterpret_cast<void *>(this));
+}
+
+AubFileWriter::~AubFileWriter() {
+    DEBUG_BREAK_IF(worker && (!currentBuffer.empty() || !pendingBuffers.empty()));
+    stopWorkerThread();
+}
+
+void AubFileWriter::close() {
+    if (worker) {
+        drain();
+        stopWorkerThread();
+    }
+}
+
+void AubFileWriter::stopWorkerThread() {
+    if (worker) {
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            stopWorker = true;
+        }
+        workAvailable.notify_one();
+        worker->join();
+        worker.reset();
+    }
+}
+
+void AubFileWriter::write(const char *data, size_t size) {
+    if (currentBuffer.size() + size > bufferSize) {
+        submitCurrentBuffer();
+    }
+    if (size > bufferSize) {
+        currentBuffer.assign(data, data + size);
+        submitCurrentBuffer();
+        return;
+    }
+    auto offset = currentBuffer.size();
+    currentBuffer.resize(offset + size);
+    memcpy(currentBuffer.data() + offset, data, size);
+}
+
+void AubFileWriter::flush() {
+    submitCurrentBuffer();
+}
+
+void AubFileWriter::drain() {
+    submitCurrentBuffer();
+    std::unique_lock<std::mutex> lock(queueMutex);
+    workDone.wait(lock, [this] { return pendingBuffers.empty() && !bufferInWriting; });
+}
+
+void AubFileWriter::submitCurrentBuffer() {
+    if (currentBuffer.empty()) {
+        return;
+    }
+    std::unique_lock<std::mutex> lock(queueMutex);
+    // Bound memory used for buffered records, producer waits for writer when it falls behind
+    workDone.wait(lock, [this] { return pendingBuffers.size() < maxPendingBuffers; });
+    bytesSubmitted += currentBuffer.size();
+    pendingBuffers.push_back(std::move(currentBuffer));
+    if (freeBuffers.empty()) {
+        currentBuffer = Buffer();
+        currentBuffer.reserve(bufferSize);
+    } else {
+        currentBuffer = std::move(freeBuffers.back());
+        freeBuffers.pop_back();
+    }
+    lock.unlock();
+    workAvailable.notify_one();
+}
+
+void AubFileWriter::writeBuffer(const Buffer &buffer) {
+    fileHandle.write(buffer.data(), buffer.size());
+}
+
+void *AubFileWriter::run(void *arg) {
+    auto self = reinterpret_cast<AubFileWriter *>(arg);
+    std::unique_lock<std::mutex> lock(self->queueMutex);
+    while (true) {
+        self->workAvailable.wait(lock, [self] { return !self->pendingBuffers.empty() || self->stopWorker; });
+        if (self->stopWorker) {
+            break;
+        }
+        auto buffer = std::move(self->pendingBuffers.front());
+        self->pendingBuffers.pop_front();
+        self->bufferInWriting = true;
+        lock.unlock();
+
+        self->writeBuffer(buffer);
+        buffer.clear();
+
+        lock.lock();
+        if (self->pendingBuffers.empty()) {
+            self->fileHandle.flush();
+        }
+        if (buffer.capacity() <= self->bufferSize && self->freeBuffers.size() < maxPendingBuffers) {
+            self->freeBuffers.push_back(std::move(buffer));
+        }
+        self->bufferInWriting = false;
+        self->workDone.notify_all();
+    }
+    return nullptr;
+}
+} // namespace AubMemDump
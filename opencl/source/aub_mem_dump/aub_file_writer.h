@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+class Thread;
+}
+
+namespace AubMemDump {
+
+// Collects AUB records in large buffers and writes them to file on a dedicated thread.
+// Records are written in the same order as they were submitted, so file content is identical to synchronous writes.
+// Owner has to call close() before destroying the writer, records that are not written by then are dropped.
+class AubFileWriter {
+  public:
+    static constexpr size_t defaultBufferSize = 4 * 1024 * 1024;
+    static constexpr size_t maxPendingBuffers = 4;
+
+    AubFileWriter(std::ofstream &fileHandle, size_t bufferSize);
+    virtual ~AubFileWriter();
+
+    AubFileWriter(const AubFileWriter &) = delete;
+    AubFileWriter &operator=(const AubFileWriter &) = delete;
+
+    void write(const char *data, size_t size);
+    // Hands buffered records over to writer thread without waiting for file write
+    void flush();
+    // Blocks until all submitted records are written to file
+    void drain();
+    // Writes all records to file and stops writer thread
+    void close();
+
+    uint64_t getBytesSubmitted() const { return bytesSubmitted; }
+
+  protected:
+    using Buffer = std::vector<char>;
+
+    void submitCurrentBuffer();
+    void stopWorkerThread();
+    MOCKABLE_VIRTUAL void writeBuffer(const Buffer &buffer);
+
+    static void *run(void *arg);
+
+    std::ofstream &fileHandle;
+    const size_t bufferSize;
+    Buffer currentBuffer;
+
+    std::deque<Buffer> pendingBuffers;
+    std::vector<Buffer> freeBuffers;
+    bool bufferInWriting = false;
+    bool stopWorker = false;
+    uint64_t bytesSubmitted = 0u;
+
+    std::mutex queueMutex;
+    std::condition_variable workAvailable;
+    std::condition_variable workDone;
+    std::unique_ptr<NEO::Thread> worker;
+};
+} // namespace AubMemDump
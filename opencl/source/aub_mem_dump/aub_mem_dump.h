@@ -9,6 +9,7 @@
 #include <cstdint>
 #include <cstdio>
 #include <fstream>
+#include <memory>
 #include <mutex>
 #include <string>
 
@@ -17,6 +18,7 @@
 #endif
 
 #include "opencl/source/aub_mem_dump/aub_data.h"
+#include "opencl/source/aub_mem_dump/aub_file_writer.h"
 
 namespace NEO {
 class AubHelper;
@@ -122,6 +124,7 @@ struct AubStream {
 };
 
 struct AubFileStream : public AubStream {
+    ~AubFileStream() override;
     void open(const char *filePath) override;
     void close() override;
     bool init(uint32_t stepping, uint32_t device) override;
@@ -145,6 +148,7 @@ struct AubFileStream : public AubStream {
     std::ofstream fileHandle;
     std::string fileName;
     std::mutex mutex;
+    std::unique_ptr<AubFileWriter> fileWriter;
 };
 
 template <int addressingBits>
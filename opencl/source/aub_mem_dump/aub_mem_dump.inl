@@ -5,6 +5,7 @@
  *
  */
 
+#include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/memory_constants.h"
@@ -124,8 +125,9 @@ void AubDump<Traits>::reserveAddressGGTTAndWriteMmeory(typename Traits::Stream &
                                                        uint64_t additionalBits, const NEO::AubHelper &aubHelper) {
     auto vmAddr = (gfxAddress + offset) & ~(MemoryConstants::pageSize - 1);
     auto pAddr = physAddress & ~(MemoryConstants::pageSize - 1);
+    auto vmEnd = alignUp(gfxAddress + offset + size, MemoryConstants::pageSize);
 
-    AubDump<Traits>::reserveAddressPPGTT(stream, vmAddr, MemoryConstants::pageSize, pAddr, additionalBits, aubHelper);
+    AubDump<Traits>::reserveAddressPPGTT(stream, vmAddr, std::max(vmEnd - vmAddr, MemoryConstants::pageSize), pAddr, additionalBits, aubHelper);
 
     int hint = NEO::AubHelper::getMemTrace(additionalBits);
 
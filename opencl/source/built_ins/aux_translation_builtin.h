@@ -21,22 +21,30 @@ class BuiltInOp<EBuiltInOps::AuxTranslation> : public BuiltinDispatchInfoBuilder
     BuiltInOp(BuiltIns &kernelsLib, Device &device);
     template <typename GfxFamily>
     bool buildDispatchInfosForAuxTranslation(MultiDispatchInfo &multiDispatchInfo, const BuiltinOpParams &operationParams) const {
-        size_t kernelInstanceNumber = 0;
-        size_t numMemObjectsToTranslate = multiDispatchInfo.getMemObjsForAuxTranslation()->size();
-        resizeKernelInstances(numMemObjectsToTranslate);
+        return buildDispatchInfosForAuxTranslation<GfxFamily>(multiDispatchInfo, operationParams, *multiDispatchInfo.getMemObjsForAuxTranslation(), 0u);
+    }
+
+    // Kernel instances are bound to mem objects until dispatch, translations in the same direction
+    // baked more than once into single MultiDispatchInfo have to start from different instance
+    template <typename GfxFamily>
+    bool buildDispatchInfosForAuxTranslation(MultiDispatchInfo &multiDispatchInfo, const BuiltinOpParams &operationParams,
+                                             const MemObjsForAuxTranslation &memObjsForAuxTranslation, size_t firstKernelInstance) const {
+        size_t kernelInstanceNumber = firstKernelInstance;
+        size_t numMemObjectsToTranslate = memObjsForAuxTranslation.size();
+        resizeKernelInstances(firstKernelInstance + numMemObjectsToTranslate);
         multiDispatchInfo.setBuiltinOpParams(operationParams);
 
-        for (auto &memObj : *multiDispatchInfo.getMemObjsForAuxTranslation()) {
+        for (auto &memObj : memObjsForAuxTranslation) {
             DispatchInfoBuilder<SplitDispatch::Dim::d1D, SplitDispatch::SplitMode::NoSplit> builder;
             size_t allocationSize = alignUp(memObj->getSize(), 512);
 
             UNRECOVERABLE_IF(builder.getMaxNumDispatches() != 1);
 
-            if (kernelInstanceNumber == 0) {
+            if (kernelInstanceNumber == firstKernelInstance) {
                 // Before Kernel
                 registerPipeControlProgramming<GfxFamily>(builder.getDispatchInfo(0).dispatchInitCommands, true);
             }
-            if (kernelInstanceNumber == numMemObjectsToTranslate - 1) {
+            if (kernelInstanceNumber == firstKernelInstance + numMemObjectsToTranslate - 1) {
                 // After Kernel
                 registerPipeControlProgramming<GfxFamily>(builder.getDispatchInfo(0).dispatchEpilogueCommands, false);
             }
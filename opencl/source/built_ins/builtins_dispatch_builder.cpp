@@ -10,6 +10,7 @@
 #include "shared/source/built_ins/built_ins.h"
 #include "shared/source/built_ins/sip.h"
 #include "shared/source/compiler_interface/compiler_interface.h"
+#include "shared/source/helpers/array_count.h"
 #include "shared/source/helpers/basic_math.h"
 #include "shared/source/helpers/debug_helpers.h"
 
@@ -42,6 +43,13 @@ class BuiltInOp<EBuiltInOps::CopyBufferToBuffer> : public BuiltinDispatchInfoBui
                  "CopyBufferToBufferMiddle", kernMiddle,
                  "CopyBufferToBufferRightLeftover", kernRightLeftover);
     }
+
+    std::unique_ptr<BuiltinDispatchInfoBuilder> clone() const override {
+        auto clonedBuilder = std::make_unique<BuiltInOp<EBuiltInOps::CopyBufferToBuffer>>(*this);
+        clonedBuilder->cloneKernels(*this);
+        return clonedBuilder;
+    }
+
     template <typename OffsetType>
     bool buildDispatchInfosTyped(MultiDispatchInfo &multiDispatchInfo, const BuiltinOpParams &operationParams) const {
         DispatchInfoBuilder<SplitDispatch::Dim::d1D, SplitDispatch::SplitMode::KernelSplit> kernelSplit1DBuilder;
@@ -116,6 +124,12 @@ class BuiltInOp<EBuiltInOps::CopyBufferToBuffer> : public BuiltinDispatchInfoBui
     }
 
   protected:
+    void cloneKernels(const BuiltInOp<EBuiltInOps::CopyBufferToBuffer> &source) {
+        kernLeftLeftover = cloneKernel(*source.kernLeftLeftover);
+        kernMiddle = cloneKernel(*source.kernMiddle);
+        kernRightLeftover = cloneKernel(*source.kernRightLeftover);
+    }
+
     Kernel *kernLeftLeftover = nullptr;
     Kernel *kernMiddle = nullptr;
     Kernel *kernRightLeftover = nullptr;
@@ -137,6 +151,12 @@ class BuiltInOp<EBuiltInOps::CopyBufferToBufferStateless> : public BuiltInOp<EBu
                  "CopyBufferToBufferRightLeftover", kernRightLeftover);
     }
 
+    std::unique_ptr<BuiltinDispatchInfoBuilder> clone() const override {
+        auto clonedBuilder = std::make_unique<BuiltInOp<EBuiltInOps::CopyBufferToBufferStateless>>(*this);
+        clonedBuilder->cloneKernels(*this);
+        return clonedBuilder;
+    }
+
     bool buildDispatchInfos(MultiDispatchInfo &multiDispatchInfo, const BuiltinOpParams &operationParams) const override {
         return buildDispatchInfosTyped<uint64_t>(multiDispatchInfo, operationParams);
     }
@@ -155,6 +175,12 @@ class BuiltInOp<EBuiltInOps::CopyBufferRect> : public BuiltinDispatchInfoBuilder
                  "CopyBufferRectBytes3d", kernelBytes[2]);
     }
 
+    std::unique_ptr<BuiltinDispatchInfoBuilder> clone() const override {
+        auto clonedBuilder = std::make_unique<BuiltInOp<EBuiltInOps::CopyBufferRect>>(*this);
+        clonedBuilder->cloneKernels(*this);
+        return clonedBuilder;
+    }
+
     template <typename OffsetType>
     bool buildDispatchInfosTyped(MultiDispatchInfo &multiDispatchInfo, const BuiltinOpParams &operationParams) const {
         DispatchInfoBuilder<SplitDispatch::Dim::d3D, SplitDispatch::SplitMode::NoSplit> kernelNoSplit3DBuilder;
@@ -242,6 +268,12 @@ class BuiltInOp<EBuiltInOps::CopyBufferRect> : public BuiltinDispatchInfoBuilder
     }
 
   protected:
+    void cloneKernels(const BuiltInOp<EBuiltInOps::CopyBufferRect> &source) {
+        for (size_t i = 0; i < arrayCount(kernelBytes); i++) {
+            kernelBytes[i] = cloneKernel(*source.kernelBytes[i]);
+        }
+    }
+
     Kernel *kernelBytes[3];
     BuiltInOp(BuiltIns &kernelsLib) : BuiltinDispatchInfoBuilder(kernelsLib), kernelBytes{nullptr} {};
 };
@@ -258,6 +290,13 @@ class BuiltInOp<EBuiltInOps::CopyBufferRectStateless> : public BuiltInOp<EBuiltI
                  "CopyBufferRectBytes2d", kernelBytes[1],
                  "CopyBufferRectBytes3d", kernelBytes[2]);
     }
+
+    std::unique_ptr<BuiltinDispatchInfoBuilder> clone() const override {
+        auto clonedBuilder = std::make_unique<BuiltInOp<EBuiltInOps::CopyBufferRectStateless>>(*this);
+        clonedBuilder->cloneKernels(*this);
+        return clonedBuilder;
+    }
+
     bool buildDispatchInfos(MultiDispatchInfo &multiDispatchInfo, const BuiltinOpParams &operationParams) const override {
         return buildDispatchInfosTyped<uint64_t>(multiDispatchInfo, operationParams);
     }
@@ -276,6 +315,12 @@ class BuiltInOp<EBuiltInOps::FillBuffer> : public BuiltinDispatchInfoBuilder {
                  "FillBufferRightLeftover", kernRightLeftover);
     }
 
+    std::unique_ptr<BuiltinDispatchInfoBuilder> clone() const override {
+        auto clonedBuilder = std::make_unique<BuiltInOp<EBuiltInOps::FillBuffer>>(*this);
+        clonedBuilder->cloneKernels(*this);
+        return clonedBuilder;
+    }
+
     template <typename OffsetType>
     bool buildDispatchInfosTyped(MultiDispatchInfo &multiDispatchInfo, const BuiltinOpParams &operationParams) const {
         DispatchInfoBuilder<SplitDispatch::Dim::d1D, SplitDispatch::SplitMode::KernelSplit> kernelSplit1DBuilder;
@@ -339,6 +384,12 @@ class BuiltInOp<EBuiltInOps::FillBuffer> : public BuiltinDispatchInfoBuilder {
     }
 
   protected:
+    void cloneKernels(const BuiltInOp<EBuiltInOps::FillBuffer> &source) {
+        kernLeftLeftover = cloneKernel(*source.kernLeftLeftover);
+        kernMiddle = cloneKernel(*source.kernMiddle);
+        kernRightLeftover = cloneKernel(*source.kernRightLeftover);
+    }
+
     Kernel *kernLeftLeftover = nullptr;
     Kernel *kernMiddle = nullptr;
     Kernel *kernRightLeftover = nullptr;
@@ -357,6 +408,13 @@ class BuiltInOp<EBuiltInOps::FillBufferStateless> : public BuiltInOp<EBuiltInOps
                  "FillBufferMiddle", kernMiddle,
                  "FillBufferRightLeftover", kernRightLeftover);
     }
+
+    std::unique_ptr<BuiltinDispatchInfoBuilder> clone() const override {
+        auto clonedBuilder = std::make_unique<BuiltInOp<EBuiltInOps::FillBufferStateless>>(*this);
+        clonedBuilder->cloneKernels(*this);
+        return clonedBuilder;
+    }
+
     bool buildDispatchInfos(MultiDispatchInfo &multiDispatchInfo, const BuiltinOpParams &operationParams) const override {
         return buildDispatchInfosTyped<uint64_t>(multiDispatchInfo, operationParams);
     }
@@ -377,11 +435,23 @@ class BuiltInOp<EBuiltInOps::CopyBufferToImage3d> : public BuiltinDispatchInfoBu
                  "CopyBufferToImage3d16Bytes", kernelBytes[4]);
     }
 
+    std::unique_ptr<BuiltinDispatchInfoBuilder> clone() const override {
+        auto clonedBuilder = std::make_unique<BuiltInOp<EBuiltInOps::CopyBufferToImage3d>>(*this);
+        clonedBuilder->cloneKernels(*this);
+        return clonedBuilder;
+    }
+
     bool buildDispatchInfos(MultiDispatchInfo &multiDispatchInfo, const BuiltinOpParams &operationParams) const override {
         return buildDispatchInfosTyped<uint32_t>(multiDispatchInfo, operationParams);
     }
 
   protected:
+    void cloneKernels(const BuiltInOp<EBuiltInOps::CopyBufferToImage3d> &source) {
+        for (size_t i = 0; i < arrayCount(kernelBytes); i++) {
+            kernelBytes[i] = cloneKernel(*source.kernelBytes[i]);
+        }
+    }
+
     Kernel *kernelBytes[5] = {nullptr};
     BuiltInOp(BuiltIns &kernelsLib) : BuiltinDispatchInfoBuilder(kernelsLib){};
 
@@ -470,6 +540,12 @@ class BuiltInOp<EBuiltInOps::CopyBufferToImage3dStateless> : public BuiltInOp<EB
                  "CopyBufferToImage3d16Bytes", kernelBytes[4]);
     }
 
+    std::unique_ptr<BuiltinDispatchInfoBuilder> clone() const override {
+        auto clonedBuilder = std::make_unique<BuiltInOp<EBuiltInOps::CopyBufferToImage3dStateless>>(*this);
+        clonedBuilder->cloneKernels(*this);
+        return clonedBuilder;
+    }
+
     bool buildDispatchInfos(MultiDispatchInfo &multiDispatchInfo, const BuiltinOpParams &operationParams) const override {
         return buildDispatchInfosTyped<uint64_t>(multiDispatchInfo, operationParams);
     }
@@ -490,11 +566,23 @@ class BuiltInOp<EBuiltInOps::CopyImage3dToBuffer> : public BuiltinDispatchInfoBu
                  "CopyImage3dToBuffer16Bytes", kernelBytes[4]);
     }
 
+    std::unique_ptr<BuiltinDispatchInfoBuilder> clone() const override {
+        auto clonedBuilder = std::make_unique<BuiltInOp<EBuiltInOps::CopyImage3dToBuffer>>(*this);
+        clonedBuilder->cloneKernels(*this);
+        return clonedBuilder;
+    }
+
     bool buildDispatchInfos(MultiDispatchInfo &multiDispatchInfo, const BuiltinOpParams &operationParams) const override {
         return buildDispatchInfosTyped<uint32_t>(multiDispatchInfo, operationParams);
     }
 
   protected:
+    void cloneKernels(const BuiltInOp<EBuiltInOps::CopyImage3dToBuffer> &source) {
+        for (size_t i = 0; i < arrayCount(kernelBytes); i++) {
+            kernelBytes[i] = cloneKernel(*source.kernelBytes[i]);
+        }
+    }
+
     Kernel *kernelBytes[5] = {nullptr};
 
     BuiltInOp(BuiltIns &kernelsLib) : BuiltinDispatchInfoBuilder(kernelsLib) {}
@@ -584,6 +672,12 @@ class BuiltInOp<EBuiltInOps::CopyImage3dToBufferStateless> : public BuiltInOp<EB
                  "CopyImage3dToBuffer16Bytes", kernelBytes[4]);
     }
 
+    std::unique_ptr<BuiltinDispatchInfoBuilder> clone() const override {
+        auto clonedBuilder = std::make_unique<BuiltInOp<EBuiltInOps::CopyImage3dToBufferStateless>>(*this);
+        clonedBuilder->cloneKernels(*this);
+        return clonedBuilder;
+    }
+
     bool buildDispatchInfos(MultiDispatchInfo &multiDispatchInfo, const BuiltinOpParams &operationParams) const override {
         return buildDispatchInfosTyped<uint64_t>(multiDispatchInfo, operationParams);
     }
@@ -600,6 +694,12 @@ class BuiltInOp<EBuiltInOps::CopyImageToImage3d> : public BuiltinDispatchInfoBui
                  "CopyImageToImage3d", kernel);
     }
 
+    std::unique_ptr<BuiltinDispatchInfoBuilder> clone() const override {
+        auto clonedBuilder = std::make_unique<BuiltInOp<EBuiltInOps::CopyImageToImage3d>>(*this);
+        clonedBuilder->cloneKernels(*this);
+        return clonedBuilder;
+    }
+
     bool buildDispatchInfos(MultiDispatchInfo &multiDispatchInfo, const BuiltinOpParams &operationParams) const override {
         DispatchInfoBuilder<SplitDispatch::Dim::d3D, SplitDispatch::SplitMode::NoSplit> kernelNoSplit3DBuilder;
         multiDispatchInfo.setBuiltinOpParams(operationParams);
@@ -651,6 +751,10 @@ class BuiltInOp<EBuiltInOps::CopyImageToImage3d> : public BuiltinDispatchInfoBui
     }
 
   protected:
+    void cloneKernels(const BuiltInOp<EBuiltInOps::CopyImageToImage3d> &source) {
+        kernel = cloneKernel(*source.kernel);
+    }
+
     Kernel *kernel;
 };
 
@@ -665,6 +769,12 @@ class BuiltInOp<EBuiltInOps::FillImage3d> : public BuiltinDispatchInfoBuilder {
                  "FillImage3d", kernel);
     }
 
+    std::unique_ptr<BuiltinDispatchInfoBuilder> clone() const override {
+        auto clonedBuilder = std::make_unique<BuiltInOp<EBuiltInOps::FillImage3d>>(*this);
+        clonedBuilder->cloneKernels(*this);
+        return clonedBuilder;
+    }
+
     bool buildDispatchInfos(MultiDispatchInfo &multiDispatchInfo, const BuiltinOpParams &operationParams) const override {
         DispatchInfoBuilder<SplitDispatch::Dim::d3D, SplitDispatch::SplitMode::NoSplit> kernelNoSplit3DBuilder;
         multiDispatchInfo.setBuiltinOpParams(operationParams);
@@ -709,6 +819,10 @@ class BuiltInOp<EBuiltInOps::FillImage3d> : public BuiltinDispatchInfoBuilder {
     }
 
   protected:
+    void cloneKernels(const BuiltInOp<EBuiltInOps::FillImage3d> &source) {
+        kernel = cloneKernel(*source.kernel);
+    }
+
     Kernel *kernel;
 };
 
@@ -762,6 +876,14 @@ BuiltinDispatchInfoBuilder &BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuil
     return *operationBuilder.first;
 }
 
+Kernel *BuiltinDispatchInfoBuilder::cloneKernel(const Kernel &sourceKernel) {
+    cl_int err = 0;
+    auto clonedKernel = Kernel::create(sourceKernel.getProgram(), sourceKernel.getKernelInfo(), &err);
+    clonedKernel->isBuiltIn = true;
+    usedKernels.push_back(std::unique_ptr<Kernel>(clonedKernel));
+    return clonedKernel;
+}
+
 BuiltInOwnershipWrapper::BuiltInOwnershipWrapper(BuiltinDispatchInfoBuilder &inputBuilder, Context *context) {
     takeOwnership(inputBuilder, context);
 }
@@ -58,6 +58,11 @@ class BuiltinDispatchInfoBuilder {
     BuiltinDispatchInfoBuilder(BuiltIns &kernelLib) : kernelsLib(kernelLib) {}
     virtual ~BuiltinDispatchInfoBuilder() = default;
 
+    // returns builder with its own kernel instances (sharing program with this builder) or nullptr when cloning is not supported
+    virtual std::unique_ptr<BuiltinDispatchInfoBuilder> clone() const {
+        return nullptr;
+    }
+
     template <typename... KernelsDescArgsT>
     void populate(Device &device, EBuiltInOps::Type operation, const char *options, KernelsDescArgsT &&... desc);
 
@@ -83,6 +88,8 @@ class BuiltinDispatchInfoBuilder {
     std::vector<std::unique_ptr<Kernel>> &peekUsedKernels() { return usedKernels; }
 
   protected:
+    BuiltinDispatchInfoBuilder(const BuiltinDispatchInfoBuilder &source) : kernelsLib(source.kernelsLib) {}
+
     template <typename KernelNameT, typename... KernelsDescArgsT>
     void grabKernels(KernelNameT &&kernelName, Kernel *&kernelDst, KernelsDescArgsT &&... kernelsDesc) {
         const KernelInfo *kernelInfo = prog->getKernelInfo(kernelName);
@@ -96,6 +103,9 @@ class BuiltinDispatchInfoBuilder {
 
     cl_int grabKernels() { return CL_SUCCESS; }
 
+    // creates kernel instance for this builder from the same program and kernel info as source kernel
+    Kernel *cloneKernel(const Kernel &sourceKernel);
+
     std::unique_ptr<Program> prog;
     std::vector<std::unique_ptr<Kernel>> usedKernels;
     BuiltIns &kernelsLib;
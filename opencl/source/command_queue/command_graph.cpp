@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/command_queue/command_graph.h"
+
+#include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/command_stream/csr_definitions.h"
+#include "shared/source/command_stream/linear_stream.h"
+#include "shared/source/helpers/flush_stamp.h"
+#include "shared/source/memory_manager/surface.h"
+
+#include "opencl/source/command_queue/command_queue.h"
+#include "opencl/source/gtpin/gtpin_notify.h"
+#include "opencl/source/helpers/dispatch_info.h"
+#include "opencl/source/kernel/kernel.h"
+
+namespace NEO {
+
+CommandGraphNode::CommandGraphNode(Kernel &kernel) : kernel(kernel) {
+    kernel.incRefInternal();
+}
+
+CommandGraphNode::~CommandGraphNode() {
+    for (auto surface : surfaces) {
+        delete surface;
+    }
+    kernel.decRefInternal();
+}
+
+CommandGraph::CommandGraph(CommandQueue &commandQueue, std::vector<std::unique_ptr<CommandGraphNode>> &&nodes)
+    : commandQueue(commandQueue), nodes(std::move(nodes)) {
+    commandQueue.incRefInternal();
+}
+
+CommandGraph::~CommandGraph() {
+    // captured heaps and timestamp packets are returned for reuse, GPU has to be done with them
+    if (lastReplayTaskCount != 0u) {
+        commandQueue.waitUntilComplete(lastReplayTaskCount, lastReplayFlushStamp, false);
+    }
+    nodes.clear();
+    commandQueue.decRefInternal();
+}
+
+CompletionStamp CommandGraph::replay(uint32_t taskLevel) {
+    auto &commandStreamReceiver = commandQueue.getGpgpuCommandStreamReceiver();
+
+    // flushTask appends epilogue to captured command buffers, previous replay cannot be executing them anymore
+    if (lastReplayTaskCount != 0u) {
+        commandQueue.waitUntilComplete(lastReplayTaskCount, lastReplayFlushStamp, false);
+    }
+
+    CompletionStamp completionStamp = {commandQueue.taskCount, taskLevel, commandQueue.flushStamp->peekStamp()};
+    for (auto &node : nodes) {
+        auto &commandStream = *node->kernelOperation->commandStream;
+        commandStream.replaceBuffer(commandStream.getCpuBase(), commandStream.getMaxAvailableSpace());
+        commandStream.getSpace(node->commandStreamSize);
+
+        auto kernel = &node->kernel;
+        auto requiresCoherency = false;
+        auto anyUncacheableArgs = false;
+        for (auto &surface : node->surfaces) {
+            surface->makeResident(commandStreamReceiver);
+            requiresCoherency |= surface->IsCoherent;
+            if (!surface->allowsL3Caching()) {
+                anyUncacheableArgs = true;
+            }
+        }
+        node->timestampPacketNodes.makeResident(commandStreamReceiver);
+        commandStreamReceiver.setRequiredScratchSizes(node->requiredScratchSize, node->requiredPrivateScratchSize);
+
+        // timestamp packet dependencies are not captured, nodes are ordered with stall in front of each of them
+        commandStreamReceiver.requestStallingPipeControlOnNextFlush();
+
+        DispatchFlags dispatchFlags(
+            {},                                                                     //csrDependencies
+            nullptr,                                                                //barrierTimestampPacketNodes
+            {false, kernel->isVmeKernel()},                                         //pipelineSelectArgs
+            commandQueue.flushStamp->getStampReference(),                           //flushStampReference
+            commandQueue.getThrottle(),                                             //throttle
+            node->preemptionMode,                                                   //preemptionMode
+            kernel->getKernelInfo().patchInfo.executionEnvironment->NumGRFRequired, //numGrfRequired
+            L3CachingSettings::l3CacheOn,                                           //l3CacheSettings
+            kernel->getThreadArbitrationPolicy(),                                   //threadArbitrationPolicy
+            commandQueue.getSliceCount(),                                           //sliceCount
+            false,                                                                  //blocking
+            node->dcFlush,                                                          //dcFlush
+            node->slmUsed,                                                          //useSLM
+            true,                                                                   //guardCommandBufferWithPipeControl
+            node->ndRangeKernel,                                                    //GSBA32BitRequired
+            requiresCoherency,                                                      //requiresCoherency
+            commandQueue.getPriority() == QueuePriority::LOW,                       //lowPriority
+            false,                                                                  //implicitFlush
+            commandStreamReceiver.isNTo1SubmissionModelEnabled(),                   //outOfOrderExecutionAllowed
+            false,                                                                  //epilogueRequired
+            kernel->requiresPerDssBackedBuffer()                                    //usePerDssBackedBuffer
+        );
+
+        dispatchFlags.pipelineSelectArgs.specialPipelineSelectMode = kernel->requiresSpecialPipelineSelectMode();
+        if (anyUncacheableArgs) {
+            dispatchFlags.l3CacheSettings = L3CachingSettings::l3CacheOff;
+        } else if (!kernel->areStatelessWritesUsed()) {
+            dispatchFlags.l3CacheSettings = L3CachingSettings::l3AndL1On;
+        }
+
+        if (commandQueue.dispatchHints != 0) {
+            dispatchFlags.engineHints = commandQueue.dispatchHints;
+            dispatchFlags.epilogueRequired = true;
+        }
+
+        gtpinNotifyPreFlushTask(&commandQueue);
+
+        completionStamp = commandStreamReceiver.flushTask(commandStream,
+                                                          0,
+                                                          *node->kernelOperation->dsh,
+                                                          *node->kernelOperation->ioh,
+                                                          *node->kernelOperation->ssh,
+                                                          completionStamp.taskLevel,
+                                                          dispatchFlags,
+                                                          commandQueue.getDevice());
+
+        if (gtpinIsGTPinInitialized()) {
+            gtpinNotifyFlushTask(completionStamp.taskCount);
+        }
+    }
+
+    lastReplayTaskCount = completionStamp.taskCount;
+    lastReplayFlushStamp = completionStamp.flushStamp;
+    return completionStamp;
+}
+} // namespace NEO
@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/command_stream/preemption_mode.h"
+#include "shared/source/helpers/completion_stamp.h"
+#include "shared/source/helpers/timestamp_packet.h"
+
+#include "opencl/extensions/public/cl_ext_private.h"
+#include "opencl/source/api/cl_types.h"
+#include "opencl/source/helpers/base_object.h"
+#include "opencl/source/helpers/task_information.h"
+
+#include <memory>
+#include <vector>
+
+namespace NEO {
+class CommandQueue;
+class Kernel;
+class Surface;
+
+template <>
+struct OpenCLObjectMapper<_cl_command_graph_intel> {
+    typedef class CommandGraph DerivedType;
+};
+
+// Kernel enqueue captured into command graph, with command buffer, heaps and residency generated at capture time
+struct CommandGraphNode {
+    CommandGraphNode(Kernel &kernel);
+    ~CommandGraphNode();
+
+    std::unique_ptr<KernelOperation> kernelOperation;
+    size_t commandStreamSize = 0u;
+    std::vector<Surface *> surfaces;
+    Kernel &kernel;
+    TimestampPacketContainer timestampPacketNodes;
+    PreemptionMode preemptionMode = PreemptionMode::Initial;
+    uint32_t requiredScratchSize = 0u;
+    uint32_t requiredPrivateScratchSize = 0u;
+    bool dcFlush = false;
+    bool slmUsed = false;
+    bool ndRangeKernel = false;
+};
+
+// Sequence of kernel enqueues captured on in-order command queue.
+// Replay only resubmits captured command buffers, without building dispatch info or programming walkers again.
+class CommandGraph : public BaseObject<_cl_command_graph_intel> {
+  public:
+    static const cl_ulong objectMagic = 0x3A8C61E5D27B40F9ULL;
+
+    CommandGraph(CommandQueue &commandQueue, std::vector<std::unique_ptr<CommandGraphNode>> &&nodes);
+    ~CommandGraph() override;
+
+    // Needs ownership of command queue and its command stream receiver
+    CompletionStamp replay(uint32_t taskLevel);
+
+    CommandQueue &getCommandQueue() const { return commandQueue; }
+    size_t getNodesCount() const { return nodes.size(); }
+
+  protected:
+    CommandQueue &commandQueue;
+    std::vector<std::unique_ptr<CommandGraphNode>> nodes;
+    uint32_t lastReplayTaskCount = 0u;
+    FlushStamp lastReplayFlushStamp = 0u;
+};
+} // namespace NEO
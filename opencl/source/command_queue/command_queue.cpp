@@ -8,6 +8,8 @@
 #include "opencl/source/command_queue/command_queue.h"
 
 #include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/command_stream/preemption.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/array_count.h"
 #include "shared/source/helpers/engine_node_helper.h"
@@ -16,11 +18,14 @@
 #include "shared/source/helpers/string.h"
 #include "shared/source/helpers/timestamp_packet.h"
 #include "shared/source/memory_manager/internal_allocation_storage.h"
+#include "shared/source/memory_manager/surface.h"
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/utilities/api_intercept.h"
+#include "shared/source/utilities/range.h"
 #include "shared/source/utilities/tag_allocator.h"
 
 #include "opencl/source/built_ins/builtins_dispatch_builder.h"
+#include "opencl/source/command_queue/command_graph.h"
 #include "opencl/source/context/context.h"
 #include "opencl/source/device/cl_device.h"
 #include "opencl/source/device_queue/device_queue.h"
@@ -36,10 +41,15 @@
 
 #include "CL/cl_ext.h"
 
+#include <algorithm>
+#include <atomic>
 #include <map>
 
 namespace NEO {
 
+constexpr uint32_t CommandQueue::defaultBuiltinShardsCount;
+constexpr uint32_t CommandQueue::maxBuiltinShardsCount;
+
 // Global table of create functions
 CommandQueueCreateFunc commandQueueFactory[IGFX_MAX_CORE] = {};
 
@@ -99,7 +109,20 @@ CommandQueue::~CommandQueue() {
         }
     }
 
+    for (auto memObj : memObjsLeftNonAux) {
+        memObj->decRefInternal();
+    }
+    if (auxTranslationCounters.translationsRequired > 0) {
+        printDebugString(DebugManager.flags.PrintDebugMessages.get(), stdout, "Aux translations required: %llu, dispatched: %llu\n",
+                         auxTranslationCounters.translationsRequired, auxTranslationCounters.translationsDispatched);
+    }
+
     timestampPacketContainer.reset();
+    for (auto &queueBuilder : builtinDispatchInfoBuilders) {
+        for (auto &builder : queueBuilder.builders) {
+            builder.reset();
+        }
+    }
     //for normal queue, decrement ref count on context
     //special queue is owned by context so ref count doesn't have to be decremented
     if (context && !isSpecialCommandQueue) {
@@ -122,6 +145,43 @@ Device &CommandQueue::getDevice() const noexcept {
     return device->getDevice();
 }
 
+std::shared_ptr<BuiltinDispatchInfoBuilder> CommandQueue::getBuiltinDispatchInfoBuilder(EBuiltInOps::Type operation) {
+    auto &deviceBuilder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(operation, getDevice());
+    // device builder is owned by builtins of the device, returned pointer doesn't own it
+    std::shared_ptr<BuiltinDispatchInfoBuilder> deviceBuilderPtr(std::shared_ptr<BuiltinDispatchInfoBuilder>(), &deviceBuilder);
+    if (DebugManager.flags.EnablePerQueueBuiltinKernels.get() == 0) {
+        return deviceBuilderPtr;
+    }
+
+    std::lock_guard<std::mutex> lock(builtinDispatchInfoBuildersMutex);
+    auto &queueBuilder = builtinDispatchInfoBuilders[operation];
+    auto shardIndex = getBuiltinShardIndex();
+    auto &shardBuilder = queueBuilder.builders[shardIndex];
+    if (queueBuilder.sources[shardIndex] != &deviceBuilder) {
+        // outdated clone is released once the last thread using it drops its pointer
+        shardBuilder.reset();
+        queueBuilder.sources[shardIndex] = &deviceBuilder;
+    }
+    if (!shardBuilder) {
+        shardBuilder = deviceBuilder.clone();
+    }
+    if (shardBuilder) {
+        return shardBuilder;
+    }
+    return deviceBuilderPtr;
+}
+
+uint32_t CommandQueue::getBuiltinShardIndex() {
+    uint32_t shardsCount = defaultBuiltinShardsCount;
+    if (DebugManager.flags.PerQueueBuiltinKernelShards.get() != -1) {
+        shardsCount = static_cast<uint32_t>(std::max(1, std::min(DebugManager.flags.PerQueueBuiltinKernelShards.get(), static_cast<int32_t>(maxBuiltinShardsCount))));
+    }
+
+    static std::atomic<uint32_t> nextThreadIndex{0};
+    thread_local uint32_t threadIndex = nextThreadIndex++;
+    return threadIndex % shardsCount;
+}
+
 uint32_t CommandQueue::getHwTag() const {
     uint32_t tag = *getHwTagAddress();
     return tag;
@@ -358,7 +418,7 @@ void *CommandQueue::enqueueReadMemObjForMap(TransferProperties &transferProperti
     void *basePtr = transferProperties.memObj->getBasePtrForMap(getDevice().getRootDeviceIndex());
     size_t mapPtrOffset = transferProperties.memObj->calculateOffsetForMapping(transferProperties.offset) + transferProperties.mipPtrOffset;
     if (transferProperties.memObj->peekClMemObjType() == CL_MEM_OBJECT_BUFFER) {
-        mapPtrOffset += transferProperties.memObj->getOffset();
+        mapPtrOffset += transferProperties.memObj->getOffset() - transferProperties.memObj->getPoolOffset();
     }
     void *returnPtr = ptrOffset(basePtr, mapPtrOffset);
 
@@ -609,6 +669,244 @@ bool CommandQueue::queueDependenciesClearRequired() const {
     return isOOQEnabled() || DebugManager.flags.OmitTimestampPacketDependencies.get();
 }
 
+UserEvent *CommandQueue::prepareUserEventsForGpuWait(uint32_t commandType, const MultiDispatchInfo &multiDispatchInfo, cl_uint numEventsInWaitList,
+                                                     const cl_event *eventWaitList, Event *outEvent, std::vector<cl_event> &eventsForTaskLevel) {
+    if (DebugManager.flags.EnableGpuWaitForUserEvents.get() != 1 || !getGpgpuCommandStreamReceiver().peekTimestampPacketWriteEnabled()) {
+        return nullptr;
+    }
+    // terminated user event has to skip the enqueue, only walkers can be predicated
+    auto memObjsForAuxTranslation = multiDispatchInfo.getMemObjsForAuxTranslation();
+    if (multiDispatchInfo.empty() || blitEnqueueAllowed(commandType) || multiDispatchInfo.peekParentKernel() ||
+        (memObjsForAuxTranslation && memObjsForAuxTranslation->size() > 0) || isQueueBlocked()) {
+        return nullptr;
+    }
+
+    UserEvent *userEvent = nullptr;
+    for (auto i = 0u; i < numEventsInWaitList; i++) {
+        auto event = castToObjectOrAbort<Event>(eventWaitList[i]);
+        if (event->taskLevel != CompletionStamp::levelNotReady) {
+            eventsForTaskLevel.push_back(eventWaitList[i]);
+            continue;
+        }
+        // blocked enqueue on other queue is not submitted yet, only host can resolve such dependency,
+        // predicate register holds status of single user event
+        if (!event->isUserEvent() || userEvent != nullptr) {
+            return nullptr;
+        }
+        userEvent = static_cast<UserEvent *>(event);
+    }
+    if (userEvent == nullptr || !userEvent->prepareForGpuWait(getGpgpuCommandStreamReceiver(), outEvent)) {
+        return nullptr;
+    }
+    return userEvent;
+}
+
+void CommandQueue::trackAuxTranslations(const Kernel &kernel, const MemObjsForAuxTranslation &kernelMemObjs, bool deferCompression,
+                                        TrackedAuxTranslations &translations) {
+    for (auto memObj : memObjsLeftNonAux) {
+        if (kernelMemObjs.find(memObj) != kernelMemObjs.end()) {
+            // still resolved after previous enqueue, compression and resolve in between are skipped
+            if (deferCompression) {
+                translations.leftNonAux.insert(memObj);
+            } else {
+                translations.compressAfterKernel.insert(memObj);
+                translations.memObjsToRelease.push_back(memObj);
+            }
+        } else if (memObj->getRefApiCount() == 0) {
+            // released by application, nothing can read it in aux mode anymore
+            translations.memObjsToRelease.push_back(memObj);
+        } else if (kernel.isMemObjAllocationUsed(memObj->getGraphicsAllocation())) {
+            translations.compressBeforeKernel.insert(memObj);
+            translations.memObjsToRelease.push_back(memObj);
+        } else if (deferCompression) {
+            translations.leftNonAux.insert(memObj);
+        } else {
+            // completion of this enqueue can be observed, all buffers have to be back in aux state by then
+            translations.compressAfterKernel.insert(memObj);
+            translations.memObjsToRelease.push_back(memObj);
+        }
+    }
+    memObjsLeftNonAux.clear();
+
+    for (auto memObj : kernelMemObjs) {
+        if (translations.leftNonAux.count(memObj) > 0 || translations.compressAfterKernel.count(memObj) > 0) {
+            continue;
+        }
+        translations.resolveBeforeKernel.insert(memObj);
+        if (deferCompression) {
+            memObj->incRefInternal();
+            translations.leftNonAux.insert(memObj);
+        } else {
+            translations.compressAfterKernel.insert(memObj);
+        }
+    }
+
+    for (auto memObjs : {&translations.compressBeforeKernel, &translations.resolveBeforeKernel, &translations.compressAfterKernel}) {
+        translations.allMemObjs.insert(memObjs->begin(), memObjs->end());
+        auxTranslationCounters.translationsDispatched += memObjs->size();
+    }
+    auxTranslationCounters.translationsRequired += 2 * kernelMemObjs.size();
+}
+
+void CommandQueue::completeTrackedAuxTranslations(TrackedAuxTranslations &translations) {
+    memObjsLeftNonAux = std::move(translations.leftNonAux);
+    for (auto memObj : translations.memObjsToRelease) {
+        memObj->decRefInternal();
+    }
+    translations.memObjsToRelease.clear();
+}
+
+bool CommandQueue::isGraphCaptureAllowed(uint32_t commandType, bool blocking, bool blockedQueue, const EventsRequest &eventsRequest,
+                                         const MultiDispatchInfo &multiDispatchInfo) const {
+    if ((commandType != CL_COMMAND_NDRANGE_KERNEL && commandType != CL_COMMAND_TASK) || blocking || blockedQueue) {
+        return false;
+    }
+    if (eventsRequest.numEventsInWaitList > 0 || eventsRequest.outEvent) {
+        return false;
+    }
+    auto memObjsForAuxTranslation = multiDispatchInfo.getMemObjsForAuxTranslation();
+    if (multiDispatchInfo.peekParentKernel() || (memObjsForAuxTranslation && memObjsForAuxTranslation->size() > 0)) {
+        return false;
+    }
+    for (auto &dispatchInfo : multiDispatchInfo) {
+        auto kernel = dispatchInfo.getKernel();
+        if (kernel->hasPrintfOutput() || kernel->usesSyncBuffer()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+cl_int CommandQueue::beginGraphCapture() {
+    TakeOwnershipWrapper<CommandQueue> queueOwnership(*this);
+    if (graphCaptureActive) {
+        return CL_INVALID_OPERATION;
+    }
+    if (isOOQEnabled()) {
+        return CL_INVALID_COMMAND_QUEUE;
+    }
+
+    graphCaptureActive = true;
+    graphCaptureStatus = CL_SUCCESS;
+    // captured enqueues must not depend on work submitted before the capture, it is not part of the graph
+    if (timestampPacketContainer) {
+        timestampPacketNodesBeforeCapture.swapNodes(*timestampPacketContainer);
+    }
+    return CL_SUCCESS;
+}
+
+void CommandQueue::restoreTimestampPacketNodesAfterCapture() {
+    // nodes of captured enqueues are kept by the graph, following enqueues depend on work submitted before the capture again
+    if (timestampPacketContainer) {
+        timestampPacketContainer->swapNodes(timestampPacketNodesBeforeCapture);
+        timestampPacketNodesBeforeCapture.resolveDependencies(true);
+    }
+}
+
+CommandGraph *CommandQueue::abortGraphCapture() {
+    graphCaptureStatus = CL_INVALID_OPERATION;
+    restoreTimestampPacketNodesAfterCapture();
+    if (capturedGraphNodes.empty()) {
+        return nullptr;
+    }
+
+    // enqueues captured so far were already accepted, they are submitted ahead of the enqueue which aborted capture
+    auto capturedGraph = new CommandGraph(*this, std::move(capturedGraphNodes));
+    capturedGraphNodes.clear();
+    auto completionStamp = capturedGraph->replay(taskLevel);
+    getGpgpuCommandStreamReceiver().requestStallingPipeControlOnNextFlush();
+    updateFromCompletionStamp(completionStamp);
+    return capturedGraph;
+}
+
+CommandGraph *CommandQueue::endGraphCapture(cl_int &errcodeRet) {
+    TakeOwnershipWrapper<CommandQueue> queueOwnership(*this);
+    if (!graphCaptureActive) {
+        errcodeRet = CL_INVALID_OPERATION;
+        return nullptr;
+    }
+
+    if (graphCaptureStatus == CL_SUCCESS) {
+        restoreTimestampPacketNodesAfterCapture();
+    }
+    errcodeRet = graphCaptureStatus;
+    graphCaptureActive = false;
+    graphCaptureStatus = CL_SUCCESS;
+
+    if (errcodeRet != CL_SUCCESS) {
+        return nullptr;
+    }
+    return new CommandGraph(*this, std::move(capturedGraphNodes));
+}
+
+void CommandQueue::captureEnqueueToGraph(uint32_t commandType, Surface **surfaces, size_t surfaceCount, const MultiDispatchInfo &multiDispatchInfo,
+                                         std::unique_ptr<KernelOperation> &blockedCommandsData) {
+    auto node = std::make_unique<CommandGraphNode>(*multiDispatchInfo.peekMainKernel());
+    node->commandStreamSize = blockedCommandsData->commandStream->getUsed();
+    node->kernelOperation = std::move(blockedCommandsData);
+
+    Kernel *kernel = nullptr;
+    for (auto &dispatchInfo : multiDispatchInfo) {
+        if (kernel != dispatchInfo.getKernel()) {
+            kernel = dispatchInfo.getKernel();
+        } else {
+            continue;
+        }
+        kernel->getResidency(node->surfaces);
+    }
+    for (auto &surface : CreateRange(surfaces, surfaceCount)) {
+        node->surfaces.push_back(surface->duplicate());
+    }
+    if (timestampPacketContainer) {
+        node->timestampPacketNodes.assignAndIncrementNodesRefCounts(*timestampPacketContainer);
+    }
+
+    node->preemptionMode = PreemptionHelper::taskPreemptionMode(getDevice(), multiDispatchInfo);
+    node->requiredScratchSize = multiDispatchInfo.getRequiredScratchSize();
+    node->requiredPrivateScratchSize = multiDispatchInfo.getRequiredPrivateScratchSize();
+    node->dcFlush = shouldFlushDC(commandType, nullptr);
+    node->slmUsed = multiDispatchInfo.usesSlm();
+    node->ndRangeKernel = (commandType == CL_COMMAND_NDRANGE_KERNEL);
+    capturedGraphNodes.push_back(std::move(node));
+}
+
+cl_int CommandQueue::enqueueCommandGraph(CommandGraph &commandGraph, cl_event *event) {
+    if (&commandGraph.getCommandQueue() != this) {
+        return CL_INVALID_COMMAND_QUEUE;
+    }
+
+    auto commandStreamReceiverOwnership = getGpgpuCommandStreamReceiver().obtainUniqueOwnership();
+    TakeOwnershipWrapper<CommandQueue> queueOwnership(*this);
+    if (graphCaptureActive || isQueueBlocked()) {
+        return CL_INVALID_OPERATION;
+    }
+
+    EventBuilder eventBuilder;
+    if (event) {
+        eventBuilder.create<Event>(this, CL_COMMAND_COMMAND_GRAPH_INTEL, CompletionStamp::levelNotReady, 0);
+        *event = eventBuilder.getEvent();
+        if (eventBuilder.getEvent()->isProfilingEnabled()) {
+            eventBuilder.getEvent()->setCPUProfilingPath(true);
+            eventBuilder.getEvent()->setQueueTimeStamp();
+        }
+    }
+
+    auto completionStamp = commandGraph.replay(taskLevel);
+    // work enqueued after the graph does not wait for timestamp packets written by the graph
+    getGpgpuCommandStreamReceiver().requestStallingPipeControlOnNextFlush();
+    updateFromCompletionStamp(completionStamp);
+
+    if (eventBuilder.getEvent()) {
+        if (eventBuilder.getEvent()->isProfilingEnabled()) {
+            eventBuilder.getEvent()->setSubmitTimeStamp();
+            eventBuilder.getEvent()->setStartTimeStamp();
+        }
+        eventBuilder.getEvent()->flushStamp->replaceStampObject(this->flushStamp->getStampReference());
+        eventBuilder.getEvent()->updateCompletionStamp(completionStamp.taskCount, completionStamp.taskLevel, completionStamp.flushStamp);
+    }
+    return CL_SUCCESS;
+}
+
 bool CommandQueue::blitEnqueueAllowed(cl_command_type cmdType) const {
     bool blitAllowed = device->getHardwareInfo().capabilityTable.blitterOperationsSupported;
 
@@ -6,6 +6,7 @@
  */
 
 #pragma once
+#include "shared/source/built_ins/built_in_ops_base.h"
 #include "shared/source/helpers/engine_control.h"
 
 #include "opencl/source/event/event.h"
@@ -15,10 +16,13 @@
 
 #include <atomic>
 #include <cstdint>
+#include <mutex>
 
 namespace NEO {
 class BarrierCommand;
 class Buffer;
+class BuiltinDispatchInfoBuilder;
+class CommandGraph;
 class LinearStream;
 class ClDevice;
 class Context;
@@ -31,6 +35,8 @@ class IndirectHeap;
 class Kernel;
 class MemObj;
 class PerformanceCounters;
+class UserEvent;
+struct CommandGraphNode;
 struct CompletionStamp;
 struct DispatchGlobalsArgs;
 struct MultiDispatchInfo;
@@ -227,6 +233,12 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
     Context *getContextPtr() const { return context; }
     EngineControl &getGpgpuEngine() const { return *gpgpuEngine; }
 
+    // Returned builder stays valid while the pointer is held, also when the shard is recloned by another thread
+    std::shared_ptr<BuiltinDispatchInfoBuilder> getBuiltinDispatchInfoBuilder(EBuiltInOps::Type operation);
+    static constexpr uint32_t defaultBuiltinShardsCount = 4u;
+    static constexpr uint32_t maxBuiltinShardsCount = 16u;
+    static uint32_t getBuiltinShardIndex();
+
     MOCKABLE_VIRTUAL LinearStream &getCS(size_t minRequiredSize);
     IndirectHeap &getIndirectHeap(IndirectHeap::Type heapType,
                                   size_t minRequiredSize);
@@ -292,6 +304,21 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
 
     void updateBcsTaskCount(uint32_t newBcsTaskCount) { this->bcsTaskCount = newBcsTaskCount; }
 
+    // Kernel enqueues between begin and end of capture are recorded into command graph instead of being submitted
+    cl_int beginGraphCapture();
+    CommandGraph *endGraphCapture(cl_int &errcodeRet);
+    bool isCapturingGraph() const { return graphCaptureActive && graphCaptureStatus == CL_SUCCESS; }
+    cl_int enqueueCommandGraph(CommandGraph &commandGraph, cl_event *event);
+
+    // Buffers resolved for kernel are left in non-aux state while following enqueues access them the same way
+    struct AuxTranslationCounters {
+        uint64_t translationsRequired = 0u;
+        uint64_t translationsDispatched = 0u;
+    };
+    const AuxTranslationCounters &getAuxTranslationCounters() const { return auxTranslationCounters; }
+    // Compresses buffers left in non-aux state, needed before anything else than tracked kernel enqueue accesses them
+    virtual void flushPendingAuxTranslations() {}
+
     // taskCount of last task
     uint32_t taskCount = 0;
 
@@ -325,6 +352,28 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
                               cl_uint numEventsInWaitList, const cl_event *eventWaitList);
     void providePerformanceHint(TransferProperties &transferProperties);
     bool queueDependenciesClearRequired() const;
+    // Returns user event waited on GPU by this enqueue, walkers of the enqueue are predicated on its status
+    UserEvent *prepareUserEventsForGpuWait(uint32_t commandType, const MultiDispatchInfo &multiDispatchInfo, cl_uint numEventsInWaitList,
+                                           const cl_event *eventWaitList, Event *outEvent, std::vector<cl_event> &eventsForTaskLevel);
+    bool isGraphCaptureAllowed(uint32_t commandType, bool blocking, bool blockedQueue, const EventsRequest &eventsRequest,
+                               const MultiDispatchInfo &multiDispatchInfo) const;
+    // Returns graph with submitted captured enqueues, it has to be released once queue ownership is dropped
+    CommandGraph *abortGraphCapture();
+    void restoreTimestampPacketNodesAfterCapture();
+    void captureEnqueueToGraph(uint32_t commandType, Surface **surfaces, size_t surfaceCount, const MultiDispatchInfo &multiDispatchInfo,
+                               std::unique_ptr<KernelOperation> &blockedCommandsData);
+
+    struct TrackedAuxTranslations {
+        MemObjsForAuxTranslation compressBeforeKernel;
+        MemObjsForAuxTranslation resolveBeforeKernel;
+        MemObjsForAuxTranslation compressAfterKernel;
+        MemObjsForAuxTranslation allMemObjs;
+        MemObjsForAuxTranslation leftNonAux;
+        std::vector<MemObj *> memObjsToRelease;
+    };
+    void trackAuxTranslations(const Kernel &kernel, const MemObjsForAuxTranslation &kernelMemObjs, bool deferCompression,
+                              TrackedAuxTranslations &translations);
+    void completeTrackedAuxTranslations(TrackedAuxTranslations &translations);
     bool blitEnqueueAllowed(cl_command_type cmdType) const;
     void aubCaptureHook(bool &blocking, bool &clearAllDependencies, const MultiDispatchInfo &multiDispatchInfo);
     virtual bool obtainTimestampPacketForCacheFlush(bool isCacheFlushRequired) const = 0;
@@ -349,6 +398,24 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
     bool requiresCacheFlushAfterWalker = false;
 
     std::unique_ptr<TimestampPacketContainer> timestampPacketContainer;
+
+    // Threads enqueueing to the same queue are spread round-robin over shards, each shard owns its own builtin kernels,
+    // so builtin argument setup and dispatch building of one thread does not wait for enqueues of other threads
+    struct QueueBuiltinDispatchInfoBuilder {
+        const BuiltinDispatchInfoBuilder *sources[maxBuiltinShardsCount] = {};
+        std::shared_ptr<BuiltinDispatchInfoBuilder> builders[maxBuiltinShardsCount];
+    };
+    QueueBuiltinDispatchInfoBuilder builtinDispatchInfoBuilders[EBuiltInOps::COUNT];
+    std::mutex builtinDispatchInfoBuildersMutex;
+
+    bool graphCaptureActive = false;
+    cl_int graphCaptureStatus = CL_SUCCESS;
+    std::vector<std::unique_ptr<CommandGraphNode>> capturedGraphNodes;
+    TimestampPacketContainer timestampPacketNodesBeforeCapture;
+
+    std::recursive_mutex auxTranslationsMutex;
+    MemObjsForAuxTranslation memObjsLeftNonAux;
+    AuxTranslationCounters auxTranslationCounters;
 };
 
 using CommandQueueCreateFunc = CommandQueue *(*)(Context *context, ClDevice *device, const cl_queue_properties *properties, bool internalUsage);
@@ -310,6 +310,7 @@ class CommandQueueHw : public CommandQueue {
                                       const cl_event *eventWaitList,
                                       cl_event *event) override;
     cl_int flush() override;
+    void flushPendingAuxTranslations() override;
 
     template <uint32_t enqueueType>
     void enqueueHandler(Surface **surfacesForResidency,
@@ -410,6 +411,9 @@ class CommandQueueHw : public CommandQueue {
                                               const cl_event *eventWaitList, cl_event *event);
 
     MOCKABLE_VIRTUAL void dispatchAuxTranslationBuiltin(MultiDispatchInfo &multiDispatchInfo, AuxTranslationDirection auxTranslationDirection);
+    void dispatchAuxTranslationBuiltin(MultiDispatchInfo &multiDispatchInfo, AuxTranslationDirection auxTranslationDirection,
+                                       const MemObjsForAuxTranslation &memObjsForAuxTranslation, size_t firstKernelInstance);
+    bool isAuxTranslationTrackingEnabled() const;
     void setupBlitAuxTranslation(MultiDispatchInfo &multiDispatchInfo);
 
     MOCKABLE_VIRTUAL bool forceStateless(size_t size);
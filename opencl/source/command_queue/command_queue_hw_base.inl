@@ -118,6 +118,62 @@ void CommandQueueHw<Family>::dispatchAuxTranslationBuiltin(MultiDispatchInfo &mu
     auxTranslationBuilder.buildDispatchInfosForAuxTranslation<Family>(multiDispatchInfo, dispatchParams);
 }
 
+template <typename Family>
+void CommandQueueHw<Family>::dispatchAuxTranslationBuiltin(MultiDispatchInfo &multiDispatchInfo, AuxTranslationDirection auxTranslationDirection,
+                                                           const MemObjsForAuxTranslation &memObjsForAuxTranslation, size_t firstKernelInstance) {
+    if (memObjsForAuxTranslation.empty()) {
+        return;
+    }
+
+    auto &builder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(EBuiltInOps::AuxTranslation, getDevice());
+    auto &auxTranslationBuilder = static_cast<BuiltInOp<EBuiltInOps::AuxTranslation> &>(builder);
+    BuiltinOpParams dispatchParams;
+
+    dispatchParams.auxTranslationDirection = auxTranslationDirection;
+
+    auxTranslationBuilder.buildDispatchInfosForAuxTranslation<Family>(multiDispatchInfo, dispatchParams, memObjsForAuxTranslation, firstKernelInstance);
+}
+
+template <typename Family>
+bool CommandQueueHw<Family>::isAuxTranslationTrackingEnabled() const {
+    return DebugManager.flags.EnableAuxTranslationTracking.get() == 1 &&
+           HwHelperHw<Family>::getAuxTranslationMode() == AuxTranslationMode::Builtin;
+}
+
+template <typename Family>
+void CommandQueueHw<Family>::flushPendingAuxTranslations() {
+    if (!isAuxTranslationTrackingEnabled()) {
+        return;
+    }
+
+    std::lock_guard<std::recursive_mutex> lock(auxTranslationsMutex);
+    if (memObjsLeftNonAux.empty()) {
+        return;
+    }
+
+    TrackedAuxTranslations translations;
+    for (auto memObj : memObjsLeftNonAux) {
+        if (memObj->getRefApiCount() > 0) {
+            translations.compressAfterKernel.insert(memObj);
+        }
+        translations.memObjsToRelease.push_back(memObj);
+    }
+    memObjsLeftNonAux.clear();
+
+    if (!translations.compressAfterKernel.empty()) {
+        auto &builder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(EBuiltInOps::AuxTranslation, getDevice());
+        BuiltInOwnershipWrapper builtInLock(builder, this->context);
+
+        MultiDispatchInfo multiDispatchInfo;
+        multiDispatchInfo.setMemObjsForAuxTranslation(translations.compressAfterKernel);
+        dispatchAuxTranslationBuiltin(multiDispatchInfo, AuxTranslationDirection::NonAuxToAux, translations.compressAfterKernel, 0u);
+        auxTranslationCounters.translationsDispatched += translations.compressAfterKernel.size();
+
+        enqueueHandler<CL_COMMAND_NDRANGE_KERNEL>(nullptr, 0u, false, multiDispatchInfo, 0, nullptr, nullptr);
+    }
+    completeTrackedAuxTranslations(translations);
+}
+
 template <typename Family>
 bool CommandQueueHw<Family>::forceStateless(size_t size) {
     return size >= 4ull * MemoryConstants::gigaByte;
@@ -13,6 +13,7 @@
 #include "opencl/source/context/context.h"
 #include "opencl/source/event/event.h"
 #include "opencl/source/event/event_builder.h"
+#include "opencl/source/helpers/cpu_copy.h"
 #include "opencl/source/helpers/mipmap.h"
 #include "opencl/source/mem_obj/buffer.h"
 #include "opencl/source/mem_obj/image.h"
@@ -129,11 +130,11 @@ void *CommandQueue::cpuDataTransferHandler(TransferProperties &transferPropertie
             }
             break;
         case CL_COMMAND_READ_BUFFER:
-            memcpy_s(transferProperties.ptr, transferProperties.size[0], transferProperties.getCpuPtrForReadWrite(), transferProperties.size[0]);
+            CpuCopyHelper::copy(transferProperties.ptr, transferProperties.getCpuPtrForReadWrite(), transferProperties.size[0]);
             eventCompleted = true;
             break;
         case CL_COMMAND_WRITE_BUFFER:
-            memcpy_s(transferProperties.getCpuPtrForReadWrite(), transferProperties.size[0], transferProperties.ptr, transferProperties.size[0]);
+            CpuCopyHelper::copy(transferProperties.getCpuPtrForReadWrite(), transferProperties.ptr, transferProperties.size[0]);
             eventCompleted = true;
             modifySimulationFlags = true;
             break;
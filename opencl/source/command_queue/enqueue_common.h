@@ -20,6 +20,7 @@
 
 #include "opencl/source/built_ins/builtins_dispatch_builder.h"
 #include "opencl/source/builtin_kernels_simulation/scheduler_simulation.h"
+#include "opencl/source/command_queue/command_graph.h"
 #include "opencl/source/command_queue/command_queue_hw.h"
 #include "opencl/source/command_queue/gpgpu_walker.h"
 #include "opencl/source/command_queue/hardware_interface.h"
@@ -58,10 +59,28 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface *(&surfaces)[surfaceCount
     MemObjsForAuxTranslation memObjsForAuxTranslation;
     MultiDispatchInfo multiDispatchInfo(kernel);
 
+    std::unique_lock<std::recursive_mutex> auxTranslationsLock;
+    TrackedAuxTranslations trackedAuxTranslations;
+    bool auxTranslationsTracked = isAuxTranslationTrackingEnabled() && !kernel->isParentKernel &&
+                                !DebugManager.flags.ForceDispatchScheduler.get();
+
     if (DebugManager.flags.ForceDispatchScheduler.get()) {
         forceDispatchScheduler(multiDispatchInfo);
     } else {
-        if (kernel->isAuxTranslationRequired()) {
+        if (auxTranslationsTracked) {
+            auxTranslationsLock = std::unique_lock<std::recursive_mutex>(auxTranslationsMutex);
+            if (kernel->isAuxTranslationRequired()) {
+                kernel->fillWithBuffersForAuxTranslation(memObjsForAuxTranslation);
+            }
+            trackAuxTranslations(*kernel, memObjsForAuxTranslation, (event == nullptr) && !blocking, trackedAuxTranslations);
+            multiDispatchInfo.setMemObjsForAuxTranslation(trackedAuxTranslations.allMemObjs);
+            if (!trackedAuxTranslations.allMemObjs.empty()) {
+                auto &builder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(EBuiltInOps::AuxTranslation, getDevice());
+                builtInLock.takeOwnership(builder, this->context);
+                dispatchAuxTranslationBuiltin(multiDispatchInfo, AuxTranslationDirection::NonAuxToAux, trackedAuxTranslations.compressBeforeKernel, 0u);
+                dispatchAuxTranslationBuiltin(multiDispatchInfo, AuxTranslationDirection::AuxToNonAux, trackedAuxTranslations.resolveBeforeKernel, 0u);
+            }
+        } else if (kernel->isAuxTranslationRequired()) {
             auto &builder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(EBuiltInOps::AuxTranslation, getDevice());
             builtInLock.takeOwnership(builder, this->context);
             kernel->fillWithBuffersForAuxTranslation(memObjsForAuxTranslation);
@@ -81,10 +100,16 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface *(&surfaces)[surfaceCount
             builder->buildDispatchInfos(multiDispatchInfo, kernel, workDim, workItems, enqueuedWorkSizes, globalOffsets);
 
             if (multiDispatchInfo.size() == 0) {
+                if (auxTranslationsTracked) {
+                    completeTrackedAuxTranslations(trackedAuxTranslations);
+                }
                 return;
             }
         }
-        if (kernel->isAuxTranslationRequired()) {
+        if (auxTranslationsTracked) {
+            dispatchAuxTranslationBuiltin(multiDispatchInfo, AuxTranslationDirection::NonAuxToAux, trackedAuxTranslations.compressAfterKernel,
+                                          trackedAuxTranslations.compressBeforeKernel.size());
+        } else if (kernel->isAuxTranslationRequired()) {
             if (!memObjsForAuxTranslation.empty()) {
                 UNRECOVERABLE_IF(kernel->isParentKernel);
                 dispatchAuxTranslationBuiltin(multiDispatchInfo, AuxTranslationDirection::NonAuxToAux);
@@ -97,6 +122,10 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface *(&surfaces)[surfaceCount
     }
 
     enqueueHandler<commandType>(surfaces, blocking, multiDispatchInfo, numEventsInWaitList, eventWaitList, event);
+
+    if (auxTranslationsTracked) {
+        completeTrackedAuxTranslations(trackedAuxTranslations);
+    }
 }
 
 template <typename GfxFamily>
@@ -133,6 +162,8 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface **surfacesForResidency,
                                                cl_uint numEventsInWaitList,
                                                const cl_event *eventWaitList,
                                                cl_event *event) {
+    flushPendingAuxTranslations();
+
     if (multiDispatchInfo.empty() && !isCommandWithoutKernel(commandType)) {
         enqueueHandler<CL_COMMAND_MARKER>(surfacesForResidency, numSurfaceForResidency, blocking, multiDispatchInfo,
                                           numEventsInWaitList, eventWaitList, event);
@@ -149,8 +180,6 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface **surfacesForResidency,
 
     TagNode<HwTimeStamps> *hwTimeStamps = nullptr;
 
-    auto commandStreamRecieverOwnership = getGpgpuCommandStreamReceiver().obtainUniqueOwnership();
-
     TimeStampData queueTimeStamp;
     if (isProfilingEnabled() && event) {
         this->getDevice().getOSTime()->getCpuGpuTime(&queueTimeStamp);
@@ -169,14 +198,42 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface **surfacesForResidency,
         DBG_LOG(EventsDebugEnable, "enqueueHandler commandType", commandType, "output Event", eventBuilder.getEvent());
     }
 
+    // Prepare phase runs without CSR and queue ownership, it only touches this enqueue's dispatch infos and event.
+    // Kernel patching, printf setup, heaps and command stream programming mutate shared state and stay in the serialized commit phase.
+    for (auto &dispatchInfo : multiDispatchInfo) {
+        if (dispatchInfo.getLocalWorkgroupSize().x == 0) {
+            const auto lws = generateWorkgroupSize(dispatchInfo);
+            const_cast<DispatchInfo &>(dispatchInfo).setLWS(lws);
+        }
+    }
+    bool blitEnqueue = blitEnqueueAllowed(commandType);
+    bool enqueueWithBlitAuxTranslation = HwHelperHw<GfxFamily>::isBlitAuxTranslationRequired(device->getHardwareInfo(), multiDispatchInfo);
+    size_t timestampPacketNodesCount = 0u;
+    if (blitEnqueue || isCacheFlushCommand(commandType)) {
+        timestampPacketNodesCount = 1;
+    } else if (!multiDispatchInfo.empty()) {
+        timestampPacketNodesCount = estimateTimestampPacketNodesCount(multiDispatchInfo);
+    }
+
+    auto commandStreamRecieverOwnership = getGpgpuCommandStreamReceiver().obtainUniqueOwnership();
+
     std::unique_ptr<KernelOperation> blockedCommandsData;
     std::unique_ptr<PrintfHandler> printfHandler;
     TakeOwnershipWrapper<CommandQueueHw<GfxFamily>> queueOwnership(*this);
 
     auto blockQueue = false;
     auto taskLevel = 0u;
-    obtainTaskLevelAndBlockedStatus(taskLevel, numEventsInWaitList, eventWaitList, blockQueue, commandType);
-    bool blitEnqueue = blitEnqueueAllowed(commandType);
+    std::vector<cl_event> eventsForTaskLevel;
+    auto gpuWaitUserEvent = prepareUserEventsForGpuWait(commandType, multiDispatchInfo, numEventsInWaitList, eventWaitList,
+                                                        eventBuilder.getEvent(), eventsForTaskLevel);
+    if (gpuWaitUserEvent) {
+        // user events are resolved with semaphores programmed from csr dependencies, they don't block the queue
+        cl_uint numEventsForTaskLevel = static_cast<cl_uint>(eventsForTaskLevel.size());
+        const cl_event *eventsForTaskLevelList = eventsForTaskLevel.empty() ? nullptr : eventsForTaskLevel.data();
+        obtainTaskLevelAndBlockedStatus(taskLevel, numEventsForTaskLevel, eventsForTaskLevelList, blockQueue, commandType);
+    } else {
+        obtainTaskLevelAndBlockedStatus(taskLevel, numEventsInWaitList, eventWaitList, blockQueue, commandType);
+    }
 
     DBG_LOG(EventsDebugEnable, "blockQueue", blockQueue, "virtualEvent", virtualEvent, "taskLevel", taskLevel);
 
@@ -198,19 +255,25 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface **surfacesForResidency,
     CsrDependencies csrDeps;
     BlitPropertiesContainer blitPropertiesContainer;
 
-    bool enqueueWithBlitAuxTranslation = HwHelperHw<GfxFamily>::isBlitAuxTranslationRequired(device->getHardwareInfo(), multiDispatchInfo);
+    bool captureEnqueue = false;
+    CommandGraph *abortedCaptureGraph = nullptr;
+    if (isCapturingGraph()) {
+        captureEnqueue = isGraphCaptureAllowed(commandType, blocking, blockQueue, eventsRequest, multiDispatchInfo);
+        if (!captureEnqueue) {
+            abortedCaptureGraph = abortGraphCapture();
+            taskLevel = std::max(taskLevel, this->taskLevel);
+        }
+    }
+    if (captureEnqueue) {
+        // captured enqueue gets its own command buffer and heaps, the same way as enqueue on blocked queue
+        blockQueue = true;
+        clearAllDependencies = true;
+    }
 
     if (getGpgpuCommandStreamReceiver().peekTimestampPacketWriteEnabled()) {
         eventsRequest.fillCsrDependencies(csrDeps, getGpgpuCommandStreamReceiver(), CsrDependencies::DependenciesType::OnCsr);
         auto allocator = getGpgpuCommandStreamReceiver().getTimestampPacketAllocator();
 
-        size_t nodesCount = 0u;
-        if (blitEnqueue || isCacheFlushCommand(commandType)) {
-            nodesCount = 1;
-        } else if (!multiDispatchInfo.empty()) {
-            nodesCount = estimateTimestampPacketNodesCount(multiDispatchInfo);
-        }
-
         if (isCacheFlushForBcsRequired() && (blitEnqueue || enqueueWithBlitAuxTranslation)) {
             timestampPacketDependencies.cacheFlushNodes.add(allocator->getTag());
         }
@@ -219,17 +282,21 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface **surfacesForResidency,
             timestampPacketDependencies.barrierNodes.add(allocator->getTag());
         }
 
-        if (nodesCount > 0) {
-            obtainNewTimestampPacketNodes(nodesCount, timestampPacketDependencies.previousEnqueueNodes, clearAllDependencies);
+        if (timestampPacketNodesCount > 0) {
+            obtainNewTimestampPacketNodes(timestampPacketNodesCount, timestampPacketDependencies.previousEnqueueNodes, clearAllDependencies);
             csrDeps.push_back(&timestampPacketDependencies.previousEnqueueNodes);
         }
+
+        if (gpuWaitUserEvent) {
+            csrDeps.dispatchPredicateNodes = gpuWaitUserEvent->getTimestampPacketNodes();
+        }
     }
 
     auto &commandStream = *obtainCommandStream<commandType>(csrDeps, blitEnqueue, blockQueue, multiDispatchInfo, eventsRequest,
                                                             blockedCommandsData, surfacesForResidency, numSurfaceForResidency);
     auto commandStreamStart = commandStream.getUsed();
 
-    if (HwHelperHw<GfxFamily>::isBlitAuxTranslationRequired(device->getHardwareInfo(), multiDispatchInfo)) {
+    if (enqueueWithBlitAuxTranslation) {
         processDispatchForBlitAuxTranslation(multiDispatchInfo, blitPropertiesContainer, timestampPacketDependencies,
                                              eventsRequest, blockQueue);
     }
@@ -343,14 +410,18 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface **surfacesForResidency,
             eventBuilder.getEvent()->flushStamp->replaceStampObject(this->flushStamp->getStampReference());
         }
     }
-    updateFromCompletionStamp(completionStamp);
+    if (!captureEnqueue) {
+        updateFromCompletionStamp(completionStamp);
+    }
 
     if (eventBuilder.getEvent()) {
         eventBuilder.getEvent()->updateCompletionStamp(completionStamp.taskCount, completionStamp.taskLevel, completionStamp.flushStamp);
         FileLoggerInstance().log(DebugManager.flags.EventsDebugEnable.get(), "updateCompletionStamp Event", eventBuilder.getEvent(), "taskLevel", eventBuilder.getEvent()->taskLevel.load());
     }
 
-    if (blockQueue) {
+    if (captureEnqueue) {
+        captureEnqueueToGraph(commandType, surfacesForResidency, numSurfaceForResidency, multiDispatchInfo, blockedCommandsData);
+    } else if (blockQueue) {
         if (parentKernel) {
             size_t minSizeSSHForEM = HardwareCommandsHelper<GfxFamily>::getSshSizeForExecutionModel(*parentKernel);
             blockedCommandsData->surfaceStateHeapSizeEM = minSizeSSHForEM;
@@ -371,6 +442,11 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface **surfacesForResidency,
     queueOwnership.unlock();
     commandStreamRecieverOwnership.unlock();
 
+    if (abortedCaptureGraph) {
+        // waits for captured enqueues to complete before their heaps are returned for reuse
+        abortedCaptureGraph->release();
+    }
+
     if (blocking) {
         if (blockQueue) {
             while (isQueueBlocked()) {
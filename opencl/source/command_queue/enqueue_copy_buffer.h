@@ -37,8 +37,8 @@ cl_int CommandQueueHw<GfxFamily>::enqueueCopyBuffer(
         eBuiltInOpsType = EBuiltInOps::CopyBufferToBufferStateless;
     }
 
-    auto &builder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(eBuiltInOpsType,
-                                                                            this->getDevice());
+    auto builderPtr = this->getBuiltinDispatchInfoBuilder(eBuiltInOpsType);
+    auto &builder = *builderPtr;
 
     BuiltInOwnershipWrapper builtInLock(builder, this->context);
 
@@ -38,8 +38,8 @@ cl_int CommandQueueHw<GfxFamily>::enqueueCopyBufferRect(
         eBuiltInOps = EBuiltInOps::CopyBufferRectStateless;
     }
 
-    auto &builder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(eBuiltInOps,
-                                                                            this->getDevice());
+    auto builderPtr = this->getBuiltinDispatchInfoBuilder(eBuiltInOps);
+    auto &builder = *builderPtr;
     BuiltInOwnershipWrapper builtInLock(builder, this->context);
 
     MemObjSurface srcBufferSurf(srcBuffer);
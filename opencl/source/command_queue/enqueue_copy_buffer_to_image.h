@@ -36,8 +36,8 @@ cl_int CommandQueueHw<GfxFamily>::enqueueCopyBufferToImage(
         eBuiltInOpsType = EBuiltInOps::CopyBufferToImage3dStateless;
     }
 
-    auto &builder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(eBuiltInOpsType,
-                                                                            this->getDevice());
+    auto builderPtr = this->getBuiltinDispatchInfoBuilder(eBuiltInOpsType);
+    auto &builder = *builderPtr;
     BuiltInOwnershipWrapper builtInLock(builder, this->context);
 
     MemObjSurface srcBufferSurf(srcBuffer);
@@ -35,8 +35,8 @@ cl_int CommandQueueHw<GfxFamily>::enqueueCopyImageToBuffer(
     if (forceStateless(dstBuffer->getSize())) {
         eBuiltInOpsType = EBuiltInOps::CopyImage3dToBufferStateless;
     }
-    auto &builder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(eBuiltInOpsType,
-                                                                            this->getDevice());
+    auto builderPtr = this->getBuiltinDispatchInfoBuilder(eBuiltInOpsType);
+    auto &builder = *builderPtr;
     BuiltInOwnershipWrapper builtInLock(builder, this->context);
 
     MemObjSurface srcImgSurf(srcImage);
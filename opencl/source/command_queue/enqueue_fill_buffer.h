@@ -50,8 +50,8 @@ cl_int CommandQueueHw<GfxFamily>::enqueueFillBuffer(
         eBuiltInOps = EBuiltInOps::FillBufferStateless;
     }
 
-    auto &builder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(eBuiltInOps,
-                                                                            this->getDevice());
+    auto builderPtr = this->getBuiltinDispatchInfoBuilder(eBuiltInOps);
+    auto &builder = *builderPtr;
 
     BuiltInOwnershipWrapper builtInLock(builder, this->context);
 
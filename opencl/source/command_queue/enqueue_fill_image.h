@@ -32,8 +32,8 @@ cl_int CommandQueueHw<GfxFamily>::enqueueFillImage(
 
     MultiDispatchInfo di;
 
-    auto &builder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(EBuiltInOps::FillImage3d,
-                                                                            this->getDevice());
+    auto builderPtr = this->getBuiltinDispatchInfoBuilder(EBuiltInOps::FillImage3d);
+    auto &builder = *builderPtr;
     BuiltInOwnershipWrapper builtInLock(builder, this->context);
 
     MemObjSurface dstImgSurf(image);
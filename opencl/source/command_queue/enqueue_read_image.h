@@ -55,8 +55,8 @@ cl_int CommandQueueHw<GfxFamily>::enqueueReadImage(
                                                   numEventsInWaitList, eventWaitList, event);
     }
 
-    auto &builder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyImage3dToBuffer,
-                                                                            this->getDevice());
+    auto builderPtr = this->getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyImage3dToBuffer);
+    auto &builder = *builderPtr;
 
     BuiltInOwnershipWrapper builtInLock(builder, this->context);
 
@@ -107,8 +107,8 @@ cl_int CommandQueueHw<GfxFamily>::enqueueSVMMap(cl_bool blockingMap,
         }
 
         MultiDispatchInfo dispatchInfo;
-        auto &builder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyBufferToBuffer,
-                                                                                this->getDevice());
+        auto builderPtr = this->getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyBufferToBuffer);
+        auto &builder = *builderPtr;
         BuiltInOwnershipWrapper builtInLock(builder, this->context);
 
         GeneralSurface dstSurface(svmData->cpuAllocation);
@@ -200,8 +200,8 @@ cl_int CommandQueueHw<GfxFamily>::enqueueSVMUnmap(void *svmPtr,
         svmData->gpuAllocation->setTbxWritable(true, GraphicsAllocation::defaultBank);
 
         MultiDispatchInfo dispatchInfo;
-        auto &builder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyBufferToBuffer,
-                                                                                this->getDevice());
+        auto builderPtr = this->getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyBufferToBuffer);
+        auto &builder = *builderPtr;
         BuiltInOwnershipWrapper builtInLock(builder, this->context);
 
         GeneralSurface dstSurface(svmData->gpuAllocation);
@@ -322,6 +322,22 @@ cl_int CommandQueueHw<GfxFamily>::enqueueSVMMemcpy(cl_bool blockingCopy,
         pageFaultManager->moveAllocationToGpuDomain(reinterpret_cast<void *>(srcSvmData->gpuAllocation->getGpuAddress()));
     }
 
+    auto rootDeviceIndex = getDevice().getRootDeviceIndex();
+    GraphicsAllocation *srcSvmAllocation = nullptr;
+    GraphicsAllocation *dstSvmAllocation = nullptr;
+    if (srcSvmData != nullptr) {
+        srcSvmAllocation = context->getSVMAllocsManager()->obtainGraphicsAllocation(*srcSvmData, rootDeviceIndex);
+        if (srcSvmAllocation == nullptr) {
+            return CL_OUT_OF_RESOURCES;
+        }
+    }
+    if (dstSvmData != nullptr) {
+        dstSvmAllocation = context->getSVMAllocsManager()->obtainGraphicsAllocation(*dstSvmData, rootDeviceIndex);
+        if (dstSvmAllocation == nullptr) {
+            return CL_OUT_OF_RESOURCES;
+        }
+    }
+
     auto isStatelessRequired = false;
     if (srcSvmData != nullptr) {
         isStatelessRequired = forceStateless(srcSvmData->size);
@@ -335,15 +351,15 @@ cl_int CommandQueueHw<GfxFamily>::enqueueSVMMemcpy(cl_bool blockingCopy,
         builtInType = EBuiltInOps::CopyBufferToBufferStateless;
     }
 
-    auto &builder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(builtInType,
-                                                                            this->getDevice());
+    auto builderPtr = this->getBuiltinDispatchInfoBuilder(builtInType);
+    auto &builder = *builderPtr;
     BuiltInOwnershipWrapper builtInLock(builder, this->context);
     MultiDispatchInfo dispatchInfo;
     BuiltinOpParams operationParams;
     Surface *surfaces[2];
 
     if (copyType == SvmToHost) {
-        GeneralSurface srcSvmSurf(srcSvmData->gpuAllocation);
+        GeneralSurface srcSvmSurf(srcSvmAllocation);
         HostPtrSurface dstHostPtrSurf(dstPtr, size);
         if (size != 0) {
             bool status = getGpgpuCommandStreamReceiver().createAllocationForHostSurface(dstHostPtrSurf, true);
@@ -352,7 +368,7 @@ cl_int CommandQueueHw<GfxFamily>::enqueueSVMMemcpy(cl_bool blockingCopy,
             }
             dstPtr = reinterpret_cast<void *>(dstHostPtrSurf.getAllocation()->getGpuAddress());
         }
-        setOperationParams(operationParams, size, srcPtr, srcSvmData->gpuAllocation, dstPtr, dstHostPtrSurf.getAllocation());
+        setOperationParams(operationParams, size, srcPtr, srcSvmAllocation, dstPtr, dstHostPtrSurf.getAllocation());
         surfaces[0] = &srcSvmSurf;
         surfaces[1] = &dstHostPtrSurf;
         builder.buildDispatchInfos(dispatchInfo, operationParams);
@@ -365,7 +381,7 @@ cl_int CommandQueueHw<GfxFamily>::enqueueSVMMemcpy(cl_bool blockingCopy,
             event);
     } else if (copyType == HostToSvm) {
         HostPtrSurface srcHostPtrSurf(const_cast<void *>(srcPtr), size);
-        GeneralSurface dstSvmSurf(dstSvmData->gpuAllocation);
+        GeneralSurface dstSvmSurf(dstSvmAllocation);
         if (size != 0) {
             bool status = getGpgpuCommandStreamReceiver().createAllocationForHostSurface(srcHostPtrSurf, false);
             if (!status) {
@@ -373,7 +389,7 @@ cl_int CommandQueueHw<GfxFamily>::enqueueSVMMemcpy(cl_bool blockingCopy,
             }
             srcPtr = reinterpret_cast<void *>(srcHostPtrSurf.getAllocation()->getGpuAddress());
         }
-        setOperationParams(operationParams, size, srcPtr, srcHostPtrSurf.getAllocation(), dstPtr, dstSvmData->gpuAllocation);
+        setOperationParams(operationParams, size, srcPtr, srcHostPtrSurf.getAllocation(), dstPtr, dstSvmAllocation);
         surfaces[0] = &dstSvmSurf;
         surfaces[1] = &srcHostPtrSurf;
         builder.buildDispatchInfos(dispatchInfo, operationParams);
@@ -385,9 +401,9 @@ cl_int CommandQueueHw<GfxFamily>::enqueueSVMMemcpy(cl_bool blockingCopy,
             eventWaitList,
             event);
     } else if (copyType == SvmToSvm) {
-        GeneralSurface srcSvmSurf(srcSvmData->gpuAllocation);
-        GeneralSurface dstSvmSurf(dstSvmData->gpuAllocation);
-        setOperationParams(operationParams, size, srcPtr, srcSvmData->gpuAllocation, dstPtr, dstSvmData->gpuAllocation);
+        GeneralSurface srcSvmSurf(srcSvmAllocation);
+        GeneralSurface dstSvmSurf(dstSvmAllocation);
+        setOperationParams(operationParams, size, srcPtr, srcSvmAllocation, dstPtr, dstSvmAllocation);
         surfaces[0] = &srcSvmSurf;
         surfaces[1] = &dstSvmSurf;
         builder.buildDispatchInfos(dispatchInfo, operationParams);
@@ -477,8 +493,8 @@ cl_int CommandQueueHw<GfxFamily>::enqueueSVMMemFill(void *svmPtr,
         builtInType = EBuiltInOps::FillBufferStateless;
     }
 
-    auto &builder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(builtInType,
-                                                                            this->getDevice());
+    auto builderPtr = this->getBuiltinDispatchInfoBuilder(builtInType);
+    auto &builder = *builderPtr;
 
     BuiltInOwnershipWrapper builtInLock(builder, this->context);
 
@@ -72,8 +72,8 @@ cl_int CommandQueueHw<GfxFamily>::enqueueWriteBuffer(
     if (forceStateless(buffer->getSize())) {
         eBuiltInOps = EBuiltInOps::CopyBufferToBufferStateless;
     }
-    auto &builder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(eBuiltInOps,
-                                                                            this->getDevice());
+    auto builderPtr = this->getBuiltinDispatchInfoBuilder(eBuiltInOps);
+    auto &builder = *builderPtr;
 
     BuiltInOwnershipWrapper builtInLock(builder, this->context);
 
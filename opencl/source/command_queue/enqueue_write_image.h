@@ -46,8 +46,8 @@ cl_int CommandQueueHw<GfxFamily>::enqueueWriteImage(
         return enqueueMarkerForReadWriteOperation(dstImage, const_cast<void *>(ptr), CL_COMMAND_WRITE_IMAGE, blockingWrite,
                                                   numEventsInWaitList, eventWaitList, event);
     }
-    auto &builder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyBufferToImage3d,
-                                                                            this->getDevice());
+    auto builderPtr = this->getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyBufferToImage3d);
+    auto &builder = *builderPtr;
 
     BuiltInOwnershipWrapper lock(builder, this->context);
 
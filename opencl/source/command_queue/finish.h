@@ -14,6 +14,8 @@ namespace NEO {
 
 template <typename GfxFamily>
 cl_int CommandQueueHw<GfxFamily>::finish() {
+    flushPendingAuxTranslations();
+
     auto result = getGpgpuCommandStreamReceiver().flushBatchedSubmissions();
     if (!result) {
         return CL_OUT_OF_RESOURCES;
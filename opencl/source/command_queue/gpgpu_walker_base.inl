@@ -237,6 +237,9 @@ size_t EnqueueOperation<GfxFamily>::getTotalSizeRequiredCS(uint32_t eventType, c
     if (commandQueue.getGpgpuCommandStreamReceiver().peekTimestampPacketWriteEnabled()) {
         expectedSizeCS += TimestampPacketHelper::getRequiredCmdStreamSize<GfxFamily>(csrDeps);
         expectedSizeCS += EnqueueOperation<GfxFamily>::getSizeRequiredForTimestampPacketWrite();
+        if (csrDeps.dispatchPredicateNodes) {
+            expectedSizeCS += sizeof(typename GfxFamily::MI_LOAD_REGISTER_MEM);
+        }
     }
     return expectedSizeCS;
 }
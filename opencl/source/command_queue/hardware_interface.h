@@ -89,7 +89,8 @@ class HardwareInterface {
         const DispatchInfo &dispatchInfo,
         size_t offsetInterfaceDescriptorTable,
         Vec3<size_t> &numberOfWorkgroups,
-        Vec3<size_t> &startOfWorkgroups);
+        Vec3<size_t> &startOfWorkgroups,
+        bool predicatedDispatch);
 
     static WALKER_TYPE<GfxFamily> *allocateWalkerSpace(LinearStream &commandStream,
                                                        const Kernel &kernel);
@@ -101,7 +102,7 @@ class HardwareInterface {
                                        LinearStream &commandStream, bool isMainKernel, size_t currentDispatchIndex,
                                        TimestampPacketContainer *currentTimestampPacketNodes, PreemptionMode preemptionMode,
                                        uint32_t &interfaceDescriptorIndex, size_t offsetInterfaceDescriptorTable,
-                                       IndirectHeap &dsh, IndirectHeap &ioh, IndirectHeap &ssh);
+                                       IndirectHeap &dsh, IndirectHeap &ioh, IndirectHeap &ssh, bool predicatedDispatch);
 };
 
 } // namespace NEO
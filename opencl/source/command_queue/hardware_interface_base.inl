@@ -6,6 +6,7 @@
  */
 
 #pragma once
+#include "shared/source/helpers/register_offsets.h"
 #include "shared/source/memory_manager/internal_allocation_storage.h"
 
 #include "opencl/source/command_queue/gpgpu_walker.h"
@@ -61,6 +62,17 @@ void HardwareInterface<GfxFamily>::dispatchWalker(
 
     TimestampPacketHelper::programCsrDependencies<GfxFamily>(*commandStream, csrDependencies);
 
+    bool predicatedDispatch = (csrDependencies.dispatchPredicateNodes != nullptr);
+    if (predicatedDispatch) {
+        // semaphores above are released by host, walkers are skipped when it terminated the dependency
+        auto predicateAddress = csrDependencies.dispatchPredicateNodes->peekNodes()[0]->getGpuAddress() +
+                                offsetof(TimestampPacketStorage, packets[0].contextStart);
+        auto loadRegisterMem = commandStream->getSpaceForCmd<typename GfxFamily::MI_LOAD_REGISTER_MEM>();
+        *loadRegisterMem = GfxFamily::cmdInitLoadRegisterMem;
+        loadRegisterMem->setRegisterAddress(CS_PREDICATE_RESULT);
+        loadRegisterMem->setMemoryAddress(predicateAddress);
+    }
+
     dsh->align(HardwareCommandsHelper<GfxFamily>::alignInterfaceDescriptorData);
 
     uint32_t interfaceDescriptorIndex = 0;
@@ -88,7 +100,7 @@ void HardwareInterface<GfxFamily>::dispatchWalker(
 
         dispatchKernelCommands(commandQueue, dispatchInfo, commandType, *commandStream, isMainKernel,
                                currentDispatchIndex, currentTimestampPacketNodes, preemptionMode, interfaceDescriptorIndex,
-                               offsetInterfaceDescriptorTable, *dsh, *ioh, *ssh);
+                               offsetInterfaceDescriptorTable, *dsh, *ioh, *ssh, predicatedDispatch);
 
         currentDispatchIndex++;
         dispatchInfo.dispatchEpilogueCommands(*commandStream, timestampPacketDependencies, commandQueue.getDevice().getHardwareInfo());
@@ -109,7 +121,7 @@ void HardwareInterface<GfxFamily>::dispatchKernelCommands(CommandQueue &commandQ
                                                           LinearStream &commandStream, bool isMainKernel, size_t currentDispatchIndex,
                                                           TimestampPacketContainer *currentTimestampPacketNodes, PreemptionMode preemptionMode,
                                                           uint32_t &interfaceDescriptorIndex, size_t offsetInterfaceDescriptorTable,
-                                                          IndirectHeap &dsh, IndirectHeap &ioh, IndirectHeap &ssh) {
+                                                          IndirectHeap &dsh, IndirectHeap &ioh, IndirectHeap &ssh, bool predicatedDispatch) {
     auto &kernel = *dispatchInfo.getKernel();
     DEBUG_BREAK_IF(!(dispatchInfo.getDim() >= 1 && dispatchInfo.getDim() <= 3));
     DEBUG_BREAK_IF(!(dispatchInfo.getGWS().z == 1 || dispatchInfo.getDim() == 3));
@@ -183,7 +195,7 @@ void HardwareInterface<GfxFamily>::dispatchKernelCommands(CommandQueue &commandQ
 
     programWalker(commandStream, kernel, commandQueue, currentTimestampPacketNodes, dsh, ioh, ssh, globalWorkSizes,
                   localWorkSizes, preemptionMode, currentDispatchIndex, interfaceDescriptorIndex, dispatchInfo,
-                  offsetInterfaceDescriptorTable, numberOfWorkgroups, startOfWorkgroups);
+                  offsetInterfaceDescriptorTable, numberOfWorkgroups, startOfWorkgroups, predicatedDispatch);
 
     dispatchWorkarounds(&commandStream, commandQueue, kernel, false);
 }
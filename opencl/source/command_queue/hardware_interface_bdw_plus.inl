@@ -100,9 +100,11 @@ inline void HardwareInterface<GfxFamily>::programWalker(
     const DispatchInfo &dispatchInfo,
     size_t offsetInterfaceDescriptorTable,
     Vec3<size_t> &numberOfWorkgroups,
-    Vec3<size_t> &startOfWorkgroups) {
+    Vec3<size_t> &startOfWorkgroups,
+    bool predicatedDispatch) {
 
     auto walkerCmd = allocateWalkerSpace(commandStream, kernel);
+    walkerCmd->setPredicateEnable(predicatedDispatch);
     uint32_t dim = dispatchInfo.getDim();
     uint32_t simd = kernel.getKernelInfo().getMaxSimdSize();
 
@@ -7,8 +7,10 @@
 
 #include "opencl/source/command_stream/aub_command_stream_receiver.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/execution_environment/root_device_environment.h"
+#include "shared/source/helpers/basic_math.h"
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/hw_helper.h"
 #include "shared/source/helpers/hw_info.h"
@@ -82,18 +84,44 @@ extern const size_t g_dwordCountMax;
 void AubFileStream::open(const char *filePath) {
     fileHandle.open(filePath, std::ofstream::binary);
     fileName.assign(filePath);
+
+    if (fileHandle.is_open() && DebugManager.flags.AubDumpBackgroundWriter.get() == 1) {
+        auto bufferSize = AubFileWriter::defaultBufferSize;
+        if (DebugManager.flags.AubDumpWriterBufferSizeKB.get() > 0) {
+            bufferSize = static_cast<size_t>(DebugManager.flags.AubDumpWriterBufferSizeKB.get()) * KB;
+        }
+        fileWriter = std::make_unique<AubFileWriter>(fileHandle, bufferSize);
+    }
+}
+
+AubFileStream::~AubFileStream() {
+    if (fileWriter) {
+        fileWriter->close();
+    }
 }
 
 void AubFileStream::close() {
+    if (fileWriter) {
+        fileWriter->close();
+        fileWriter.reset();
+    }
     fileHandle.close();
     fileName.clear();
 }
 
 void AubFileStream::write(const char *data, size_t size) {
+    if (fileWriter) {
+        fileWriter->write(data, size);
+        return;
+    }
     fileHandle.write(data, size);
 }
 
 void AubFileStream::flush() {
+    if (fileWriter) {
+        fileWriter->flush();
+        return;
+    }
     fileHandle.flush();
 }
 
@@ -10,6 +10,7 @@
 #include "shared/source/utilities/spinlock.h"
 
 #include "opencl/source/aub/aub_center.h"
+#include "opencl/source/aub/dirty_page_tracker.h"
 #include "opencl/source/command_stream/aub_command_stream_receiver.h"
 #include "opencl/source/gen_common/aub_mapper.h"
 #include "opencl/source/memory_manager/os_agnostic_memory_manager.h"
@@ -94,6 +95,8 @@ class AUBCommandStreamReceiverHw : public CommandStreamReceiverSimulatedHw<GfxFa
     // remap CPU VA -> GGTT VA
     AddressMapper *gttRemap;
 
+    DirtyPageTracker dirtyPageTracker;
+
     MOCKABLE_VIRTUAL bool addPatchInfoComments();
     void addGUCStartMessage(uint64_t batchBufferAddress);
     uint32_t getGUCWorkQueueItemHeader();
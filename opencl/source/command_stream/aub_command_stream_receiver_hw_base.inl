@@ -87,9 +87,15 @@ AUBCommandStreamReceiverHw<GfxFamily>::AUBCommandStreamReceiverHw(const std::str
 
 template <typename GfxFamily>
 AUBCommandStreamReceiverHw<GfxFamily>::~AUBCommandStreamReceiverHw() {
+    this->stopImplicitFlushTimer();
     if (osContext) {
         pollForCompletion();
     }
+    if (DebugManager.flags.EnableSimulationDirtyPageTracking.get()) {
+        auto &statistics = dirtyPageTracker.getStatistics();
+        printDebugString(DebugManager.flags.PrintDebugMessages.get(), stdout, "AUB dirty page tracking: bytes written %llu, bytes skipped %llu\n",
+                         static_cast<unsigned long long>(statistics.bytesWritten), static_cast<unsigned long long>(statistics.bytesSkipped));
+    }
     this->freeEngineInfo(*gttRemap);
 }
 
@@ -141,6 +147,7 @@ void AUBCommandStreamReceiverHw<GfxFamily>::initFile(const std::string &fileName
         }
         // Add the file header
         stream->init(AubMemDump::SteppingValues::A, aubDeviceId);
+        dirtyPageTracker.startNewStream();
     }
 }
 
@@ -616,12 +623,12 @@ void AUBCommandStreamReceiverHw<GfxFamily>::writeMemory(uint64_t gpuAddress, voi
 
     AubHelperHw<GfxFamily> aubHelperHw(this->isLocalMemoryEnabled());
 
-    PageWalker walker = [&](uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {
+    auto walker = [&](uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {
         AUB::reserveAddressGGTTAndWriteMmeory(*stream, static_cast<uintptr_t>(gpuAddress), cpuAddress, physAddress, size, offset, entryBits,
                                               aubHelperHw);
     };
 
-    ppgtt->pageWalk(static_cast<uintptr_t>(gpuAddress), size, 0, entryBits, walker, memoryBank);
+    ppgtt->rangeWalk(static_cast<uintptr_t>(gpuAddress), size, 0, entryBits, walker, memoryBank);
 }
 
 template <typename GfxFamily>
@@ -642,6 +649,12 @@ bool AUBCommandStreamReceiverHw<GfxFamily>::writeMemory(GraphicsAllocation &gfxA
 
     if (aubManager) {
         this->writeMemoryWithAubManager(gfxAllocation);
+    } else if (DebugManager.flags.EnableSimulationDirtyPageTracking.get() && DirtyPageTracker::isTrackingAllowed(gfxAllocation.getAllocationType())) {
+        auto memoryBank = this->getMemoryBank(&gfxAllocation);
+        auto entryBits = this->getPPGTTAdditionalBits(&gfxAllocation);
+        dirtyPageTracker.writeDirtyRanges(gfxAllocation.getAubPageHashes(), cpuAddress, size, [&](size_t offset, size_t rangeSize) {
+            writeMemory(gpuAddress + offset, ptrOffset(cpuAddress, offset), rangeSize, memoryBank, entryBits);
+        });
     } else {
         writeMemory(gpuAddress, cpuAddress, size, this->getMemoryBank(&gfxAllocation), this->getPPGTTAdditionalBits(&gfxAllocation));
     }
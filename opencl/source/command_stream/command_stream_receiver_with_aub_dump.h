@@ -19,6 +19,7 @@ class CommandStreamReceiverWithAUBDump : public BaseCSR {
 
   public:
     CommandStreamReceiverWithAUBDump(const std::string &baseName, ExecutionEnvironment &executionEnvironment, uint32_t rootDeviceIndex);
+    ~CommandStreamReceiverWithAUBDump() override;
 
     CommandStreamReceiverWithAUBDump(const CommandStreamReceiverWithAUBDump &) = delete;
     CommandStreamReceiverWithAUBDump &operator=(const CommandStreamReceiverWithAUBDump &) = delete;
@@ -6,6 +6,7 @@
  */
 
 #pragma once
+#include "opencl/source/aub/dirty_page_tracker.h"
 #include "opencl/source/command_stream/tbx_command_stream_receiver.h"
 #include "opencl/source/gen_common/aub_mapper.h"
 #include "opencl/source/memory_manager/address_mapper.h"
@@ -79,6 +80,8 @@ class TbxCommandStreamReceiverHw : public CommandStreamReceiverSimulatedHw<GfxFa
 
     std::set<GraphicsAllocation *> allocationsForDownload = {};
 
+    DirtyPageTracker dirtyPageTracker;
+
     CommandStreamReceiverType getType() override {
         return CommandStreamReceiverType::CSR_TBX;
     }
@@ -53,10 +53,17 @@ TbxCommandStreamReceiverHw<GfxFamily>::TbxCommandStreamReceiverHw(ExecutionEnvir
 
 template <typename GfxFamily>
 TbxCommandStreamReceiverHw<GfxFamily>::~TbxCommandStreamReceiverHw() {
+    this->stopImplicitFlushTimer();
     if (streamInitialized) {
         tbxStream.close();
     }
 
+    if (DebugManager.flags.EnableSimulationDirtyPageTracking.get()) {
+        auto &statistics = dirtyPageTracker.getStatistics();
+        printDebugString(DebugManager.flags.PrintDebugMessages.get(), stdout, "TBX dirty page tracking: bytes written %llu, bytes skipped %llu\n",
+                         static_cast<unsigned long long>(statistics.bytesWritten), static_cast<unsigned long long>(statistics.bytesSkipped));
+    }
+
     this->freeEngineInfo(gttRemap);
 }
 
@@ -398,12 +405,12 @@ void TbxCommandStreamReceiverHw<GfxFamily>::writeMemory(uint64_t gpuAddress, voi
 
     AubHelperHw<GfxFamily> aubHelperHw(this->localMemoryEnabled);
 
-    PageWalker walker = [&](uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {
+    auto walker = [&](uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {
         AUB::reserveAddressGGTTAndWriteMmeory(tbxStream, static_cast<uintptr_t>(gpuAddress), cpuAddress, physAddress, size, offset, entryBits,
                                               aubHelperHw);
     };
 
-    ppgtt->pageWalk(static_cast<uintptr_t>(gpuAddress), size, 0, entryBits, walker, memoryBank);
+    ppgtt->rangeWalk(static_cast<uintptr_t>(gpuAddress), size, 0, entryBits, walker, memoryBank);
 }
 
 template <typename GfxFamily>
@@ -421,6 +428,12 @@ bool TbxCommandStreamReceiverHw<GfxFamily>::writeMemory(GraphicsAllocation &gfxA
 
     if (aubManager) {
         this->writeMemoryWithAubManager(gfxAllocation);
+    } else if (DebugManager.flags.EnableSimulationDirtyPageTracking.get() && DirtyPageTracker::isTrackingAllowed(gfxAllocation.getAllocationType())) {
+        auto memoryBank = this->getMemoryBank(&gfxAllocation);
+        auto entryBits = this->getPPGTTAdditionalBits(&gfxAllocation);
+        dirtyPageTracker.writeDirtyRanges(gfxAllocation.getTbxPageHashes(), cpuAddress, size, [&](size_t offset, size_t rangeSize) {
+            writeMemory(gpuAddress + offset, ptrOffset(cpuAddress, offset), rangeSize, memoryBank, entryBits);
+        });
     } else {
         writeMemory(gpuAddress, cpuAddress, size, this->getMemoryBank(&gfxAllocation), this->getPPGTTAdditionalBits(&gfxAllocation));
     }
@@ -24,6 +24,7 @@
 #include "opencl/source/gtpin/gtpin_notify.h"
 #include "opencl/source/helpers/get_info_status_mapper.h"
 #include "opencl/source/helpers/surface_formats.h"
+#include "opencl/source/mem_obj/buffer_pool_allocator.h"
 #include "opencl/source/mem_obj/image.h"
 #include "opencl/source/platform/platform.h"
 #include "opencl/source/scheduler/scheduler_kernel.h"
@@ -54,6 +55,9 @@ Context::Context(
 
 Context::~Context() {
     delete[] properties;
+    if (bufferPoolAllocator) {
+        delete bufferPoolAllocator;
+    }
     if (specialQueue) {
         delete specialQueue;
     }
@@ -190,6 +194,10 @@ bool Context::createImpl(const cl_context_properties *properties,
         if (anySvmSupport) {
             this->svmAllocsManager = new SVMAllocsManager(this->memoryManager);
         }
+
+        if (BufferPoolAllocator::isEnabled()) {
+            this->bufferPoolAllocator = new BufferPoolAllocator(*this);
+        }
     }
 
     auto commandQueue = CommandQueue::create(this, devices[0], nullptr, true, errcodeRet);
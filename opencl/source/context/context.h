@@ -20,6 +20,7 @@ namespace NEO {
 struct BuiltInKernel;
 class CommandStreamReceiver;
 class CommandQueue;
+class BufferPoolAllocator;
 class Device;
 class DeviceQueue;
 class MemObj;
@@ -88,6 +89,10 @@ class Context : public BaseObject<_cl_context> {
         return svmAllocsManager;
     }
 
+    BufferPoolAllocator *getBufferPoolAllocator() const {
+        return bufferPoolAllocator;
+    }
+
     DeviceQueue *getDefaultDeviceQueue();
     void setDefaultDeviceQueue(DeviceQueue *queue);
 
@@ -159,6 +164,7 @@ class Context : public BaseObject<_cl_context> {
     ClDeviceVector devices;
     MemoryManager *memoryManager;
     SVMAllocsManager *svmAllocsManager = nullptr;
+    BufferPoolAllocator *bufferPoolAllocator = nullptr;
     CommandQueue *specialQueue;
     DeviceQueue *defaultDeviceQueue;
     std::vector<std::unique_ptr<SharingFunctions>> sharingFunctions;
@@ -51,6 +51,8 @@ Drm *Drm::create(std::unique_ptr<HwDeviceId> hwDeviceId, RootDeviceEnvironment &
         return nullptr;
     }
 
+    drmObject->setupCapabilitiesSnapshot();
+
     const DeviceDescriptor *device = nullptr;
     GTTYPE eGtType = GTTYPE_UNDEFINED;
     for (auto &d : deviceDescriptorTable) {
@@ -9,6 +9,7 @@
 
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/device/device.h"
+#include "shared/source/helpers/timestamp_packet.h"
 
 #include "opencl/source/command_queue/command_queue.h"
 #include "opencl/source/context/context.h"
@@ -20,10 +21,67 @@ UserEvent::UserEvent(Context *ctx)
     transitionExecutionStatus(CL_QUEUED);
 }
 
+UserEvent::~UserEvent() {
+    if (timestampPacketContainer && !statusSetByHost) {
+        // enqueues waiting on GPU must not hang on released event, they are terminated
+        setStatus(-1);
+    }
+    // node has to go back to allocator before context (and command stream receivers with it) can be released
+    timestampPacketContainer.reset();
+}
+
 void UserEvent::updateExecutionStatus() {
     return;
 }
 
+bool UserEvent::setStatus(cl_int status) {
+    if (isStatusCompleted(status)) {
+        std::lock_guard<std::mutex> lock(gpuWaitMutex);
+        statusSetByHost = true;
+    }
+    // output events of enqueues waiting on GPU are child events, they are transitioned before GPU is released
+    auto statusChanged = Event::setStatus(status);
+    if (statusChanged && isStatusCompleted(status)) {
+        signalGpuWait(isStatusCompletedByTermination(status));
+    }
+    return statusChanged;
+}
+
+void UserEvent::signalGpuWait(bool terminated) {
+    if (!timestampPacketContainer) {
+        return;
+    }
+    for (auto &node : timestampPacketContainer->peekNodes()) {
+        for (auto &packet : node->tagForCpuAccess->packets) {
+            // context start is loaded to predicate register of waiting enqueue, it has to be visible before semaphore is released
+            packet.contextStart = terminated ? 0u : 1u;
+            packet.globalStart = 0u;
+            packet.globalEnd = 0u;
+            std::atomic_thread_fence(std::memory_order_release);
+            packet.contextEnd = 0u;
+        }
+    }
+}
+
+bool UserEvent::prepareForGpuWait(CommandStreamReceiver &commandStreamReceiver, Event *outEvent) {
+    std::lock_guard<std::mutex> lock(gpuWaitMutex);
+    if (statusSetByHost) {
+        return false;
+    }
+    if (!timestampPacketContainer) {
+        timestampPacketContainer = std::make_unique<TimestampPacketContainer>();
+        timestampPacketContainer->add(commandStreamReceiver.getTimestampPacketAllocator()->getTag());
+        gpuWaitRootDeviceIndex = commandStreamReceiver.getRootDeviceIndex();
+    }
+    if (gpuWaitRootDeviceIndex != commandStreamReceiver.getRootDeviceIndex()) {
+        return false;
+    }
+    if (outEvent) {
+        addChild(*outEvent);
+    }
+    return true;
+}
+
 bool UserEvent::wait(bool blocking, bool useQuickKmdSleep) {
     while (updateStatusAndCheckCompletion() == false) {
         if (blocking == false) {
@@ -8,23 +8,39 @@
 #pragma once
 #include "event.h"
 
+#include <mutex>
+
 namespace NEO {
 class CommandQueue;
+class CommandStreamReceiver;
 class Context;
 
 class UserEvent : public Event {
   public:
     UserEvent(Context *ctx = nullptr);
 
-    ~UserEvent() override = default;
+    ~UserEvent() override;
 
     bool wait(bool blocking, bool useQuickKmdSleep) override;
 
+    bool setStatus(cl_int status) override;
+
     void updateExecutionStatus() override;
 
     uint32_t getTaskLevel() override;
 
     bool isInitialEventStatus() const;
+
+    // Assigns timestamp packet node that is signaled by host when status is set, output event of waiting enqueue gets the status first.
+    // Returns false if status was already set or node can't be waited on by given command stream receiver.
+    bool prepareForGpuWait(CommandStreamReceiver &commandStreamReceiver, Event *outEvent);
+
+  protected:
+    void signalGpuWait(bool terminated);
+
+    std::mutex gpuWaitMutex;
+    uint32_t gpuWaitRootDeviceIndex = 0u;
+    bool statusSetByHost = false;
 };
 
 class VirtualEvent : public Event {
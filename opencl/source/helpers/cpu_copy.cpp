@@ -0,0 +1,151 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/helpers/cpu_copy.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/helpers/string.h"
+#include "shared/source/utilities/cpu_info.h"
+#include "shared/source/utilities/parallel_for.h"
+
+#include <algorithm>
+#include <emmintrin.h>
+
+namespace NEO {
+
+constexpr size_t CpuCopyHelper::defaultMultiThreadThreshold;
+constexpr size_t CpuCopyHelper::nonTemporalThreshold;
+constexpr size_t CpuCopyHelper::minChunkSize;
+constexpr size_t CpuCopyHelper::maxDefaultThreadCount;
+
+namespace {
+void copyTemporal(void *dst, const void *src, size_t size) {
+    memcpy_s(dst, size, src, size);
+}
+} // namespace
+
+void copyNonTemporalSse2(void *dst, const void *src, size_t size) {
+    constexpr size_t vectorSize = sizeof(__m128i);
+    auto dstBytes = static_cast<uint8_t *>(dst);
+    auto srcBytes = static_cast<const uint8_t *>(src);
+
+    // streaming stores need aligned destination, source is read with unaligned loads
+    auto headSize = std::min(size, ptrDiff(alignUp(dstBytes, vectorSize), dstBytes));
+    memcpy(dstBytes, srcBytes, headSize);
+    dstBytes += headSize;
+    srcBytes += headSize;
+    size -= headSize;
+
+    for (; size >= 4 * vectorSize; size -= 4 * vectorSize) {
+        auto v0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(srcBytes));
+        auto v1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(srcBytes + vectorSize));
+        auto v2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(srcBytes + 2 * vectorSize));
+        auto v3 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(srcBytes + 3 * vectorSize));
+        _mm_stream_si128(reinterpret_cast<__m128i *>(dstBytes), v0);
+        _mm_stream_si128(reinterpret_cast<__m128i *>(dstBytes + vectorSize), v1);
+        _mm_stream_si128(reinterpret_cast<__m128i *>(dstBytes + 2 * vectorSize), v2);
+        _mm_stream_si128(reinterpret_cast<__m128i *>(dstBytes + 3 * vectorSize), v3);
+        dstBytes += 4 * vectorSize;
+        srcBytes += 4 * vectorSize;
+    }
+    for (; size >= vectorSize; size -= vectorSize) {
+        _mm_stream_si128(reinterpret_cast<__m128i *>(dstBytes), _mm_loadu_si128(reinterpret_cast<const __m128i *>(srcBytes)));
+        dstBytes += vectorSize;
+        srcBytes += vectorSize;
+    }
+    memcpy(dstBytes, srcBytes, size);
+
+    // streaming stores are weakly ordered
+    _mm_sfence();
+}
+
+void (*CpuCopyHelper::copyNonTemporal)(void *dst, const void *src, size_t size) = copyNonTemporalSse2;
+
+CpuCopyHelper::CpuCopyHelper() {
+    if (CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureAvX2)) {
+        CpuCopyHelper::copyNonTemporal = copyNonTemporalAvx2;
+    }
+}
+
+CpuCopyHelper CpuCopyHelper::initializer;
+
+size_t CpuCopyHelper::getThreadCount(size_t size) {
+    size_t threshold = defaultMultiThreadThreshold;
+    if (DebugManager.flags.CpuCopyMultiThreadThreshold.get() != -1) {
+        threshold = static_cast<size_t>(DebugManager.flags.CpuCopyMultiThreadThreshold.get());
+    }
+    if (size < threshold) {
+        return 1u;
+    }
+
+    size_t threadCount = std::min(getDefaultParallelForThreadCount(), maxDefaultThreadCount);
+    if (DebugManager.flags.CpuCopyThreadCount.get() != -1) {
+        threadCount = static_cast<size_t>(std::max(1, DebugManager.flags.CpuCopyThreadCount.get()));
+    }
+    return std::max(static_cast<size_t>(1u), std::min(threadCount, size / minChunkSize));
+}
+
+bool CpuCopyHelper::useNonTemporalStores(size_t size) {
+    if (DebugManager.flags.EnableCpuCopyNonTemporalStores.get() != -1) {
+        return DebugManager.flags.EnableCpuCopyNonTemporalStores.get() == 1;
+    }
+    return size >= nonTemporalThreshold;
+}
+
+void CpuCopyHelper::copy(void *dst, const void *src, size_t size) {
+    auto copyChunk = useNonTemporalStores(size) ? copyNonTemporal : copyTemporal;
+    auto threadCount = getThreadCount(size);
+    if (threadCount <= 1) {
+        copyChunk(dst, src, size);
+        return;
+    }
+
+    auto chunkSize = alignUp((size + threadCount - 1) / threadCount, MemoryConstants::cacheLineSize);
+    auto chunkCount = (size + chunkSize - 1) / chunkSize;
+    parallelFor(chunkCount, threadCount, [&](size_t chunk) {
+        auto offset = chunk * chunkSize;
+        copyChunk(ptrOffset(dst, offset), ptrOffset(src, offset), std::min(chunkSize, size - offset));
+    });
+}
+
+void CpuCopyHelper::copyRegion(void *dst, size_t dstRowPitch, size_t dstSlicePitch,
+                               const void *src, size_t srcRowPitch, size_t srcSlicePitch,
+                               const std::array<size_t, 3> &region) {
+    auto rowSize = region[0];
+    auto rowsPerSlice = region[1];
+    auto slices = region[2];
+    auto totalSize = rowSize * rowsPerSlice * slices;
+    if (totalSize == 0) {
+        return;
+    }
+
+    bool rowsContiguous = rowsPerSlice == 1 || (srcRowPitch == rowSize && dstRowPitch == rowSize);
+    bool slicesContiguous = slices == 1 || (srcSlicePitch == rowSize * rowsPerSlice && dstSlicePitch == rowSize * rowsPerSlice);
+    if (rowsContiguous && slicesContiguous) {
+        copy(dst, src, totalSize);
+        return;
+    }
+
+    auto copyRow = useNonTemporalStores(totalSize) ? copyNonTemporal : copyTemporal;
+    auto rowsCount = rowsPerSlice * slices;
+    auto taskCount = std::min(getThreadCount(totalSize), rowsCount);
+    auto rowsPerTask = (rowsCount + taskCount - 1) / taskCount;
+
+    parallelFor(taskCount, taskCount, [&](size_t task) {
+        auto lastRow = std::min(rowsCount, (task + 1) * rowsPerTask);
+        for (auto row = task * rowsPerTask; row < lastRow; row++) {
+            auto slice = row / rowsPerSlice;
+            auto rowInSlice = row % rowsPerSlice;
+            copyRow(ptrOffset(dst, slice * dstSlicePitch + rowInSlice * dstRowPitch),
+                    ptrOffset(src, slice * srcSlicePitch + rowInSlice * srcRowPitch),
+                    rowSize);
+        }
+    });
+}
+} // namespace NEO
@@ -0,0 +1,44 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/memory_manager/memory_constants.h"
+
+#include <array>
+#include <cstddef>
+
+namespace NEO {
+
+// Host side copies used by CPU transfers (read/write buffer, map/unmap, image row copies).
+// Large copies are split across threads and written with streaming stores, so they do not evict the caches.
+struct CpuCopyHelper {
+    static constexpr size_t defaultMultiThreadThreshold = 4 * MemoryConstants::megaByte;
+    static constexpr size_t nonTemporalThreshold = MemoryConstants::megaByte;
+    static constexpr size_t minChunkSize = 256 * MemoryConstants::kiloByte;
+    static constexpr size_t maxDefaultThreadCount = 8;
+
+    static void (*copyNonTemporal)(void *dst, const void *src, size_t size);
+
+    static void copy(void *dst, const void *src, size_t size);
+
+    // region[0] is row size in bytes, region[1] rows per slice, region[2] slices
+    static void copyRegion(void *dst, size_t dstRowPitch, size_t dstSlicePitch,
+                           const void *src, size_t srcRowPitch, size_t srcSlicePitch,
+                           const std::array<size_t, 3> &region);
+
+    static size_t getThreadCount(size_t size);
+    static bool useNonTemporalStores(size_t size);
+
+    static CpuCopyHelper initializer;
+
+  private:
+    CpuCopyHelper();
+};
+
+void copyNonTemporalSse2(void *dst, const void *src, size_t size);
+void copyNonTemporalAvx2(void *dst, const void *src, size_t size);
+} // namespace NEO
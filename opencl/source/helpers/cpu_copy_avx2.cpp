@@ -0,0 +1,51 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/ptr_math.h"
+
+#include "opencl/source/helpers/cpu_copy.h"
+
+#include <algorithm>
+#include <cstring>
+#include <immintrin.h>
+
+namespace NEO {
+void copyNonTemporalAvx2(void *dst, const void *src, size_t size) {
+    constexpr size_t vectorSize = sizeof(__m256i);
+    auto dstBytes = static_cast<uint8_t *>(dst);
+    auto srcBytes = static_cast<const uint8_t *>(src);
+
+    auto headSize = std::min(size, ptrDiff(alignUp(dstBytes, vectorSize), dstBytes));
+    memcpy(dstBytes, srcBytes, headSize);
+    dstBytes += headSize;
+    srcBytes += headSize;
+    size -= headSize;
+
+    for (; size >= 4 * vectorSize; size -= 4 * vectorSize) {
+        auto v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(srcBytes));
+        auto v1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(srcBytes + vectorSize));
+        auto v2 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(srcBytes + 2 * vectorSize));
+        auto v3 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(srcBytes + 3 * vectorSize));
+        _mm256_stream_si256(reinterpret_cast<__m256i *>(dstBytes), v0);
+        _mm256_stream_si256(reinterpret_cast<__m256i *>(dstBytes + vectorSize), v1);
+        _mm256_stream_si256(reinterpret_cast<__m256i *>(dstBytes + 2 * vectorSize), v2);
+        _mm256_stream_si256(reinterpret_cast<__m256i *>(dstBytes + 3 * vectorSize), v3);
+        dstBytes += 4 * vectorSize;
+        srcBytes += 4 * vectorSize;
+    }
+    for (; size >= vectorSize; size -= vectorSize) {
+        _mm256_stream_si256(reinterpret_cast<__m256i *>(dstBytes), _mm256_loadu_si256(reinterpret_cast<const __m256i *>(srcBytes)));
+        dstBytes += vectorSize;
+        srcBytes += vectorSize;
+    }
+    memcpy(dstBytes, srcBytes, size);
+
+    _mm_sfence();
+    _mm256_zeroupper();
+}
+} // namespace NEO
@@ -21,6 +21,10 @@ void EventsRequest::fillCsrDependencies(CsrDependencies &csrDeps, CommandStreamR
     for (cl_uint i = 0; i < this->numEventsInWaitList; i++) {
         auto event = castToObjectOrAbort<Event>(this->eventWaitList[i]);
         if (event->isUserEvent()) {
+            // user event waited on GPU is signaled by host, semaphore goes to command stream of the enqueue
+            if (event->getTimestampPacketNodes() && CsrDependencies::DependenciesType::OutOfCsr != depsType) {
+                csrDeps.push_back(event->getTimestampPacketNodes());
+            }
             continue;
         }
 
@@ -25,6 +25,15 @@ inline void releaseVirtualEvent(CommandQueue &commandQueue) {
 inline void releaseVirtualEvent(DeviceQueue &commandQueue) {
 }
 
+inline void flushPendingAuxTranslations(CommandQueue &commandQueue) {
+    if (commandQueue.getRefApiCount() == 1) {
+        commandQueue.flushPendingAuxTranslations();
+    }
+}
+
+inline void flushPendingAuxTranslations(DeviceQueue &commandQueue) {
+}
+
 bool isCommandWithoutKernel(uint32_t commandType);
 
 template <typename QueueType>
@@ -44,6 +53,7 @@ void releaseQueue(cl_command_queue commandQueue, cl_int &retVal) {
     using BaseType = typename QueueType::BaseType;
     auto queue = castToObject<QueueType>(static_cast<BaseType *>(commandQueue));
     if (queue) {
+        flushPendingAuxTranslations(*queue);
         releaseVirtualEvent(*queue);
         queue->release();
         retVal = CL_SUCCESS;
@@ -192,6 +192,13 @@ template void Kernel::patchWithImplicitSurface(void *ptrToPatchInCrossThreadData
 cl_int Kernel::initialize() {
     cl_int retVal = CL_OUT_OF_HOST_MEMORY;
     do {
+        if (kernelInfo.isKernelAllocationDeferred()) {
+            // kernel info is owned by the program, its ISA is uploaded when the first kernel is created
+            if (!const_cast<KernelInfo &>(kernelInfo).createDeferredKernelAllocation()) {
+                break;
+            }
+        }
+
         const auto &workloadInfo = kernelInfo.workloadInfo;
         const auto &heapInfo = kernelInfo.heapInfo;
         const auto &patchInfo = kernelInfo.patchInfo;
@@ -2363,6 +2370,19 @@ void Kernel::fillWithBuffersForAuxTranslation(MemObjsForAuxTranslation &memObjsF
     }
 }
 
+bool Kernel::isMemObjAllocationUsed(const GraphicsAllocation *allocation) const {
+    for (uint32_t i = 0; i < getKernelArgsNumber(); i++) {
+        auto argType = kernelArguments.at(i).type;
+        if (BUFFER_OBJ == argType || IMAGE_OBJ == argType || PIPE_OBJ == argType) {
+            auto memObj = castToObject<MemObj>(getKernelArg(i));
+            if (memObj && memObj->getGraphicsAllocation() == allocation) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
 void Kernel::getAllocationsForCacheFlush(CacheFlushAllocationsVec &out) const {
     if (false == HwHelper::cacheFlushAfterWalkerSupported(device.getHardwareInfo())) {
         return;
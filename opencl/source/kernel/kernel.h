@@ -381,6 +381,7 @@ class Kernel : public BaseObject<_cl_kernel> {
     }
 
     void fillWithBuffersForAuxTranslation(MemObjsForAuxTranslation &memObjsForAuxTranslation);
+    bool isMemObjAllocationUsed(const GraphicsAllocation *allocation) const;
 
     MOCKABLE_VIRTUAL bool requiresCacheFlushCommand(const CommandQueue &commandQueue) const;
 
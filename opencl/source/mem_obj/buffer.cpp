@@ -26,8 +26,10 @@
 #include "opencl/source/command_queue/command_queue.h"
 #include "opencl/source/context/context.h"
 #include "opencl/source/device/cl_device.h"
+#include "opencl/source/helpers/cpu_copy.h"
 #include "opencl/source/helpers/memory_properties_flags_helpers.h"
 #include "opencl/source/helpers/validators.h"
+#include "opencl/source/mem_obj/buffer_pool_allocator.h"
 #include "opencl/source/mem_obj/mem_obj_helper.h"
 
 namespace NEO {
@@ -64,7 +66,16 @@ Buffer::Buffer(Context *context,
 Buffer::Buffer() : MemObj(nullptr, CL_MEM_OBJECT_BUFFER, {}, 0, 0, 0, nullptr, nullptr, nullptr, false, false, false) {
 }
 
-Buffer::~Buffer() = default;
+Buffer::~Buffer() {
+    if (bufferPoolAllocator) {
+        // Pool allocation is shared, so only wait for GPU when MemObj would wait before releasing the memory
+        if (allocatedMapPtr != nullptr || mapOperationsHandler.size() > 0 || !destructorCallbacks.empty()) {
+            memoryManager->waitForEnginesCompletion(*graphicsAllocation);
+        }
+        bufferPoolAllocator->releaseBuffer(*this);
+        graphicsAllocation = nullptr;
+    }
+}
 
 bool Buffer::isSubBuffer() {
     return this->associatedMemObject != nullptr;
@@ -167,6 +178,19 @@ Buffer *Buffer::create(Context *context,
         return nullptr;
     }
 
+    auto bufferPoolAllocator = context->getBufferPoolAllocator();
+    if (bufferPoolAllocator && bufferPoolAllocator->isSizeSuitable(size) && !context->isSharedContext) {
+        if (allocationType == GraphicsAllocation::AllocationType::BUFFER &&
+            BufferPoolAllocator::areFlagsSuitable(memoryProperties, flags, flagsIntel)) {
+            pBuffer = bufferPoolAllocator->createBuffer(memoryProperties, flags, size, hostPtr, errcodeRet);
+            if (pBuffer || errcodeRet != CL_SUCCESS) {
+                return pBuffer;
+            }
+        } else {
+            bufferPoolAllocator->recordFallback();
+        }
+    }
+
     if (allocationType == GraphicsAllocation::AllocationType::BUFFER_COMPRESSED) {
         zeroCopyAllowed = false;
         allocateMemory = true;
@@ -314,7 +338,7 @@ Buffer *Buffer::create(Context *context,
                 }
             }
         } else {
-            memcpy_s(memory->getUnderlyingBuffer(), size, hostPtr, size);
+            CpuCopyHelper::copy(memory->getUnderlyingBuffer(), hostPtr, size);
         }
     }
 
@@ -430,7 +454,8 @@ Buffer *Buffer::createSubBuffer(cl_mem_flags flags,
     }
 
     buffer->associatedMemObject = this;
-    buffer->offset = region->origin;
+    buffer->offset = this->offset + region->origin;
+    buffer->poolOffset = this->poolOffset;
     buffer->setParentSharingHandler(this->getSharingHandler());
     this->incRefInternal();
 
@@ -484,7 +509,7 @@ void Buffer::transferData(void *dst, void *src, size_t copySize, size_t copyOffs
     DBG_LOG(LogMemoryObject, __FUNCTION__, " hostPtr: ", hostPtr, ", size: ", copySize, ", offset: ", copyOffset, ", memoryStorage: ", memoryStorage);
     auto dstPtr = ptrOffset(dst, copyOffset);
     auto srcPtr = ptrOffset(src, copyOffset);
-    memcpy_s(dstPtr, copySize, srcPtr, copySize);
+    CpuCopyHelper::copy(dstPtr, srcPtr, copySize);
 }
 
 void Buffer::transferDataToHostPtr(MemObjSizeArray &copySize, MemObjOffsetArray &copyOffset) {
@@ -19,6 +19,7 @@
 namespace NEO {
 class Device;
 class Buffer;
+class BufferPoolAllocator;
 class ClDevice;
 class MemoryManager;
 
@@ -41,6 +42,8 @@ typedef struct {
 extern BufferFuncs bufferFactory[IGFX_MAX_CORE];
 
 class Buffer : public MemObj {
+    friend BufferPoolAllocator;
+
   public:
     constexpr static size_t maxBufferSizeForReadWriteOnCpu = 10 * MB;
     constexpr static cl_ulong maskMagic = 0xFFFFFFFFFFFFFFFFLL;
@@ -143,6 +146,7 @@ class Buffer : public MemObj {
     uint32_t getMocsValue(bool disableL3Cache, bool isReadOnlyArgument) const;
 
     bool isCompressed() const;
+    bool isPooled() const { return bufferPoolAllocator != nullptr; }
 
   protected:
     Buffer(Context *context,
@@ -172,6 +176,9 @@ class Buffer : public MemObj {
     static bool isReadOnlyMemoryPermittedByFlags(const MemoryPropertiesFlags &properties);
 
     void transferData(void *dst, void *src, size_t copySize, size_t copyOffset);
+
+    BufferPoolAllocator *bufferPoolAllocator = nullptr;
+    size_t pooledAllocationSize = 0;
 };
 
 template <typename GfxFamily>
@@ -192,6 +199,7 @@ class BufferHw : public Buffer {
                  zeroCopy, isHostPtrSVM, isObjectRedescribed) {}
 
     void setArgStateful(void *memory, bool forceNonAuxMode, bool disableL3, bool alignSizeForAuxTranslation, bool isReadOnlyArgument) override;
+    void programBufferSurfaceState(void *memory, bool forceNonAuxMode, bool disableL3, bool alignSizeForAuxTranslation, bool isReadOnlyArgument);
     void appendBufferState(void *memory, Context *context, GraphicsAllocation *gfxAllocation, bool isReadOnlyArgument);
     void appendSurfaceStateExt(void *memory);
 
@@ -223,5 +231,9 @@ class BufferHw : public Buffer {
 
     typedef typename GfxFamily::RENDER_SURFACE_STATE SURFACE_STATE;
     typename SURFACE_STATE::SURFACE_TYPE surfaceType;
+    SurfaceStateTemplateCache<SURFACE_STATE> surfaceStateTemplates;
+
+  protected:
+    uint64_t getBufferAddress() const;
 };
 } // namespace NEO
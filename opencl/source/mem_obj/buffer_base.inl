@@ -30,14 +30,34 @@ union SURFACE_STATE_BUFFER_LENGTH {
 
 template <typename GfxFamily>
 void BufferHw<GfxFamily>::setArgStateful(void *memory, bool forceNonAuxMode, bool disableL3, bool alignSizeForAuxTranslation, bool isReadOnlyArgument) {
+    if (!areSurfaceStateTemplatesEnabled()) {
+        programBufferSurfaceState(memory, forceNonAuxMode, disableL3, alignSizeForAuxTranslation, isReadOnlyArgument);
+        return;
+    }
+
+    uint64_t key = (forceNonAuxMode ? 1u : 0u) | (disableL3 ? 2u : 0u) | (alignSizeForAuxTranslation ? 4u : 0u) | (isReadOnlyArgument ? 8u : 0u);
+    auto stamp = getSurfaceStateTemplateStamp(getBufferAddress());
+    surfaceStateTemplates.copySurfaceState(memory, key, stamp, [&](SURFACE_STATE *surfaceState) {
+        *surfaceState = GfxFamily::cmdInitRenderSurfaceState;
+        programBufferSurfaceState(surfaceState, forceNonAuxMode, disableL3, alignSizeForAuxTranslation, isReadOnlyArgument);
+    });
+}
+
+template <typename GfxFamily>
+uint64_t BufferHw<GfxFamily>::getBufferAddress() const {
+    // The graphics allocation for Host Ptr surface will be created in makeResident call and GPU address is expected to be the same as CPU address
+    auto bufferAddress = (getGraphicsAllocation() != nullptr) ? getGraphicsAllocation()->getGpuAddress() : castToUint64(getHostPtr());
+    return bufferAddress + this->offset;
+}
+
+template <typename GfxFamily>
+void BufferHw<GfxFamily>::programBufferSurfaceState(void *memory, bool forceNonAuxMode, bool disableL3, bool alignSizeForAuxTranslation, bool isReadOnlyArgument) {
     using RENDER_SURFACE_STATE = typename GfxFamily::RENDER_SURFACE_STATE;
     using SURFACE_FORMAT = typename RENDER_SURFACE_STATE::SURFACE_FORMAT;
     using AUXILIARY_SURFACE_MODE = typename RENDER_SURFACE_STATE::AUXILIARY_SURFACE_MODE;
 
     auto surfaceState = reinterpret_cast<RENDER_SURFACE_STATE *>(memory);
-    // The graphics allocation for Host Ptr surface will be created in makeResident call and GPU address is expected to be the same as CPU address
-    auto bufferAddress = (getGraphicsAllocation() != nullptr) ? getGraphicsAllocation()->getGpuAddress() : castToUint64(getHostPtr());
-    bufferAddress += this->offset;
+    auto bufferAddress = getBufferAddress();
 
     auto bufferAddressAligned = alignDown(bufferAddress, 4);
     auto bufferOffset = ptrDiff(bufferAddress, bufferAddressAligned);
@@ -0,0 +1,248 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/mem_obj/buffer_pool_allocator.h"
+
+#include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/engine_control.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/helpers/string.h"
+#include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/os_interface/os_context.h"
+
+#include "opencl/source/command_queue/command_queue.h"
+#include "opencl/source/context/context.h"
+#include "opencl/source/device/cl_device.h"
+#include "opencl/source/helpers/mem_properties_parser_helper.h"
+#include "opencl/source/mem_obj/buffer.h"
+
+#include <algorithm>
+
+namespace NEO {
+
+constexpr size_t BufferPoolAllocator::poolSize;
+constexpr size_t BufferPoolAllocator::defaultSmallBufferThreshold;
+
+BufferPoolAllocator::BufferPoolAllocator(Context &context) : context(context), memoryManager(context.getMemoryManager()) {
+    if (DebugManager.flags.SmallBufferPoolThreshold.get() != -1) {
+        smallBufferThreshold = static_cast<size_t>(DebugManager.flags.SmallBufferPoolThreshold.get());
+    }
+    // pooled buffers must satisfy CL_DEVICE_MEM_BASE_ADDR_ALIGN, same as sub-buffers
+    auto memBaseAddressAlign = static_cast<size_t>(context.getDevice(0)->getDeviceInfo().memBaseAddressAlign / 8);
+    chunkAlignment = std::max(chunkAlignment, memBaseAddressAlign);
+}
+
+BufferPoolAllocator::~BufferPoolAllocator() {
+    auto statistics = getStatistics();
+    printDebugString(DebugManager.flags.PrintDebugMessages.get(), stdout,
+                     "Small buffer pool: pools %u (%llu bytes), buffers created %llu, fallbacks %llu, live buffers %u (%llu bytes requested, %llu bytes allocated)\n",
+                     statistics.poolsCount, static_cast<unsigned long long>(statistics.poolsSize),
+                     static_cast<unsigned long long>(statistics.pooledBuffersCreated), static_cast<unsigned long long>(statistics.fallbacks),
+                     statistics.buffersCount, static_cast<unsigned long long>(statistics.requestedSize), static_cast<unsigned long long>(statistics.allocatedSize));
+
+    for (auto &pool : pools) {
+        memoryManager->removeAllocationFromHostPtrManager(pool->allocation);
+        memoryManager->checkGpuUsageAndDestroyGraphicsAllocations(pool->allocation);
+    }
+}
+
+bool BufferPoolAllocator::isEnabled() {
+    return DebugManager.flags.EnableSmallBufferPool.get() == 1;
+}
+
+bool BufferPoolAllocator::areFlagsSuitable(const MemoryPropertiesFlags &memoryProperties, cl_mem_flags flags, cl_mem_flags_intel flagsIntel) {
+    constexpr cl_mem_flags supportedFlags = CL_MEM_READ_WRITE | CL_MEM_WRITE_ONLY | CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR |
+                                            CL_MEM_HOST_WRITE_ONLY | CL_MEM_HOST_READ_ONLY | CL_MEM_HOST_NO_ACCESS;
+    return (flags & ~supportedFlags) == 0 &&
+           flagsIntel == 0 &&
+           !memoryProperties.flags.useHostPtr &&
+           !memoryProperties.flags.allocHostPtr &&
+           !memoryProperties.flags.forceSharedPhysicalMemory;
+}
+
+Buffer *BufferPoolAllocator::createBuffer(const MemoryPropertiesFlags &memoryProperties,
+                                          cl_mem_flags flags,
+                                          size_t size,
+                                          void *hostPtr,
+                                          cl_int &errcodeRet) {
+    errcodeRet = CL_SUCCESS;
+
+    Pool *pool = nullptr;
+    size_t allocatedSize = size;
+    uint64_t chunkAddress = 0u;
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        chunkAddress = allocateChunk(allocatedSize, pool);
+        if (chunkAddress == 0u) {
+            fallbacks++;
+            return nullptr;
+        }
+        requestedSize += size;
+        buffersCount++;
+        pooledBuffersCreated++;
+    }
+
+    auto allocation = pool->allocation;
+    auto offset = static_cast<size_t>(chunkAddress - allocation->getGpuAddress());
+    bool systemMemory = MemoryPool::isSystemMemoryPool(allocation->getMemoryPool());
+    bool zeroCopy = systemMemory && !DebugManager.flags.DisableZeroCopyForBuffers.get();
+
+    auto buffer = Buffer::createBufferHw(&context, memoryProperties, flags, 0, size,
+                                         ptrOffset(allocation->getUnderlyingBuffer(), offset), nullptr,
+                                         allocation, zeroCopy, false, false);
+    if (!buffer) {
+        std::lock_guard<std::mutex> lock(mtx);
+        pool->chunkAllocator->free(chunkAddress, allocatedSize);
+        requestedSize -= size;
+        buffersCount--;
+        errcodeRet = CL_OUT_OF_HOST_MEMORY;
+        return nullptr;
+    }
+    buffer->offset = offset;
+    buffer->poolOffset = offset;
+    buffer->bufferPoolAllocator = this;
+    buffer->pooledAllocationSize = allocatedSize;
+
+    if (memoryProperties.flags.copyHostPtr) {
+        if (systemMemory) {
+            memcpy_s(buffer->getCpuAddress(), size, hostPtr, size);
+        } else if (CL_SUCCESS != context.getSpecialQueue()->enqueueWriteBuffer(buffer, CL_TRUE, 0, size, hostPtr, nullptr, 0, nullptr, nullptr)) {
+            errcodeRet = CL_OUT_OF_RESOURCES;
+            buffer->release();
+            return nullptr;
+        }
+    }
+
+    return buffer;
+}
+
+void BufferPoolAllocator::releaseBuffer(Buffer &buffer) {
+    auto allocation = buffer.getGraphicsAllocation();
+
+    PendingFree pendingFree{nullptr, allocation->getGpuAddress() + buffer.getPoolOffset(), buffer.pooledAllocationSize, {}};
+    for (auto &engine : memoryManager->getRegisteredEngines()) {
+        auto osContextId = engine.osContext->getContextId();
+        auto allocationTaskCount = allocation->getTaskCount(osContextId);
+        if (allocation->isUsedByOsContext(osContextId) &&
+            allocationTaskCount > *engine.commandStreamReceiver->getTagAddress()) {
+            pendingFree.usages.emplace_back(engine.commandStreamReceiver, allocationTaskCount);
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(mtx);
+    pendingFree.pool = findPool(allocation);
+    UNRECOVERABLE_IF(pendingFree.pool == nullptr);
+    requestedSize -= buffer.getSize();
+    buffersCount--;
+
+    // Chunk may still be accessed by GPU, it is reused only after all engines pass the allocation's task counts
+    if (pendingFree.usages.empty()) {
+        pendingFree.pool->chunkAllocator->free(pendingFree.address, pendingFree.size);
+    } else {
+        pendingFrees.push_back(std::move(pendingFree));
+    }
+}
+
+void BufferPoolAllocator::recordFallback() {
+    std::lock_guard<std::mutex> lock(mtx);
+    fallbacks++;
+}
+
+BufferPoolStatistics BufferPoolAllocator::getStatistics() {
+    std::lock_guard<std::mutex> lock(mtx);
+    BufferPoolStatistics statistics;
+    for (auto &pool : pools) {
+        statistics.poolsSize += poolSize;
+        statistics.allocatedSize += pool->chunkAllocator->getUsedSize();
+    }
+    for (auto &pendingFree : pendingFrees) {
+        statistics.pendingFreeSize += pendingFree.size;
+    }
+    statistics.allocatedSize -= statistics.pendingFreeSize;
+    statistics.requestedSize = requestedSize;
+    statistics.poolsCount = static_cast<uint32_t>(pools.size());
+    statistics.buffersCount = buffersCount;
+    statistics.pooledBuffersCreated = pooledBuffersCreated;
+    statistics.fallbacks = fallbacks;
+    return statistics;
+}
+
+BufferPoolAllocator::Pool *BufferPoolAllocator::createPool() {
+    auto rootDeviceIndex = context.getDevice(0)->getRootDeviceIndex();
+    AllocationProperties allocProperties = MemoryPropertiesParser::getAllocationProperties(rootDeviceIndex, {}, true, poolSize,
+                                                                                           GraphicsAllocation::AllocationType::BUFFER,
+                                                                                           context.areMultiStorageAllocationsPreferred());
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(allocProperties);
+    if (!allocation) {
+        return nullptr;
+    }
+
+    if (MemoryPool::isSystemMemoryPool(allocation->getMemoryPool())) {
+        allocation->setAllocationType(GraphicsAllocation::AllocationType::BUFFER_HOST_MEMORY);
+        memoryManager->addAllocationToHostPtrManager(allocation);
+    }
+    allocation->setMemObjectsAllocationWithWritableFlags(true);
+
+    auto pool = std::make_unique<Pool>();
+    pool->allocation = allocation;
+    pool->chunkAllocator = std::make_unique<HeapAllocator>(allocation->getGpuAddress(), poolSize, poolSize, chunkAlignment);
+    pools.push_back(std::move(pool));
+    return pools.back().get();
+}
+
+uint64_t BufferPoolAllocator::allocateChunk(size_t &size, Pool *&pool) {
+    reclaimCompletedChunks();
+
+    size_t sizeToAllocate = size;
+    for (auto &existingPool : pools) {
+        sizeToAllocate = size;
+        auto address = existingPool->chunkAllocator->allocate(sizeToAllocate);
+        if (address != 0u) {
+            size = sizeToAllocate;
+            pool = existingPool.get();
+            return address;
+        }
+    }
+
+    pool = createPool();
+    if (pool == nullptr) {
+        return 0u;
+    }
+    auto address = pool->chunkAllocator->allocate(size);
+    return address;
+}
+
+void BufferPoolAllocator::reclaimCompletedChunks() {
+    auto isCompleted = [](const PendingFree &pendingFree) {
+        for (auto &usage : pendingFree.usages) {
+            if (usage.second > *usage.first->getTagAddress()) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    for (auto it = pendingFrees.begin(); it != pendingFrees.end();) {
+        if (isCompleted(*it)) {
+            it->pool->chunkAllocator->free(it->address, it->size);
+            it = pendingFrees.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+BufferPoolAllocator::Pool *BufferPoolAllocator::findPool(const GraphicsAllocation *allocation) {
+    for (auto &pool : pools) {
+        if (pool->allocation == allocation) {
+            return pool.get();
+        }
+    }
+    return nullptr;
+}
+} // namespace NEO
@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/memory_manager/memory_constants.h"
+#include "shared/source/utilities/heap_allocator.h"
+
+#include "CL/cl.h"
+#include "memory_properties_flags.h"
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+class Buffer;
+class CommandStreamReceiver;
+class Context;
+class GraphicsAllocation;
+class MemoryManager;
+
+struct BufferPoolStatistics {
+    uint64_t poolsSize = 0u;
+    uint64_t allocatedSize = 0u;
+    uint64_t requestedSize = 0u;
+    uint64_t pendingFreeSize = 0u;
+    uint32_t poolsCount = 0u;
+    uint32_t buffersCount = 0u;
+    uint64_t pooledBuffersCreated = 0u;
+    uint64_t fallbacks = 0u;
+};
+
+// Carves small buffers out of shared pool allocations, so that they do not cost a BO / residency entry each.
+// Pooled buffers are regular Buffer objects placed at an offset in the pool allocation, the same way sub-buffers are.
+class BufferPoolAllocator {
+  public:
+    static constexpr size_t poolSize = 2 * MemoryConstants::megaByte;
+    static constexpr size_t defaultSmallBufferThreshold = 4 * MemoryConstants::kiloByte;
+
+    BufferPoolAllocator(Context &context);
+    ~BufferPoolAllocator();
+
+    static bool isEnabled();
+
+    bool isSizeSuitable(size_t size) const { return size <= smallBufferThreshold; }
+    static bool areFlagsSuitable(const MemoryPropertiesFlags &memoryProperties, cl_mem_flags flags, cl_mem_flags_intel flagsIntel);
+
+    // Returns nullptr with CL_SUCCESS when buffer cannot be pooled and regular allocation should be used
+    Buffer *createBuffer(const MemoryPropertiesFlags &memoryProperties,
+                         cl_mem_flags flags,
+                         size_t size,
+                         void *hostPtr,
+                         cl_int &errcodeRet);
+    void releaseBuffer(Buffer &buffer);
+    void recordFallback();
+
+    BufferPoolStatistics getStatistics();
+
+  protected:
+    struct Pool {
+        GraphicsAllocation *allocation = nullptr;
+        std::unique_ptr<HeapAllocator> chunkAllocator;
+    };
+
+    struct PendingFree {
+        Pool *pool;
+        uint64_t address;
+        size_t size;
+        std::vector<std::pair<CommandStreamReceiver *, uint32_t>> usages;
+    };
+
+    Pool *createPool();
+    uint64_t allocateChunk(size_t &size, Pool *&pool);
+    void reclaimCompletedChunks();
+    Pool *findPool(const GraphicsAllocation *allocation);
+
+    Context &context;
+    MemoryManager *memoryManager;
+    size_t smallBufferThreshold = defaultSmallBufferThreshold;
+    size_t chunkAlignment = MemoryConstants::cacheLineSize;
+
+    std::vector<std::unique_ptr<Pool>> pools;
+    std::vector<PendingFree> pendingFrees;
+    std::mutex mtx;
+
+    uint64_t requestedSize = 0u;
+    uint32_t buffersCount = 0u;
+    uint64_t pooledBuffersCreated = 0u;
+    uint64_t fallbacks = 0u;
+};
+} // namespace NEO
@@ -23,6 +23,7 @@
 #include "opencl/source/command_queue/command_queue.h"
 #include "opencl/source/context/context.h"
 #include "opencl/source/device/cl_device.h"
+#include "opencl/source/helpers/cpu_copy.h"
 #include "opencl/source/helpers/get_info_status_mapper.h"
 #include "opencl/source/helpers/gmm_types_converter.h"
 #include "opencl/source/helpers/memory_properties_flags_helpers.h"
@@ -97,18 +98,12 @@ void Image::transferData(void *dest, size_t destRowPitch, size_t destSlicePitch,
         std::swap(copyRegion[1], copyRegion[2]);
     }
 
-    for (size_t slice = copyOrigin[2]; slice < (copyOrigin[2] + copyRegion[2]); slice++) {
-        auto srcSliceOffset = ptrOffset(src, srcSlicePitch * slice);
-        auto dstSliceOffset = ptrOffset(dest, destSlicePitch * slice);
+    auto srcOrigin = ptrOffset(src, srcSlicePitch * copyOrigin[2] + srcRowPitch * copyOrigin[1] + copyOrigin[0] * pixelSize);
+    auto dstOrigin = ptrOffset(dest, destSlicePitch * copyOrigin[2] + destRowPitch * copyOrigin[1] + copyOrigin[0] * pixelSize);
 
-        for (size_t height = copyOrigin[1]; height < (copyOrigin[1] + copyRegion[1]); height++) {
-            auto srcRowOffset = ptrOffset(srcSliceOffset, srcRowPitch * height);
-            auto dstRowOffset = ptrOffset(dstSliceOffset, destRowPitch * height);
-
-            memcpy_s(ptrOffset(dstRowOffset, copyOrigin[0] * pixelSize), lineWidth,
-                     ptrOffset(srcRowOffset, copyOrigin[0] * pixelSize), lineWidth);
-        }
-    }
+    CpuCopyHelper::copyRegion(dstOrigin, destRowPitch, destSlicePitch,
+                              srcOrigin, srcRowPitch, srcSlicePitch,
+                              {{lineWidth, copyRegion[1], copyRegion[2]}});
 }
 
 Image::~Image() = default;
@@ -141,38 +141,63 @@ class Image : public MemObj {
     ImageCreatFunc createFunction;
 
     uint32_t getQPitch() { return qPitch; }
-    void setQPitch(uint32_t qPitch) { this->qPitch = qPitch; }
+    void setQPitch(uint32_t qPitch) {
+        this->qPitch = qPitch;
+        invalidateSurfaceStateTemplates();
+    }
     size_t getHostPtrRowPitch() const { return hostPtrRowPitch; }
     void setHostPtrRowPitch(size_t pitch) { this->hostPtrRowPitch = pitch; }
     size_t getHostPtrSlicePitch() const { return hostPtrSlicePitch; }
     void setHostPtrSlicePitch(size_t pitch) { this->hostPtrSlicePitch = pitch; }
     size_t getImageCount() const { return imageCount; }
     void setImageCount(size_t imageCount) { this->imageCount = imageCount; }
-    void setImageRowPitch(size_t rowPitch) { imageDesc.image_row_pitch = rowPitch; }
-    void setImageSlicePitch(size_t slicePitch) { imageDesc.image_slice_pitch = slicePitch; }
+    void setImageRowPitch(size_t rowPitch) {
+        imageDesc.image_row_pitch = rowPitch;
+        invalidateSurfaceStateTemplates();
+    }
+    void setImageSlicePitch(size_t slicePitch) {
+        imageDesc.image_slice_pitch = slicePitch;
+        invalidateSurfaceStateTemplates();
+    }
     void setSurfaceOffsets(uint64_t offset, uint32_t xOffset, uint32_t yOffset, uint32_t yOffsetForUVPlane) {
         surfaceOffsets.offset = offset;
         surfaceOffsets.xOffset = xOffset;
         surfaceOffsets.yOffset = yOffset;
         surfaceOffsets.yOffsetForUVplane = yOffsetForUVPlane;
+        invalidateSurfaceStateTemplates();
     }
     void getSurfaceOffsets(SurfaceOffsets &surfaceOffsetsOut) { surfaceOffsetsOut = this->surfaceOffsets; }
 
-    void setCubeFaceIndex(uint32_t index) { cubeFaceIndex = index; }
+    void setCubeFaceIndex(uint32_t index) {
+        cubeFaceIndex = index;
+        invalidateSurfaceStateTemplates();
+    }
     uint32_t getCubeFaceIndex() { return cubeFaceIndex; }
-    void setMediaPlaneType(cl_uint type) { mediaPlaneType = type; }
+    void setMediaPlaneType(cl_uint type) {
+        mediaPlaneType = type;
+        invalidateSurfaceStateTemplates();
+    }
     cl_uint getMediaPlaneType() const { return mediaPlaneType; }
     int peekBaseMipLevel() { return baseMipLevel; }
-    void setBaseMipLevel(int level) { this->baseMipLevel = level; }
+    void setBaseMipLevel(int level) {
+        this->baseMipLevel = level;
+        invalidateSurfaceStateTemplates();
+    }
 
     uint32_t peekMipCount() { return mipCount; }
-    void setMipCount(uint32_t mipCountNew) { this->mipCount = mipCountNew; }
+    void setMipCount(uint32_t mipCountNew) {
+        this->mipCount = mipCountNew;
+        invalidateSurfaceStateTemplates();
+    }
 
     static const ClSurfaceFormatInfo *getSurfaceFormatFromTable(cl_mem_flags flags, const cl_image_format *imageFormat, unsigned int clVersionSupport);
     static cl_int validateRegionAndOrigin(const size_t *origin, const size_t *region, const cl_image_desc &imgDesc);
 
     cl_int writeNV12Planes(const void *hostPtr, size_t hostPtrRowPitch);
-    void setMcsSurfaceInfo(const McsSurfaceInfo &info) { mcsSurfaceInfo = info; }
+    void setMcsSurfaceInfo(const McsSurfaceInfo &info) {
+        mcsSurfaceInfo = info;
+        invalidateSurfaceStateTemplates();
+    }
     const McsSurfaceInfo &getMcsSurfaceInfo() { return mcsSurfaceInfo; }
     size_t calculateOffsetForMapping(const MemObjOffsetArray &origin) const override;
 
@@ -285,6 +310,7 @@ class ImageHw : public Image {
     }
 
     void setImageArg(void *memory, bool setAsMediaBlockImage, uint32_t mipLevel) override;
+    void programImageSurfaceState(RENDER_SURFACE_STATE *surfaceState, bool setAsMediaBlockImage, uint32_t mipLevel);
     void setAuxParamsForMultisamples(RENDER_SURFACE_STATE *surfaceState);
     MOCKABLE_VIRTUAL void setAuxParamsForMCSCCS(RENDER_SURFACE_STATE *surfaceState, Gmm *gmm);
     void setMediaImageArg(void *memory) override;
@@ -351,5 +377,6 @@ class ImageHw : public Image {
         return inputShaderChannel;
     }
     typename RENDER_SURFACE_STATE::SURFACE_TYPE surfaceType;
+    SurfaceStateTemplateCache<RENDER_SURFACE_STATE> surfaceStateTemplates;
 };
 } // namespace NEO
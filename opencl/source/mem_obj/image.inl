@@ -30,8 +30,22 @@ union SURFACE_STATE_BUFFER_LENGTH {
 
 template <typename GfxFamily>
 void ImageHw<GfxFamily>::setImageArg(void *memory, bool setAsMediaBlockImage, uint32_t mipLevel) {
+    if (!areSurfaceStateTemplatesEnabled()) {
+        programImageSurfaceState(reinterpret_cast<RENDER_SURFACE_STATE *>(memory), setAsMediaBlockImage, mipLevel);
+        return;
+    }
+
+    uint64_t key = (static_cast<uint64_t>(mipLevel) << 1) | (setAsMediaBlockImage ? 1u : 0u);
+    auto stamp = getSurfaceStateTemplateStamp(getGraphicsAllocation()->getGpuAddress());
+    surfaceStateTemplates.copySurfaceState(memory, key, stamp, [&](RENDER_SURFACE_STATE *surfaceState) {
+        *surfaceState = GfxFamily::cmdInitRenderSurfaceState;
+        programImageSurfaceState(surfaceState, setAsMediaBlockImage, mipLevel);
+    });
+}
+
+template <typename GfxFamily>
+void ImageHw<GfxFamily>::programImageSurfaceState(RENDER_SURFACE_STATE *surfaceState, bool setAsMediaBlockImage, uint32_t mipLevel) {
     using SURFACE_FORMAT = typename RENDER_SURFACE_STATE::SURFACE_FORMAT;
-    auto surfaceState = reinterpret_cast<RENDER_SURFACE_STATE *>(memory);
 
     auto gmm = getGraphicsAllocation()->getDefaultGmm();
     auto gmmHelper = rootDeviceEnvironment->getGmmHelper();
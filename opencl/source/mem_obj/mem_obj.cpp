@@ -124,6 +124,7 @@ cl_int MemObj::getMemObjectInfo(cl_mem_info paramName,
     cl_uint refCnt = 0;
     cl_uint mapCount = 0;
     cl_mem clAssociatedMemObject = static_cast<cl_mem>(this->associatedMemObject);
+    size_t clOffset = offset - poolOffset;
     cl_context ctx = nullptr;
     uint64_t internalHandle = 0llu;
 
@@ -161,8 +162,8 @@ cl_int MemObj::getMemObjectInfo(cl_mem_info paramName,
         break;
 
     case CL_MEM_OFFSET:
-        srcParamSize = sizeof(offset);
-        srcParam = &offset;
+        srcParamSize = sizeof(clOffset);
+        srcParam = &clOffset;
         break;
 
     case CL_MEM_ASSOCIATED_MEMOBJECT:
@@ -254,6 +255,21 @@ void MemObj::resetGraphicsAllocation(GraphicsAllocation *newGraphicsAllocation)
     }
 
     graphicsAllocation = newGraphicsAllocation;
+    invalidateSurfaceStateTemplates();
+}
+
+SurfaceStateTemplateStamp MemObj::getSurfaceStateTemplateStamp(uint64_t address) const {
+    SurfaceStateTemplateStamp stamp;
+    stamp.allocation = graphicsAllocation;
+    stamp.mcsAllocation = mcsAllocation;
+    stamp.address = address;
+    stamp.version = surfaceStateVersion;
+    if (graphicsAllocation) {
+        stamp.gmm = graphicsAllocation->getDefaultGmm();
+        stamp.allocationType = static_cast<uint32_t>(graphicsAllocation->getAllocationType());
+        stamp.renderCompressed = stamp.gmm && stamp.gmm->isRenderCompressed;
+    }
+    return stamp;
 }
 
 bool MemObj::readMemObjFlagsInvalid() {
@@ -13,6 +13,7 @@
 #include "opencl/source/helpers/base_object.h"
 #include "opencl/source/helpers/mipmap.h"
 #include "opencl/source/mem_obj/map_operations_handler.h"
+#include "opencl/source/mem_obj/surface_state_template_cache.h"
 #include "opencl/source/sharings/sharing.h"
 
 #include "memory_properties_flags.h"
@@ -112,6 +113,7 @@ class MemObj : public BaseObject<_cl_mem> {
     size_t calculateMappedPtrLength(const MemObjSizeArray &size) const { return calculateOffsetForMapping(size); }
     cl_mem_object_type peekClMemObjType() const { return memObjectType; }
     size_t getOffset() const { return offset; }
+    size_t getPoolOffset() const { return poolOffset; }
     MemoryManager *getMemoryManager() const {
         return memoryManager;
     }
@@ -128,8 +130,12 @@ class MemObj : public BaseObject<_cl_mem> {
     const cl_mem_flags &getMemoryPropertiesFlags() const { return flags; }
     const cl_mem_flags &getMemoryPropertiesFlagsIntel() const { return flagsIntel; }
 
+    void invalidateSurfaceStateTemplates() { surfaceStateVersion++; }
+    static bool areSurfaceStateTemplatesEnabled() { return DebugManager.flags.EnableSurfaceStateTemplates.get() != 0; }
+
   protected:
     void getOsSpecificMemObjectInfo(const cl_mem_info &paramName, size_t *srcParamSize, void **srcParam);
+    SurfaceStateTemplateStamp getSurfaceStateTemplateStamp(uint64_t address) const;
 
     Context *context;
     cl_mem_object_type memObjectType;
@@ -143,6 +149,8 @@ class MemObj : public BaseObject<_cl_mem> {
     void *allocatedMapPtr = nullptr;
     MapOperationsHandler mapOperationsHandler;
     size_t offset = 0;
+    // offset of pooled allocation within shared graphics allocation, not visible to application
+    size_t poolOffset = 0;
     MemObj *associatedMemObject = nullptr;
     cl_uint refCount = 0;
     ExecutionEnvironment *executionEnvironment = nullptr;
@@ -155,6 +163,7 @@ class MemObj : public BaseObject<_cl_mem> {
     GraphicsAllocation *mcsAllocation = nullptr;
     GraphicsAllocation *mapAllocation = nullptr;
     std::shared_ptr<SharingHandler> sharingHandler;
+    uint32_t surfaceStateVersion = 0u;
 
     class DestructorCallback {
       public:
@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/string.h"
+
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+class GraphicsAllocation;
+class Gmm;
+
+// State of memory object that surface states were programmed for, any difference invalidates cached templates
+struct SurfaceStateTemplateStamp {
+    const GraphicsAllocation *allocation = nullptr;
+    const GraphicsAllocation *mcsAllocation = nullptr;
+    const Gmm *gmm = nullptr;
+    uint64_t address = 0u;
+    uint32_t allocationType = 0u;
+    uint32_t version = 0u;
+    bool renderCompressed = false;
+
+    bool operator==(const SurfaceStateTemplateStamp &other) const {
+        return allocation == other.allocation && mcsAllocation == other.mcsAllocation && gmm == other.gmm &&
+               address == other.address && allocationType == other.allocationType && version == other.version &&
+               renderCompressed == other.renderCompressed;
+    }
+};
+
+// Fully programmed surface states of memory object, keyed by kernel argument properties (mip level, media block, cache policy).
+// Setting the object as kernel argument copies cached template instead of programming surface state from scratch.
+template <typename SurfaceState>
+class SurfaceStateTemplateCache {
+  public:
+    static constexpr size_t maxTemplatesCount = 16u;
+
+    template <typename ProgramSurfaceStateT>
+    void copySurfaceState(void *destination, uint64_t key, const SurfaceStateTemplateStamp &stamp, ProgramSurfaceStateT &&programSurfaceState) {
+        std::lock_guard<std::mutex> lock(mtx);
+        if (!(stamp == this->stamp)) {
+            templates.clear();
+            this->stamp = stamp;
+        }
+
+        const SurfaceState *surfaceState = nullptr;
+        for (auto &surfaceStateTemplate : templates) {
+            if (surfaceStateTemplate.key == key) {
+                surfaceState = &surfaceStateTemplate.surfaceState;
+                break;
+            }
+        }
+        if (surfaceState == nullptr) {
+            if (templates.size() == maxTemplatesCount) {
+                templates.erase(templates.begin());
+            }
+            templates.push_back({key, {}});
+            programSurfaceState(&templates.back().surfaceState);
+            surfaceState = &templates.back().surfaceState;
+        }
+        memcpy_s(destination, sizeof(SurfaceState), surfaceState, sizeof(SurfaceState));
+    }
+
+    size_t getTemplatesCount() {
+        std::lock_guard<std::mutex> lock(mtx);
+        return templates.size();
+    }
+
+  protected:
+    struct SurfaceStateTemplate {
+        uint64_t key;
+        SurfaceState surfaceState;
+    };
+
+    std::mutex mtx;
+    SurfaceStateTemplateStamp stamp;
+    std::vector<SurfaceStateTemplate> templates;
+};
+
+template <typename SurfaceState>
+constexpr size_t SurfaceStateTemplateCache<SurfaceState>::maxTemplatesCount;
+} // namespace NEO
@@ -165,6 +165,14 @@ GraphicsAllocation *OsAgnosticMemoryManager::createGraphicsAllocationFromSharedH
     return graphicsAllocation;
 }
 
+GraphicsAllocation *OsAgnosticMemoryManager::createGraphicsAllocationFromHostPtrMapping(const AllocationProperties &properties, void *hostPtr) {
+    if (isLimitedRange(properties.rootDeviceIndex) || hostPtr == nullptr) {
+        return nullptr;
+    }
+    return createMemoryAllocation(properties.allocationType, nullptr, hostPtr, reinterpret_cast<uint64_t>(hostPtr), properties.size, counter++,
+                                  MemoryPool::System4KBPages, properties.rootDeviceIndex, false, false, false);
+}
+
 void OsAgnosticMemoryManager::addAllocationToHostPtrManager(GraphicsAllocation *gfxAllocation) {
     FragmentStorage fragment = {};
     fragment.driverAllocation = true;
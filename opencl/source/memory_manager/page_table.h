@@ -7,9 +7,12 @@
 
 #pragma once
 #include "shared/source/helpers/basic_math.h"
+#include "shared/source/memory_manager/memory_constants.h"
 
+#include "opencl/source/aub_mem_dump/page_table_entry_bits.h"
 #include "opencl/source/memory_manager/physical_address_allocator.h"
 
+#include <algorithm>
 #include <array>
 #include <atomic>
 #include <cinttypes>
@@ -22,6 +25,42 @@ namespace NEO {
 class GraphicsAllocation;
 
 typedef std::function<void(uint64_t addr, size_t size, size_t offset, uint64_t entryBits)> PageWalker;
+
+template <typename RangeWalkerT>
+class PhysicalRangeCoalescer {
+  public:
+    // Every range is reserved with a single PTE memory write whose dword count is limited to 16 bits
+    static constexpr size_t maxRangeSize = 16384 * MemoryConstants::pageSize;
+
+    PhysicalRangeCoalescer(RangeWalkerT &rangeWalker) : rangeWalker(rangeWalker) {}
+
+    void operator()(uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {
+        if (rangeSize != 0u && physAddress == rangePhysAddress + rangeSize && entryBits == rangeEntryBits && rangeSize + size <= maxRangeSize) {
+            rangeSize += size;
+            return;
+        }
+        flush();
+        rangePhysAddress = physAddress;
+        rangeSize = size;
+        rangeOffset = offset;
+        rangeEntryBits = entryBits;
+    }
+
+    void flush() {
+        if (rangeSize != 0u) {
+            rangeWalker(rangePhysAddress, rangeSize, rangeOffset, rangeEntryBits);
+            rangeSize = 0u;
+        }
+    }
+
+  protected:
+    RangeWalkerT &rangeWalker;
+    uint64_t rangePhysAddress = 0u;
+    size_t rangeSize = 0u;
+    size_t rangeOffset = 0u;
+    uint64_t rangeEntryBits = 0u;
+};
+
 template <class T, uint32_t level, uint32_t bits = 9>
 class PageTable {
   public:
@@ -37,6 +76,19 @@ class PageTable {
     virtual uintptr_t map(uintptr_t vm, size_t size, uint64_t entryBits, uint32_t memoryBank);
     virtual void pageWalk(uintptr_t vm, size_t size, size_t offset, uint64_t entryBits, PageWalker &pageWalker, uint32_t memoryBank);
 
+    // Walks all levels without virtual calls, pageCallback is invoked for every 4KB page
+    template <typename PageCallbackT>
+    void walkPages(uintptr_t vm, size_t size, size_t offset, uint64_t entryBits, PageCallbackT &pageCallback, uint32_t memoryBank);
+
+    // rangeWalker is invoked once for every run of pages contiguous in physical memory and having same entry bits,
+    // runs longer than PhysicalRangeCoalescer::maxRangeSize are reported in parts
+    template <typename RangeWalkerT>
+    void rangeWalk(uintptr_t vm, size_t size, size_t offset, uint64_t entryBits, RangeWalkerT &rangeWalker, uint32_t memoryBank) {
+        PhysicalRangeCoalescer<RangeWalkerT> coalescer(rangeWalker);
+        walkPages(vm, size, offset, entryBits, coalescer, memoryBank);
+        coalescer.flush();
+    }
+
     static const size_t pageSize = 1 << 12;
     static size_t getBits() {
         return T::getBits() + bits;
@@ -58,6 +110,36 @@ class PTE : public PageTable<void, 0u> {
     uintptr_t map(uintptr_t vm, size_t size, uint64_t entryBits, uint32_t memoryBank) override;
     void pageWalk(uintptr_t vm, size_t size, size_t offset, uint64_t entryBits, PageWalker &pageWalker, uint32_t memoryBank) override;
 
+    template <typename PageCallbackT>
+    void walkPages(uintptr_t vm, size_t size, size_t offset, uint64_t entryBits, PageCallbackT &pageCallback, uint32_t memoryBank) {
+        const size_t shift = 12;
+        const auto mask = static_cast<uint32_t>(maxNBitValue(bits));
+        size_t indexStart = (vm >> shift) & mask;
+        size_t indexEnd = ((vm + size - 1) >> shift) & mask;
+        uint64_t res = -1;
+        uintptr_t rem = vm & (pageSize - 1);
+        bool updateEntryBits = entryBits != PageTableEntry::nonValidBits;
+        uint64_t newEntryBits = entryBits & MemoryConstants::pageMask;
+        newEntryBits |= 0x1;
+
+        for (size_t index = indexStart; index <= indexEnd; index++) {
+            if (entries[index] == 0x0) {
+                uint64_t tmp = allocator->reserve4kPage(memoryBank);
+                entries[index] = reinterpret_cast<void *>(tmp | newEntryBits);
+            } else if (updateEntryBits) {
+                entries[index] = reinterpret_cast<void *>((reinterpret_cast<uintptr_t>(entries[index]) & MemoryConstants::page4kEntryMask) | newEntryBits);
+            }
+            res = reinterpret_cast<uintptr_t>(entries[index]) & MemoryConstants::page4kEntryMask;
+
+            size_t lSize = std::min(pageSize - rem, size);
+            pageCallback((res & ~0x1) + rem, lSize, offset, reinterpret_cast<uintptr_t>(entries[index]) & MemoryConstants::pageMask);
+
+            size -= lSize;
+            offset += lSize;
+            rem = 0;
+        }
+    }
+
     static const uint32_t level = 0;
     static const uint32_t bits = 9;
 };
@@ -85,4 +167,29 @@ class PDPE : public PageTable<class PDE, 2, 2> {
     PDPE(PhysicalAddressAllocator *physicalAddressAllocator) : PageTable<class PDE, 2, 2>(physicalAddressAllocator) {
     }
 };
+
+template <class T, uint32_t level, uint32_t bits>
+template <typename PageCallbackT>
+inline void PageTable<T, level, bits>::walkPages(uintptr_t vm, size_t size, size_t offset, uint64_t entryBits, PageCallbackT &pageCallback, uint32_t memoryBank) {
+    const size_t shift = T::getBits() + 12;
+    const uintptr_t mask = static_cast<uintptr_t>(maxNBitValue(bits));
+    size_t indexStart = (vm >> shift) & mask;
+    size_t indexEnd = ((vm + size - 1) >> shift) & mask;
+    uintptr_t vmMask = (uintptr_t(-1) >> (sizeof(void *) * 8 - shift - bits));
+    auto maskedVm = vm & vmMask;
+
+    for (size_t index = indexStart; index <= indexEnd; index++) {
+        uintptr_t vmStart = (uintptr_t(1) << shift) * index;
+        vmStart = std::max(vmStart, maskedVm);
+        uintptr_t vmEnd = (uintptr_t(1) << shift) * (index + 1) - 1;
+        vmEnd = std::min(vmEnd, maskedVm + size - 1);
+
+        if (entries[index] == nullptr) {
+            entries[index] = new T(allocator);
+        }
+        entries[index]->walkPages(vmStart, vmEnd - vmStart + 1, offset, entryBits, pageCallback, memoryBank);
+
+        offset += (vmEnd - vmStart + 1);
+    }
+}
 } // namespace NEO
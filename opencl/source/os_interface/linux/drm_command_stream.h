@@ -36,11 +36,14 @@ class DrmCommandStreamReceiver : public DeviceCommandStreamReceiver<GfxFamily> {
     // When drm is passed, DCSR will not free it at destruction
     DrmCommandStreamReceiver(ExecutionEnvironment &executionEnvironment, uint32_t rootDeviceIndex,
                              gemCloseWorkerMode mode = gemCloseWorkerMode::gemCloseWorkerActive);
+    ~DrmCommandStreamReceiver() override;
 
     bool flush(BatchBuffer &batchBuffer, ResidencyContainer &allocationsForResidency) override;
     void processResidency(const ResidencyContainer &allocationsForResidency, uint32_t handleId) override;
     void makeNonResident(GraphicsAllocation &gfxAllocation) override;
     bool waitForFlushStamp(FlushStamp &flushStampToWait) override;
+    bool initDirectSubmission(Device &device, OsContext &osContext) override;
+    void releaseDirectSubmissionResidency(uint64_t session) override;
 
     DrmMemoryManager *getMemoryManager() const;
     GmmPageTableMngr *createPageTableManager() override;
@@ -52,11 +55,14 @@ class DrmCommandStreamReceiver : public DeviceCommandStreamReceiver<GfxFamily> {
   protected:
     void makeResidentBufferObjects(const DrmAllocation *drmAllocation, uint32_t handleId);
     void makeResident(BufferObject *bo);
+    std::unique_lock<std::mutex> processMemoryOperationsResidency(const ResidencyContainer &allocationsForResidency, uint32_t handleId);
     void flushInternal(const BatchBuffer &batchBuffer, const ResidencyContainer &allocationsForResidency);
     void exec(const BatchBuffer &batchBuffer, uint32_t drmContextId);
+    bool flushDirectSubmission(BatchBuffer &batchBuffer, ResidencyContainer &allocationsForResidency);
 
     std::vector<BufferObject *> residency;
     std::vector<drm_i915_gem_exec_object2> execObjectsStorage;
+    ResidencyContainer memoryOperationsResidency;
     Drm *drm;
     gemCloseWorkerMode gemCloseWorkerOperationMode;
 };
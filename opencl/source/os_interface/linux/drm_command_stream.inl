@@ -6,6 +6,10 @@
  */
 
 #include "shared/source/command_stream/linear_stream.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/direct_submission/dispatchers/blitter_dispatcher.h"
+#include "shared/source/direct_submission/dispatchers/render_dispatcher.h"
+#include "shared/source/direct_submission/linux/drm_direct_submission.h"
 #include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/gmm_helper/gmm_helper.h"
 #include "shared/source/gmm_helper/page_table_mngr.h"
@@ -37,6 +41,11 @@ DrmCommandStreamReceiver<GfxFamily>::DrmCommandStreamReceiver(ExecutionEnvironme
     execObjectsStorage.reserve(512);
 }
 
+template <typename GfxFamily>
+DrmCommandStreamReceiver<GfxFamily>::~DrmCommandStreamReceiver() {
+    this->stopImplicitFlushTimer();
+}
+
 template <typename GfxFamily>
 bool DrmCommandStreamReceiver<GfxFamily>::flush(BatchBuffer &batchBuffer, ResidencyContainer &allocationsForResidency) {
     DrmAllocation *alloc = static_cast<DrmAllocation *>(batchBuffer.commandBufferAllocation);
@@ -53,6 +62,10 @@ bool DrmCommandStreamReceiver<GfxFamily>::flush(BatchBuffer &batchBuffer, Reside
         }
     }
 
+    if (this->directSubmission.get()) {
+        return this->flushDirectSubmission(batchBuffer, allocationsForResidency);
+    }
+
     this->flushStamp->setStamp(bb->peekHandle());
     this->flushInternal(batchBuffer, allocationsForResidency);
 
@@ -90,6 +103,32 @@ void DrmCommandStreamReceiver<GfxFamily>::exec(const BatchBuffer &batchBuffer, u
     this->residency.clear();
 }
 
+template <typename GfxFamily>
+bool DrmCommandStreamReceiver<GfxFamily>::flushDirectSubmission(BatchBuffer &batchBuffer, ResidencyContainer &allocationsForResidency) {
+    this->processResidency(allocationsForResidency, 0u);
+    auto memoryOperationsLock = this->processMemoryOperationsResidency(allocationsForResidency, 0u);
+    makeResident(static_cast<DrmAllocation *>(batchBuffer.commandBufferAllocation)->getBO());
+
+    // BOs are bound by the ring itself, no exec of the command buffer is needed,
+    // queued BOs are executed while dispatching so lock is held until dispatch completes
+    auto drmDirectSubmission = static_cast<DrmDirectSubmission<GfxFamily> *>(this->directSubmission.get());
+    drmDirectSubmission->makeResident(this->residency.data(), this->residency.size());
+    this->residency.clear();
+
+    return this->directSubmission->dispatchCommandBuffer(batchBuffer, *this->flushStamp.get());
+}
+
+template <typename GfxFamily>
+void DrmCommandStreamReceiver<GfxFamily>::releaseDirectSubmissionResidency(uint64_t session) {
+    auto drmDirectSubmission = static_cast<DrmDirectSubmission<GfxFamily> *>(this->directSubmission.get());
+    // sessions are unique across rings, ownership is taken only by the ring which bound the buffer object
+    if (drmDirectSubmission == nullptr || drmDirectSubmission->peekRingSession() != session) {
+        return;
+    }
+    auto lock = this->obtainUniqueOwnership();
+    drmDirectSubmission->releaseResidency(session);
+}
+
 template <typename GfxFamily>
 void DrmCommandStreamReceiver<GfxFamily>::makeResident(BufferObject *bo) {
     if (bo) {
@@ -123,6 +162,42 @@ void DrmCommandStreamReceiver<GfxFamily>::processResidency(const ResidencyContai
     }
 }
 
+template <typename GfxFamily>
+std::unique_lock<std::mutex> DrmCommandStreamReceiver<GfxFamily>::processMemoryOperationsResidency(const ResidencyContainer &allocationsForResidency, uint32_t handleId) {
+    auto memoryOperationsInterface = this->executionEnvironment.rootDeviceEnvironments[this->rootDeviceIndex]->memoryOperationsInterface.get();
+    if (memoryOperationsInterface == nullptr) {
+        return std::unique_lock<std::mutex>();
+    }
+
+    memoryOperationsResidency.clear();
+    auto lock = memoryOperationsInterface->mergeWithResidencyContainer(allocationsForResidency, memoryOperationsResidency);
+
+    // Explicitly resident allocations are not made non resident after submission,
+    // fragments are marked resident only while buffer objects for this exec are collected
+    const auto osContextId = osContext->getContextId();
+    std::vector<ResidencyData *> markedFragments;
+    for (auto &alloc : memoryOperationsResidency) {
+        auto drmAlloc = static_cast<const DrmAllocation *>(alloc);
+        if (drmAlloc->fragmentsStorage.fragmentCount) {
+            for (unsigned int f = 0; f < drmAlloc->fragmentsStorage.fragmentCount; f++) {
+                auto fragmentResidency = drmAlloc->fragmentsStorage.fragmentStorageData[f].residency;
+                if (!fragmentResidency->resident[osContextId]) {
+                    makeResident(drmAlloc->fragmentsStorage.fragmentStorageData[f].osHandleStorage->bo);
+                    fragmentResidency->resident[osContextId] = true;
+                    markedFragments.push_back(fragmentResidency);
+                }
+            }
+        } else {
+            makeResidentBufferObjects(drmAlloc, handleId);
+        }
+    }
+    for (auto fragmentResidency : markedFragments) {
+        fragmentResidency->resident[osContextId] = false;
+    }
+    memoryOperationsResidency.clear();
+    return lock;
+}
+
 template <typename GfxFamily>
 void DrmCommandStreamReceiver<GfxFamily>::makeNonResident(GraphicsAllocation &gfxAllocation) {
     // Vector is moved to command buffer inside flush.
@@ -154,6 +229,11 @@ GmmPageTableMngr *DrmCommandStreamReceiver<GfxFamily>::createPageTableManager()
 
 template <typename GfxFamily>
 bool DrmCommandStreamReceiver<GfxFamily>::waitForFlushStamp(FlushStamp &flushStamp) {
+    if (this->directSubmission.get()) {
+        // flush stamp is a ring tag value, the ring writes it to the semaphore page after the command buffer
+        return static_cast<DrmDirectSubmission<GfxFamily> *>(this->directSubmission.get())->waitForTagValue(flushStamp);
+    }
+
     drm_i915_gem_wait wait = {};
     wait.bo_handle = static_cast<uint32_t>(flushStamp);
     wait.timeout_ns = -1;
@@ -162,4 +242,44 @@ bool DrmCommandStreamReceiver<GfxFamily>::waitForFlushStamp(FlushStamp &flushSta
     return true;
 }
 
+template <typename GfxFamily>
+bool DrmCommandStreamReceiver<GfxFamily>::initDirectSubmission(Device &device, OsContext &osContext) {
+    bool ret = true;
+
+    if (DebugManager.flags.EnableDirectSubmission.get() == 1) {
+        auto contextEngineType = osContext.getEngineType();
+        const DirectSubmissionProperties &directSubmissionProperty =
+            device.getHardwareInfo().capabilityTable.directSubmissionEngines.data[contextEngineType];
+
+        bool startDirect = true;
+        if (!osContext.isDefaultContext()) {
+            startDirect = directSubmissionProperty.useNonDefault;
+        }
+        if (osContext.isLowPriority()) {
+            startDirect = directSubmissionProperty.useLowPriority;
+        }
+        if (osContext.isInternalEngine()) {
+            startDirect = directSubmissionProperty.useInternal;
+        }
+        if (osContext.isRootDevice()) {
+            startDirect = directSubmissionProperty.useRootDevice;
+        }
+
+        if (directSubmissionProperty.engineSupported && startDirect) {
+            if (contextEngineType == aub_stream::ENGINE_BCS) {
+                this->directSubmission = std::make_unique<DrmDirectSubmission<GfxFamily>>(device,
+                                                                                          std::make_unique<BlitterDispatcher<GfxFamily>>(),
+                                                                                          osContext);
+            } else {
+                this->directSubmission = std::make_unique<DrmDirectSubmission<GfxFamily>>(device,
+                                                                                          std::make_unique<RenderDispatcher<GfxFamily>>(),
+                                                                                          osContext);
+            }
+            ret = this->directSubmission->initialize(directSubmissionProperty.submitOnInit);
+            this->dispatchMode = DispatchMode::ImmediateDispatch;
+        }
+    }
+    return ret;
+}
+
 } // namespace NEO
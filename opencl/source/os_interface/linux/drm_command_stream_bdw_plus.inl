@@ -19,6 +19,8 @@ void DrmCommandStreamReceiver<GfxFamily>::makeResidentBufferObjects(const DrmAll
 template <typename GfxFamily>
 void DrmCommandStreamReceiver<GfxFamily>::flushInternal(const BatchBuffer &batchBuffer, const ResidencyContainer &allocationsForResidency) {
     this->processResidency(allocationsForResidency, 0u);
+    // explicitly resident allocations cannot be freed until their buffer objects are submitted
+    auto memoryOperationsLock = this->processMemoryOperationsResidency(allocationsForResidency, 0u);
     this->exec(batchBuffer, static_cast<const OsContextLinux *>(osContext)->getDrmContextIds()[0]);
 }
 
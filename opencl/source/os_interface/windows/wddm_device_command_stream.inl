@@ -59,6 +59,7 @@ WddmCommandStreamReceiver<GfxFamily>::WddmCommandStreamReceiver(ExecutionEnviron
 
 template <typename GfxFamily>
 WddmCommandStreamReceiver<GfxFamily>::~WddmCommandStreamReceiver() {
+    this->stopImplicitFlushTimer();
     if (commandBufferHeader)
         delete commandBufferHeader;
 }
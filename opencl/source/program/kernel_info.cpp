@@ -428,6 +428,29 @@ bool KernelInfo::createKernelAllocation(uint32_t rootDeviceIndex, MemoryManager
     return memoryManager->copyMemoryToAllocation(kernelAllocation, heapInfo.pKernelHeap, kernelIsaSize);
 }
 
+void KernelInfo::deferKernelAllocation(uint32_t rootDeviceIndex, MemoryManager *memoryManager) {
+    UNRECOVERABLE_IF(kernelAllocation);
+    deferredAllocationRootDeviceIndex = rootDeviceIndex;
+    deferredAllocationMemoryManager = memoryManager;
+    kernelAllocationDeferred = true;
+}
+
+bool KernelInfo::createDeferredKernelAllocation() {
+    std::lock_guard<std::mutex> lock(kernelAllocationMutex);
+    if (!kernelAllocationDeferred) {
+        return true;
+    }
+    if (!createKernelAllocation(deferredAllocationRootDeviceIndex, deferredAllocationMemoryManager)) {
+        if (kernelAllocation) {
+            deferredAllocationMemoryManager->freeGraphicsMemory(kernelAllocation);
+            kernelAllocation = nullptr;
+        }
+        return false;
+    }
+    kernelAllocationDeferred = false;
+    return true;
+}
+
 void KernelInfo::apply(const DeviceInfoKernelPayloadConstants &constants) {
     if (nullptr == this->crossThreadData) {
         return;
@@ -18,9 +18,11 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cmath>
 #include <cstdint>
 #include <map>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -185,6 +187,9 @@ struct KernelInfo {
     }
 
     bool createKernelAllocation(uint32_t rootDeviceIndex, MemoryManager *memoryManager);
+    void deferKernelAllocation(uint32_t rootDeviceIndex, MemoryManager *memoryManager);
+    bool isKernelAllocationDeferred() const { return kernelAllocationDeferred; }
+    bool createDeferredKernelAllocation();
     void apply(const DeviceInfoKernelPayloadConstants &constants);
 
     std::string name;
@@ -211,6 +216,10 @@ struct KernelInfo {
     uint64_t kernelId = 0;
     bool isKernelHeapSubstituted = false;
     GraphicsAllocation *kernelAllocation = nullptr;
+    std::atomic<bool> kernelAllocationDeferred{false};
+    std::mutex kernelAllocationMutex;
+    MemoryManager *deferredAllocationMemoryManager = nullptr;
+    uint32_t deferredAllocationRootDeviceIndex = 0u;
     DebugData debugData;
     bool computeMode = false;
     const gtpin::igc_info_t *igcInfoForGtpin = nullptr;
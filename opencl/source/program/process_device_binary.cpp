@@ -5,7 +5,10 @@
  *
  */
 
+#include "shared/source/command_stream/scratch_space_registry.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device_binary_format/device_binary_formats.h"
+#include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/ptr_math.h"
@@ -187,10 +190,15 @@ cl_int Program::processProgramInfo(ProgramInfo &src) {
 
     this->globalVarTotalSize = src.globalVariables.size;
 
+    bool deferKernelAllocations = isKernelAllocationDeferralAllowed();
     for (auto &kernelInfo : this->kernelInfoArray) {
         cl_int retVal = CL_SUCCESS;
         if (kernelInfo->heapInfo.pKernelHeader->KernelHeapSize && this->pDevice) {
-            retVal = kernelInfo->createKernelAllocation(this->pDevice->getRootDeviceIndex(), this->pDevice->getMemoryManager()) ? CL_SUCCESS : CL_OUT_OF_HOST_MEMORY;
+            if (deferKernelAllocations) {
+                kernelInfo->deferKernelAllocation(this->pDevice->getRootDeviceIndex(), this->pDevice->getMemoryManager());
+            } else {
+                retVal = kernelInfo->createKernelAllocation(this->pDevice->getRootDeviceIndex(), this->pDevice->getMemoryManager()) ? CL_SUCCESS : CL_OUT_OF_HOST_MEMORY;
+            }
         }
 
         DEBUG_BREAK_IF(kernelInfo->heapInfo.pKernelHeader->KernelHeapSize && !this->pDevice);
@@ -208,9 +216,39 @@ cl_int Program::processProgramInfo(ProgramInfo &src) {
         kernelInfo->apply(deviceInfoConstants);
     }
 
+    if (this->pDevice) {
+        uint32_t maxPerThreadScratchSize = 0u;
+        for (auto &kernelInfo : this->kernelInfoArray) {
+            if (kernelInfo->patchInfo.mediavfestate) {
+                maxPerThreadScratchSize = std::max(maxPerThreadScratchSize, kernelInfo->patchInfo.mediavfestate->PerThreadScratchSpace);
+            }
+        }
+        // lets command stream receivers allocate scratch for the whole program on first kernel needing it
+        if (maxPerThreadScratchSize) {
+            this->pDevice->getRootDeviceEnvironment().scratchSpaceRegistry->registerPerThreadScratchSize(maxPerThreadScratchSize);
+            this->registeredPerThreadScratchSize = maxPerThreadScratchSize;
+        }
+    }
+
     return linkBinary();
 }
 
+bool Program::isKernelAllocationDeferralAllowed() const {
+    if (DebugManager.flags.DeferKernelIsaAllocation.get() == 0 || isBuiltIn) {
+        return false;
+    }
+    // linking patches and exports ISA of all kernels, block kernels are dispatched only through their parents
+    if (linkerInput && (linkerInput->getTraits().requiresPatchingOfInstructionSegments || linkerInput->getExportedFunctionsSegmentId() >= 0)) {
+        return false;
+    }
+    for (const auto &kernelInfo : kernelInfoArray) {
+        if (kernelInfo->hasDeviceEnqueue()) {
+            return false;
+        }
+    }
+    return true;
+}
+
 void Program::processDebugData() {
     if (debugData != nullptr) {
         SProgramDebugDataHeaderIGC *programDebugHeader = reinterpret_cast<SProgramDebugDataHeaderIGC *>(debugData.get());
@@ -8,11 +8,13 @@
 #include "program.h"
 
 #include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/command_stream/scratch_space_registry.h"
 #include "shared/source/compiler_interface/compiler_interface.h"
 #include "shared/source/compiler_interface/intermediate_representations.h"
 #include "shared/source/device_binary_format/device_binary_formats.h"
 #include "shared/source/device_binary_format/elf/elf_encoder.h"
 #include "shared/source/device_binary_format/elf/ocl_elf.h"
+#include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/hw_helper.h"
 #include "shared/source/helpers/string.h"
@@ -393,6 +395,11 @@ void Program::cleanCurrentKernelInfo() {
         delete kernelInfo;
     }
     kernelInfoArray.clear();
+
+    if (registeredPerThreadScratchSize) {
+        pDevice->getRootDeviceEnvironment().scratchSpaceRegistry->unregisterPerThreadScratchSize(registeredPerThreadScratchSize);
+        registeredPerThreadScratchSize = 0u;
+    }
 }
 
 void Program::updateNonUniformFlag() {
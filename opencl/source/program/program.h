@@ -268,6 +268,7 @@ class Program : public BaseObject<_cl_program> {
     cl_int packDeviceBinary();
 
     MOCKABLE_VIRTUAL cl_int linkBinary();
+    bool isKernelAllocationDeferralAllowed() const;
 
     void separateBlockKernels();
 
@@ -310,6 +311,7 @@ class Program : public BaseObject<_cl_program> {
     GraphicsAllocation *exportedFunctionsSurface = nullptr;
 
     size_t globalVarTotalSize = 0U;
+    uint32_t registeredPerThreadScratchSize = 0U;
 
     cl_build_status buildStatus = CL_BUILD_NONE;
     bool isCreatedFromBinary = false;
@@ -178,6 +178,26 @@ TEST_F(clGetExtensionFunctionAddressTests, GivenClEnqueueNDCountKernelINTELWhenG
     EXPECT_EQ(retVal, reinterpret_cast<void *>(clEnqueueNDCountKernelINTEL));
 }
 
+TEST_F(clGetExtensionFunctionAddressTests, GivenClBeginCommandGraphCaptureINTELWhenGettingExtensionFunctionThenCorrectAddressIsReturned) {
+    auto retVal = clGetExtensionFunctionAddress("clBeginCommandGraphCaptureINTEL");
+    EXPECT_EQ(retVal, reinterpret_cast<void *>(clBeginCommandGraphCaptureINTEL));
+}
+
+TEST_F(clGetExtensionFunctionAddressTests, GivenClEndCommandGraphCaptureINTELWhenGettingExtensionFunctionThenCorrectAddressIsReturned) {
+    auto retVal = clGetExtensionFunctionAddress("clEndCommandGraphCaptureINTEL");
+    EXPECT_EQ(retVal, reinterpret_cast<void *>(clEndCommandGraphCaptureINTEL));
+}
+
+TEST_F(clGetExtensionFunctionAddressTests, GivenClEnqueueCommandGraphINTELWhenGettingExtensionFunctionThenCorrectAddressIsReturned) {
+    auto retVal = clGetExtensionFunctionAddress("clEnqueueCommandGraphINTEL");
+    EXPECT_EQ(retVal, reinterpret_cast<void *>(clEnqueueCommandGraphINTEL));
+}
+
+TEST_F(clGetExtensionFunctionAddressTests, GivenClReleaseCommandGraphINTELWhenGettingExtensionFunctionThenCorrectAddressIsReturned) {
+    auto retVal = clGetExtensionFunctionAddress("clReleaseCommandGraphINTEL");
+    EXPECT_EQ(retVal, reinterpret_cast<void *>(clReleaseCommandGraphINTEL));
+}
+
 TEST_F(clGetExtensionFunctionAddressTests, GivenCSlSetProgramSpecializationConstantWhenGettingExtensionFunctionThenCorrectAddressIsReturned) {
     auto retVal = clGetExtensionFunctionAddress("clSetProgramSpecializationConstant");
     EXPECT_EQ(retVal, reinterpret_cast<void *>(clSetProgramSpecializationConstant));
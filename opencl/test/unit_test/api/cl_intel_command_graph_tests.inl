@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/command_queue/command_graph.h"
+#include "opencl/test/unit_test/api/cl_api_tests.h"
+
+using namespace NEO;
+
+using clCommandGraphTests = api_tests;
+
+namespace ULT {
+
+TEST_F(clCommandGraphTests, givenNullCommandQueueWhenBeginningCaptureThenInvalidCommandQueueIsReturned) {
+    retVal = clBeginCommandGraphCaptureINTEL(nullptr);
+    EXPECT_EQ(CL_INVALID_COMMAND_QUEUE, retVal);
+}
+
+TEST_F(clCommandGraphTests, givenNullCommandQueueWhenEndingCaptureThenInvalidCommandQueueIsReturned) {
+    auto graph = clEndCommandGraphCaptureINTEL(nullptr, &retVal);
+    EXPECT_EQ(CL_INVALID_COMMAND_QUEUE, retVal);
+    EXPECT_EQ(nullptr, graph);
+}
+
+TEST_F(clCommandGraphTests, givenNoActiveCaptureWhenEndingCaptureThenInvalidOperationIsReturned) {
+    auto graph = clEndCommandGraphCaptureINTEL(pCommandQueue, &retVal);
+    EXPECT_EQ(CL_INVALID_OPERATION, retVal);
+    EXPECT_EQ(nullptr, graph);
+}
+
+TEST_F(clCommandGraphTests, givenActiveCaptureWhenBeginningCaptureAgainThenInvalidOperationIsReturned) {
+    retVal = clBeginCommandGraphCaptureINTEL(pCommandQueue);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    retVal = clBeginCommandGraphCaptureINTEL(pCommandQueue);
+    EXPECT_EQ(CL_INVALID_OPERATION, retVal);
+
+    auto graph = clEndCommandGraphCaptureINTEL(pCommandQueue, &retVal);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    ASSERT_NE(nullptr, graph);
+    EXPECT_EQ(0u, castToObject<CommandGraph>(graph)->getNodesCount());
+
+    retVal = clReleaseCommandGraphINTEL(graph);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+}
+
+TEST_F(clCommandGraphTests, givenNullGraphWhenEnqueueingGraphThenInvalidValueIsReturned) {
+    retVal = clEnqueueCommandGraphINTEL(pCommandQueue, nullptr, nullptr);
+    EXPECT_EQ(CL_INVALID_VALUE, retVal);
+}
+
+TEST_F(clCommandGraphTests, givenNullGraphWhenReleasingGraphThenInvalidValueIsReturned) {
+    retVal = clReleaseCommandGraphINTEL(nullptr);
+    EXPECT_EQ(CL_INVALID_VALUE, retVal);
+}
+} // namespace ULT
@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/aub/dirty_page_tracker.h"
+
+#include "gtest/gtest.h"
+
+#include <utility>
+#include <vector>
+
+using namespace NEO;
+
+struct DirtyPageTrackerTest : public ::testing::Test {
+    using Range = std::pair<size_t, size_t>;
+
+    void SetUp() override {
+        memory.resize(numPages * DirtyPageTracker::pageSize, 0u);
+    }
+
+    std::vector<Range> writeDirtyRanges() {
+        std::vector<Range> ranges;
+        tracker.writeDirtyRanges(pageHashes, memory.data(), memory.size(), [&](size_t offset, size_t rangeSize) {
+            ranges.push_back({offset, rangeSize});
+        });
+        return ranges;
+    }
+
+    static constexpr size_t numPages = 8u;
+    DirtyPageTracker tracker;
+    GraphicsAllocation::PageHashes pageHashes;
+    std::vector<char> memory;
+};
+
+constexpr size_t DirtyPageTrackerTest::numPages;
+
+TEST_F(DirtyPageTrackerTest, givenNoRecordedHashesWhenWritingDirtyRangesThenWholeMemoryIsWrittenInSingleRange) {
+    auto ranges = writeDirtyRanges();
+
+    ASSERT_EQ(1u, ranges.size());
+    EXPECT_EQ(0u, ranges[0].first);
+    EXPECT_EQ(memory.size(), ranges[0].second);
+    EXPECT_EQ(numPages, pageHashes.hashes.size());
+    EXPECT_EQ(memory.size(), tracker.getStatistics().bytesWritten);
+    EXPECT_EQ(0u, tracker.getStatistics().bytesSkipped);
+}
+
+TEST_F(DirtyPageTrackerTest, givenUnchangedMemoryWhenWritingDirtyRangesAgainThenNothingIsWritten) {
+    writeDirtyRanges();
+    auto ranges = writeDirtyRanges();
+
+    EXPECT_TRUE(ranges.empty());
+    EXPECT_EQ(memory.size(), tracker.getStatistics().bytesSkipped);
+}
+
+TEST_F(DirtyPageTrackerTest, givenChangedPagesWhenWritingDirtyRangesThenOnlyChangedPagesAreWrittenAndAdjacentPagesAreCoalesced) {
+    writeDirtyRanges();
+
+    memory[2 * DirtyPageTracker::pageSize + 5] = 1;
+    memory[3 * DirtyPageTracker::pageSize] = 1;
+    memory[6 * DirtyPageTracker::pageSize + 100] = 1;
+    auto ranges = writeDirtyRanges();
+
+    ASSERT_EQ(2u, ranges.size());
+    EXPECT_EQ(2 * DirtyPageTracker::pageSize, ranges[0].first);
+    EXPECT_EQ(2 * DirtyPageTracker::pageSize, ranges[0].second);
+    EXPECT_EQ(6 * DirtyPageTracker::pageSize, ranges[1].first);
+    EXPECT_EQ(DirtyPageTracker::pageSize, ranges[1].second);
+    EXPECT_EQ(memory.size() + 3 * DirtyPageTracker::pageSize, tracker.getStatistics().bytesWritten);
+    EXPECT_EQ(5 * DirtyPageTracker::pageSize, tracker.getStatistics().bytesSkipped);
+}
+
+TEST_F(DirtyPageTrackerTest, givenLastPageChangedWhenWritingDirtyRangesThenRangeEndsAtMemoryEnd) {
+    writeDirtyRanges();
+
+    memory.back() = 1;
+    auto ranges = writeDirtyRanges();
+
+    ASSERT_EQ(1u, ranges.size());
+    EXPECT_EQ((numPages - 1) * DirtyPageTracker::pageSize, ranges[0].first);
+    EXPECT_EQ(DirtyPageTracker::pageSize, ranges[0].second);
+}
+
+TEST_F(DirtyPageTrackerTest, givenNewStreamStartedWhenWritingDirtyRangesThenWholeMemoryIsWrittenAgain) {
+    writeDirtyRanges();
+
+    tracker.startNewStream();
+    auto ranges = writeDirtyRanges();
+
+    ASSERT_EQ(1u, ranges.size());
+    EXPECT_EQ(0u, ranges[0].first);
+    EXPECT_EQ(memory.size(), ranges[0].second);
+}
+
+TEST_F(DirtyPageTrackerTest, givenHashesRecordedByOtherTrackerWhenWritingDirtyRangesThenWholeMemoryIsWritten) {
+    writeDirtyRanges();
+
+    DirtyPageTracker otherTracker;
+    std::vector<Range> ranges;
+    otherTracker.writeDirtyRanges(pageHashes, memory.data(), memory.size(), [&](size_t offset, size_t rangeSize) {
+        ranges.push_back({offset, rangeSize});
+    });
+
+    ASSERT_EQ(1u, ranges.size());
+    EXPECT_EQ(memory.size(), ranges[0].second);
+}
+
+TEST_F(DirtyPageTrackerTest, givenSizeNotAlignedToPageWhenWritingDirtyRangesThenLastRangeIsTrimmedToSize) {
+    std::vector<Range> ranges;
+    auto size = 2 * DirtyPageTracker::pageSize + 10;
+    tracker.writeDirtyRanges(pageHashes, memory.data(), size, [&](size_t offset, size_t rangeSize) {
+        ranges.push_back({offset, rangeSize});
+    });
+
+    ASSERT_EQ(1u, ranges.size());
+    EXPECT_EQ(size, ranges[0].second);
+    EXPECT_EQ(3u, pageHashes.hashes.size());
+}
+
+TEST(DirtyPageTracker, givenAllocationTypeWhenCheckingIfTrackingIsAllowedThenOnlyTypesNotWrittenByGpuAreAllowed) {
+    EXPECT_TRUE(DirtyPageTracker::isTrackingAllowed(GraphicsAllocation::AllocationType::COMMAND_BUFFER));
+    EXPECT_TRUE(DirtyPageTracker::isTrackingAllowed(GraphicsAllocation::AllocationType::KERNEL_ISA));
+    EXPECT_TRUE(DirtyPageTracker::isTrackingAllowed(GraphicsAllocation::AllocationType::LINEAR_STREAM));
+
+    EXPECT_FALSE(DirtyPageTracker::isTrackingAllowed(GraphicsAllocation::AllocationType::BUFFER));
+    EXPECT_FALSE(DirtyPageTracker::isTrackingAllowed(GraphicsAllocation::AllocationType::IMAGE));
+    EXPECT_FALSE(DirtyPageTracker::isTrackingAllowed(GraphicsAllocation::AllocationType::SVM_GPU));
+    EXPECT_FALSE(DirtyPageTracker::isTrackingAllowed(GraphicsAllocation::AllocationType::TAG_BUFFER));
+    EXPECT_FALSE(DirtyPageTracker::isTrackingAllowed(GraphicsAllocation::AllocationType::TIMESTAMP_PACKET_TAG_BUFFER));
+}
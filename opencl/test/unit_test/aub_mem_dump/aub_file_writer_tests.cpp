@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/aub_mem_dump/aub_file_writer.h"
+
+#include "gtest/gtest.h"
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+using namespace AubMemDump;
+
+struct MockAubFileWriter : public AubFileWriter {
+    using AubFileWriter::AubFileWriter;
+    using AubFileWriter::currentBuffer;
+    using AubFileWriter::worker;
+
+    void writeBuffer(const Buffer &buffer) override {
+        std::lock_guard<std::mutex> lock(writtenMutex);
+        written.append(buffer.data(), buffer.size());
+        writtenBufferSizes.push_back(buffer.size());
+    }
+
+    std::string getWritten() {
+        std::lock_guard<std::mutex> lock(writtenMutex);
+        return written;
+    }
+
+    std::mutex writtenMutex;
+    std::string written;
+    std::vector<size_t> writtenBufferSizes;
+};
+
+TEST(AubFileWriterTest, givenRecordsSmallerThanBufferWhenWrittenThenTheyAreNotPassedToFileBeforeFlush) {
+    std::ofstream fileHandle;
+    MockAubFileWriter writer(fileHandle, 64);
+
+    writer.write("abcd", 4);
+    writer.write("efgh", 4);
+
+    EXPECT_EQ(8u, writer.currentBuffer.size());
+    EXPECT_EQ(0u, writer.getBytesSubmitted());
+
+    writer.drain();
+    EXPECT_EQ("abcdefgh", writer.getWritten());
+    EXPECT_EQ(8u, writer.getBytesSubmitted());
+    EXPECT_TRUE(writer.currentBuffer.empty());
+}
+
+TEST(AubFileWriterTest, givenRecordNotFittingInBufferWhenWrittenThenCurrentBufferIsSubmittedFirst) {
+    std::ofstream fileHandle;
+    MockAubFileWriter writer(fileHandle, 8);
+
+    writer.write("abcdef", 6);
+    writer.write("ghijkl", 6);
+    writer.drain();
+
+    EXPECT_EQ("abcdefghijkl", writer.getWritten());
+    ASSERT_EQ(2u, writer.writtenBufferSizes.size());
+    EXPECT_EQ(6u, writer.writtenBufferSizes[0]);
+    EXPECT_EQ(6u, writer.writtenBufferSizes[1]);
+}
+
+TEST(AubFileWriterTest, givenRecordBiggerThanBufferWhenWrittenThenItIsSubmittedAsSeparateBufferInOrder) {
+    std::ofstream fileHandle;
+    MockAubFileWriter writer(fileHandle, 4);
+
+    writer.write("ab", 2);
+    writer.write("0123456789", 10);
+    writer.write("cd", 2);
+    writer.drain();
+
+    EXPECT_EQ("ab0123456789cd", writer.getWritten());
+    ASSERT_EQ(3u, writer.writtenBufferSizes.size());
+    EXPECT_EQ(10u, writer.writtenBufferSizes[1]);
+}
+
+TEST(AubFileWriterTest, givenManyRecordsWhenWrittenThenFileContentMatchesSubmissionOrder) {
+    std::ofstream fileHandle;
+    MockAubFileWriter writer(fileHandle, 32);
+
+    std::string expected;
+    for (uint32_t i = 0; i < 1000; i++) {
+        auto record = std::to_string(i) + ";";
+        expected += record;
+        writer.write(record.c_str(), record.size());
+        if (i % 100 == 0) {
+            writer.flush();
+        }
+    }
+    writer.drain();
+
+    EXPECT_EQ(expected, writer.getWritten());
+    EXPECT_EQ(expected.size(), writer.getBytesSubmitted());
+}
+
+TEST(AubFileWriterTest, givenDataWrittenWhenWriterIsClosedThenAllDataIsPassedToFileAndWorkerIsStopped) {
+    std::ofstream fileHandle;
+    MockAubFileWriter writer(fileHandle, 16);
+
+    writer.write("abcd", 4);
+    writer.close();
+
+    EXPECT_EQ("abcd", writer.getWritten());
+    EXPECT_EQ(nullptr, writer.worker.get());
+
+    writer.close();
+    EXPECT_EQ("abcd", writer.getWritten());
+}
@@ -39,6 +39,7 @@
 #include "gtest/gtest.h"
 #include "os_inc.h"
 
+#include <algorithm>
 #include <string>
 
 using namespace NEO;
@@ -901,6 +902,94 @@ TEST_F(BuiltInTests, BuiltinDispatchInfoBuilderGetBuilderTwice) {
     EXPECT_EQ(&builder1, &builder2);
 }
 
+TEST_F(BuiltInTests, givenCopyBufferToBufferBuilderWhenCloneIsCalledThenNewKernelInstancesSharingProgramAreCreated) {
+    auto &builder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyBufferToBuffer, *pDevice);
+    auto clonedBuilder = builder.clone();
+    ASSERT_NE(nullptr, clonedBuilder);
+
+    auto &kernels = builder.peekUsedKernels();
+    auto &clonedKernels = clonedBuilder->peekUsedKernels();
+    ASSERT_EQ(kernels.size(), clonedKernels.size());
+    for (size_t i = 0; i < kernels.size(); i++) {
+        EXPECT_NE(kernels[i].get(), clonedKernels[i].get());
+        EXPECT_EQ(kernels[i]->getProgram(), clonedKernels[i]->getProgram());
+        EXPECT_EQ(&kernels[i]->getKernelInfo(), &clonedKernels[i]->getKernelInfo());
+        EXPECT_TRUE(clonedKernels[i]->isBuiltIn);
+    }
+
+    MockBuffer src;
+    MockBuffer dst;
+    MultiDispatchInfo multiDispatchInfo;
+    BuiltinOpParams builtinOpsParams;
+    builtinOpsParams.srcMemObj = &src;
+    builtinOpsParams.dstMemObj = &dst;
+    builtinOpsParams.srcPtr = src.getCpuAddress();
+    builtinOpsParams.dstPtr = dst.getCpuAddress();
+    builtinOpsParams.size = {dst.getSize(), 0, 0};
+    ASSERT_TRUE(clonedBuilder->buildDispatchInfos(multiDispatchInfo, builtinOpsParams));
+
+    for (auto &dispatchInfo : multiDispatchInfo) {
+        auto kernel = dispatchInfo.getKernel();
+        auto isClonedKernel = std::find_if(clonedKernels.begin(), clonedKernels.end(), [&](auto &clonedKernel) { return clonedKernel.get() == kernel; }) != clonedKernels.end();
+        EXPECT_TRUE(isClonedKernel);
+    }
+}
+
+TEST_F(BuiltInTests, givenDefaultBuiltinDispatchInfoBuilderWhenCloneIsCalledThenNullptrIsReturned) {
+    auto &bs = *pDevice->getBuiltIns();
+    BuiltinDispatchInfoBuilder bdib{bs};
+    EXPECT_EQ(nullptr, bdib.clone());
+}
+
+TEST_F(BuiltInTests, givenTwoCommandQueuesWhenGettingBuiltinDispatchInfoBuilderThenEachQueueHasItsOwnInstance) {
+    MockCommandQueue cmdQ0(pContext, pClDevice, nullptr);
+    MockCommandQueue cmdQ1(pContext, pClDevice, nullptr);
+
+    auto &deviceBuilder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyBufferToBuffer, *pDevice);
+    auto queueBuilder0 = cmdQ0.getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyBufferToBuffer);
+    auto queueBuilder1 = cmdQ1.getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyBufferToBuffer);
+
+    EXPECT_NE(&deviceBuilder, queueBuilder0.get());
+    EXPECT_NE(&deviceBuilder, queueBuilder1.get());
+    EXPECT_NE(queueBuilder0, queueBuilder1);
+    EXPECT_EQ(queueBuilder0, cmdQ0.getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyBufferToBuffer));
+}
+
+TEST_F(BuiltInTests, givenDeviceBuilderChangedWhenGettingBuiltinDispatchInfoBuilderFromQueueThenOutdatedQueueBuilderIsReleasedWhenNoLongerHeld) {
+    auto builtIns = new MockBuiltins();
+    pDevice->getExecutionEnvironment()->rootDeviceEnvironments[pDevice->getRootDeviceIndex()]->builtins.reset(builtIns);
+    std::unique_ptr<BuiltinDispatchInfoBuilder> oldDeviceBuilder;
+    MockCommandQueue cmdQ(pContext, pClDevice, nullptr);
+
+    auto queueBuilder = cmdQ.getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyBufferToBuffer);
+    std::weak_ptr<BuiltinDispatchInfoBuilder> outdatedQueueBuilder = queueBuilder;
+    auto &deviceBuilder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyBufferToBuffer, *pDevice);
+    oldDeviceBuilder = builtIns->setBuiltinDispatchInfoBuilder(EBuiltInOps::CopyBufferToBuffer, *pContext, *pDevice, deviceBuilder.clone());
+
+    auto newQueueBuilder = cmdQ.getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyBufferToBuffer);
+    EXPECT_NE(queueBuilder, newQueueBuilder);
+    EXPECT_EQ(newQueueBuilder, cmdQ.getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyBufferToBuffer));
+    EXPECT_FALSE(outdatedQueueBuilder.expired());
+
+    queueBuilder.reset();
+    EXPECT_TRUE(outdatedQueueBuilder.expired());
+}
+
+TEST_F(BuiltInTests, givenPerQueueBuiltinKernelsDisabledWhenGettingBuiltinDispatchInfoBuilderFromQueueThenDeviceBuilderIsReturned) {
+    DebugManager.flags.EnablePerQueueBuiltinKernels.set(0);
+    MockCommandQueue cmdQ(pContext, pClDevice, nullptr);
+
+    auto &deviceBuilder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyBufferToBuffer, *pDevice);
+    EXPECT_EQ(&deviceBuilder, cmdQ.getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyBufferToBuffer).get());
+}
+
+TEST_F(BuiltInTests, givenBuiltinWithoutCloneSupportWhenGettingBuiltinDispatchInfoBuilderFromQueueThenDeviceBuilderIsReturned) {
+    MockCommandQueue cmdQ(pContext, pClDevice, nullptr);
+
+    auto &deviceBuilder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(EBuiltInOps::AuxTranslation, *pDevice);
+    EXPECT_EQ(&deviceBuilder, cmdQ.getBuiltinDispatchInfoBuilder(EBuiltInOps::AuxTranslation).get());
+}
+
 TEST_F(BuiltInTests, BuiltinDispatchInfoBuilderGetBuilderForUnknownBuiltInOp) {
     bool caughtException = false;
     try {
@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/command_queue/command_graph.h"
+#include "opencl/source/command_queue/command_queue.h"
+#include "opencl/source/event/event.h"
+#include "opencl/test/unit_test/fixtures/hello_world_fixture.h"
+#include "opencl/test/unit_test/libult/ult_command_stream_receiver.h"
+
+#include "test.h"
+
+using namespace NEO;
+
+using CommandGraphTest = HelloWorldTest<HelloWorldFixtureFactory>;
+
+HWTEST_F(CommandGraphTest, givenActiveCaptureWhenEnqueueingKernelsThenNothingIsSubmittedAndReplaySubmitsCapturedKernels) {
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    auto taskCountBeforeCapture = csr.peekTaskCount();
+
+    EXPECT_EQ(CL_SUCCESS, pCmdQ->beginGraphCapture());
+    EXPECT_TRUE(pCmdQ->isCapturingGraph());
+    EXPECT_EQ(CL_SUCCESS, callOneWorkItemNDRKernel());
+    EXPECT_EQ(CL_SUCCESS, callOneWorkItemNDRKernel());
+    EXPECT_EQ(taskCountBeforeCapture, csr.peekTaskCount());
+
+    cl_int retVal = CL_INVALID_VALUE;
+    auto graph = pCmdQ->endGraphCapture(retVal);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    ASSERT_NE(nullptr, graph);
+    EXPECT_FALSE(pCmdQ->isCapturingGraph());
+    EXPECT_EQ(2u, graph->getNodesCount());
+
+    for (uint32_t replay = 1; replay <= 2; replay++) {
+        cl_event event = nullptr;
+        retVal = pCmdQ->enqueueCommandGraph(*graph, &event);
+        EXPECT_EQ(CL_SUCCESS, retVal);
+        EXPECT_EQ(taskCountBeforeCapture + 2 * replay, csr.peekTaskCount());
+        EXPECT_EQ(csr.peekTaskCount(), pCmdQ->taskCount);
+
+        ASSERT_NE(nullptr, event);
+        auto pEvent = castToObject<Event>(event);
+        EXPECT_EQ(static_cast<cl_command_type>(CL_COMMAND_COMMAND_GRAPH_INTEL), pEvent->getCommandType());
+        EXPECT_EQ(pCmdQ->taskCount, pEvent->peekTaskCount());
+        pEvent->release();
+    }
+
+    graph->release();
+}
+
+HWTEST_F(CommandGraphTest, givenActiveCaptureWhenEnqueueingKernelWithEventThenCaptureIsAbortedAndCapturedKernelsAreSubmittedBeforeKernel) {
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    auto taskCountBeforeCapture = csr.peekTaskCount();
+
+    EXPECT_EQ(CL_SUCCESS, pCmdQ->beginGraphCapture());
+    EXPECT_EQ(CL_SUCCESS, callOneWorkItemNDRKernel());
+    EXPECT_EQ(CL_SUCCESS, callOneWorkItemNDRKernel());
+    EXPECT_EQ(taskCountBeforeCapture, csr.peekTaskCount());
+
+    cl_event event = nullptr;
+    EXPECT_EQ(CL_SUCCESS, callOneWorkItemNDRKernel(nullptr, 0, &event));
+    EXPECT_FALSE(pCmdQ->isCapturingGraph());
+    EXPECT_EQ(taskCountBeforeCapture + 3, csr.peekTaskCount());
+    EXPECT_EQ(csr.peekTaskCount(), pCmdQ->taskCount);
+    EXPECT_EQ(pCmdQ->taskCount, castToObject<Event>(event)->peekTaskCount());
+    castToObject<Event>(event)->release();
+
+    cl_int retVal = CL_SUCCESS;
+    auto graph = pCmdQ->endGraphCapture(retVal);
+    EXPECT_EQ(CL_INVALID_OPERATION, retVal);
+    EXPECT_EQ(nullptr, graph);
+
+    EXPECT_EQ(CL_SUCCESS, pCmdQ->beginGraphCapture());
+    graph = pCmdQ->endGraphCapture(retVal);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    ASSERT_NE(nullptr, graph);
+    graph->release();
+}
+
+HWTEST_F(CommandGraphTest, givenActiveCaptureWhenEnqueueingGraphThenInvalidOperationIsReturned) {
+    cl_int retVal = CL_SUCCESS;
+    EXPECT_EQ(CL_SUCCESS, pCmdQ->beginGraphCapture());
+    auto graph = pCmdQ->endGraphCapture(retVal);
+    ASSERT_NE(nullptr, graph);
+
+    EXPECT_EQ(CL_SUCCESS, pCmdQ->beginGraphCapture());
+    EXPECT_EQ(CL_INVALID_OPERATION, pCmdQ->enqueueCommandGraph(*graph, nullptr));
+    auto emptyGraph = pCmdQ->endGraphCapture(retVal);
+    ASSERT_NE(nullptr, emptyGraph);
+
+    emptyGraph->release();
+    graph->release();
+}
@@ -0,0 +1,176 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
+
+#include "opencl/source/built_ins/builtins_dispatch_builder.h"
+#include "opencl/test/unit_test/command_queue/enqueue_fixture.h"
+#include "opencl/test/unit_test/fixtures/hello_world_fixture.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+typedef HelloWorldTest<HelloWorldFixtureFactory> EnqueueCopyBufferMtTest;
+
+// enqueue blocked on builtin lock held by test has to fail the test instead of hanging it
+static bool waitWithTimeout(const std::atomic<bool> &flag) {
+    auto waitStart = std::chrono::steady_clock::now();
+    while (!flag) {
+        if (std::chrono::steady_clock::now() - waitStart > std::chrono::seconds(10)) {
+            return false;
+        }
+        std::this_thread::yield();
+    }
+    return true;
+}
+
+TEST_F(EnqueueCopyBufferMtTest, givenBuiltinLockedOnOneQueueWhenCopyingBufferOnOtherQueueThenCopyIsNotBlocked) {
+    std::unique_ptr<CommandQueue> otherCmdQ(CommandQueue::create(pContext, pClDevice, nullptr, false, retVal));
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    auto srcBuffer = std::unique_ptr<Buffer>(BufferHelper<>::create(pContext));
+    auto dstBuffer = std::unique_ptr<Buffer>(BufferHelper<>::create(pContext));
+
+    auto builder = pCmdQ->getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyBufferToBuffer);
+    auto builtInLock = std::make_unique<BuiltInOwnershipWrapper>(*builder, pContext);
+
+    std::atomic<bool> copyDone(false);
+    std::thread copyThread([&]() {
+        auto ret = otherCmdQ->enqueueCopyBuffer(srcBuffer.get(), dstBuffer.get(), 0, 0, BufferDefaults::sizeInBytes, 0, nullptr, nullptr);
+        EXPECT_EQ(CL_SUCCESS, ret);
+        copyDone = true;
+    });
+
+    EXPECT_TRUE(waitWithTimeout(copyDone));
+    builtInLock.reset();
+    copyThread.join();
+}
+
+TEST_F(EnqueueCopyBufferMtTest, givenMultipleQueuesWhenCopyingBuffersConcurrentlyThenAllCopiesSucceed) {
+    constexpr auto threadCount = 4;
+    constexpr auto copiesPerThread = 20;
+
+    std::vector<std::unique_ptr<CommandQueue>> queues;
+    std::vector<std::unique_ptr<Buffer>> srcBuffers;
+    std::vector<std::unique_ptr<Buffer>> dstBuffers;
+    for (auto i = 0; i < threadCount; i++) {
+        queues.emplace_back(CommandQueue::create(pContext, pClDevice, nullptr, false, retVal));
+        ASSERT_EQ(CL_SUCCESS, retVal);
+        srcBuffers.emplace_back(BufferHelper<>::create(pContext));
+        dstBuffers.emplace_back(BufferHelper<>::create(pContext));
+    }
+
+    std::atomic<bool> startCopies(false);
+    std::atomic<int> failedCopies(0);
+    std::vector<std::thread> threads;
+    for (auto i = 0; i < threadCount; i++) {
+        threads.push_back(std::thread([&, i]() {
+            while (!startCopies)
+                ;
+            for (auto copy = 0; copy < copiesPerThread; copy++) {
+                auto ret = queues[i]->enqueueCopyBuffer(srcBuffers[i].get(), dstBuffers[i].get(), 0, 0, BufferDefaults::sizeInBytes, 0, nullptr, nullptr);
+                if (ret != CL_SUCCESS) {
+                    failedCopies++;
+                }
+            }
+            queues[i]->finish();
+        }));
+    }
+
+    startCopies = true;
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(0, failedCopies.load());
+    for (auto i = 0; i < threadCount; i++) {
+        EXPECT_NE(queues[i]->getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyBufferToBuffer),
+                  queues[(i + 1) % threadCount]->getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyBufferToBuffer));
+    }
+}
+
+TEST_F(EnqueueCopyBufferMtTest, givenBuiltinLockedByOneThreadWhenOtherThreadCopiesBufferOnSameQueueThenCopyIsNotBlocked) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.PerQueueBuiltinKernelShards.set(CommandQueue::maxBuiltinShardsCount);
+
+    auto srcBuffer = std::unique_ptr<Buffer>(BufferHelper<>::create(pContext));
+    auto dstBuffer = std::unique_ptr<Buffer>(BufferHelper<>::create(pContext));
+
+    auto builder = pCmdQ->getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyBufferToBuffer);
+    auto builtInLock = std::make_unique<BuiltInOwnershipWrapper>(*builder, pContext);
+
+    auto lockedShardIndex = CommandQueue::getBuiltinShardIndex();
+    std::atomic<bool> copyDone(false);
+    std::atomic<bool> threadDone(false);
+    const BuiltinDispatchInfoBuilder *otherThreadBuilder = nullptr;
+    while (!copyDone) {
+        threadDone = false;
+        std::thread copyThread([&]() {
+            if (CommandQueue::getBuiltinShardIndex() != lockedShardIndex) {
+                otherThreadBuilder = pCmdQ->getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyBufferToBuffer).get();
+                auto ret = pCmdQ->enqueueCopyBuffer(srcBuffer.get(), dstBuffer.get(), 0, 0, BufferDefaults::sizeInBytes, 0, nullptr, nullptr);
+                EXPECT_EQ(CL_SUCCESS, ret);
+                copyDone = true;
+            }
+            threadDone = true;
+        });
+        if (!waitWithTimeout(threadDone)) {
+            builtInLock.reset();
+            copyThread.join();
+            FAIL() << "copy on other shard is blocked by builtin locked by this thread";
+        }
+        copyThread.join();
+    }
+
+    EXPECT_NE(builder.get(), otherThreadBuilder);
+}
+
+TEST_F(EnqueueCopyBufferMtTest, givenManyThreadsWhenCopyingBuffersConcurrentlyOnSameQueueThenAllCopiesSucceedAndEventsComplete) {
+    constexpr auto threadCount = 8;
+    constexpr auto copiesPerThread = 20;
+
+    std::vector<std::unique_ptr<Buffer>> srcBuffers;
+    std::vector<std::unique_ptr<Buffer>> dstBuffers;
+    for (auto i = 0; i < threadCount; i++) {
+        srcBuffers.emplace_back(BufferHelper<>::create(pContext));
+        dstBuffers.emplace_back(BufferHelper<>::create(pContext));
+    }
+
+    std::atomic<bool> startCopies(false);
+    std::atomic<int> failedCopies(0);
+    std::vector<cl_event> events(threadCount * copiesPerThread, nullptr);
+    std::vector<std::thread> threads;
+    for (auto i = 0; i < threadCount; i++) {
+        threads.push_back(std::thread([&, i]() {
+            while (!startCopies)
+                ;
+            for (auto copy = 0; copy < copiesPerThread; copy++) {
+                auto ret = pCmdQ->enqueueCopyBuffer(srcBuffers[i].get(), dstBuffers[i].get(), 0, 0, BufferDefaults::sizeInBytes, 0, nullptr, &events[i * copiesPerThread + copy]);
+                if (ret != CL_SUCCESS) {
+                    failedCopies++;
+                }
+            }
+        }));
+    }
+
+    startCopies = true;
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    pCmdQ->finish();
+
+    EXPECT_EQ(0, failedCopies.load());
+    for (auto &event : events) {
+        ASSERT_NE(nullptr, event);
+        EXPECT_EQ(CL_SUCCESS, clWaitForEvents(1, &event));
+        clReleaseEvent(event);
+    }
+}
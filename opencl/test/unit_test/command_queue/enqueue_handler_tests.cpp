@@ -232,6 +232,22 @@ HWTEST_F(EnqueueHandlerTest, givenLocalWorkgroupSizeGreaterThenGlobalWorkgroupSi
     EXPECT_EQ(retVal, CL_INVALID_WORK_GROUP_SIZE);
 }
 
+HWTEST_F(EnqueueHandlerTest, givenEnqueueKernelWithoutLocalWorkgroupSizeWhenCommandsAreProgrammedThenLwsIsAlreadyGeneratedInPreparePhase) {
+    struct LwsCapturingCommandQueueHw : public CommandQueueHw<FamilyType> {
+        using CommandQueueHw<FamilyType>::CommandQueueHw;
+        void enqueueHandlerHook(const unsigned int commandType, const MultiDispatchInfo &multiDispatchInfo) override {
+            lwsAtCommit = multiDispatchInfo.begin()->getLocalWorkgroupSize();
+        }
+        Vec3<size_t> lwsAtCommit = {0, 0, 0};
+    };
+    MockKernelWithInternals mockKernel(*pClDevice);
+    LwsCapturingCommandQueueHw cmdQ(context, pClDevice, nullptr, false);
+
+    size_t gws[] = {64, 1, 1};
+    EXPECT_EQ(CL_SUCCESS, cmdQ.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr));
+    EXPECT_NE(0u, cmdQ.lwsAtCommit.x);
+}
+
 HWTEST_F(EnqueueHandlerTest, WhenEnqueuingHandlerCallOnEnqueueMarkerThenCallProcessEvictionOnCsrIsNotCalled) {
     int32_t tag;
     auto csr = new MockCsrBase<FamilyType>(tag, *pDevice->executionEnvironment, pDevice->getRootDeviceIndex());
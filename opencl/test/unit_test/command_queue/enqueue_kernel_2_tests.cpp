@@ -876,6 +876,90 @@ HWTEST_F(EnqueueAuxKernelTests, givenDebugVariableDisablingBuiltinTranslationWhe
     EXPECT_FALSE(kernel->isBuiltIn);
 }
 
+HWTEST_F(EnqueueAuxKernelTests, givenAuxTranslationTrackingWhenEnqueuingWithoutEventsThenBufferIsLeftNonAuxUntilFinish) {
+    DebugManager.flags.EnableAuxTranslationTracking.set(1);
+
+    MockBuffer buffer;
+    cl_mem clMem = &buffer;
+    MockKernelWithInternals mockKernel(*pClDevice, context);
+    MyCmdQ<FamilyType> cmdQ(context, pClDevice);
+    size_t gws[3] = {1, 0, 0};
+
+    buffer.getGraphicsAllocation()->setAllocationType(GraphicsAllocation::AllocationType::BUFFER_COMPRESSED);
+    mockKernel.kernelInfo.kernelArgInfo.resize(1);
+    mockKernel.kernelInfo.kernelArgInfo.at(0).kernelArgPatchInfoVector.resize(1);
+    mockKernel.kernelInfo.kernelArgInfo.at(0).pureStatefulBufferAccess = false;
+    mockKernel.mockKernel->initialize();
+    mockKernel.mockKernel->auxTranslationRequired = true;
+    mockKernel.mockKernel->setArgBuffer(0, sizeof(cl_mem *), &clMem);
+
+    cmdQ.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(2u, cmdQ.getAuxTranslationCounters().translationsRequired);
+    EXPECT_EQ(1u, cmdQ.getAuxTranslationCounters().translationsDispatched);
+
+    cmdQ.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(4u, cmdQ.getAuxTranslationCounters().translationsRequired);
+    EXPECT_EQ(1u, cmdQ.getAuxTranslationCounters().translationsDispatched);
+
+    cmdQ.finish();
+    EXPECT_EQ(4u, cmdQ.getAuxTranslationCounters().translationsRequired);
+    EXPECT_EQ(2u, cmdQ.getAuxTranslationCounters().translationsDispatched);
+
+    cmdQ.finish();
+    EXPECT_EQ(2u, cmdQ.getAuxTranslationCounters().translationsDispatched);
+}
+
+HWTEST_F(EnqueueAuxKernelTests, givenAuxTranslationTrackingWhenEnqueuingWithEventThenBufferIsCompressedAfterKernel) {
+    DebugManager.flags.EnableAuxTranslationTracking.set(1);
+
+    MockBuffer buffer;
+    cl_mem clMem = &buffer;
+    MockKernelWithInternals mockKernel(*pClDevice, context);
+    MyCmdQ<FamilyType> cmdQ(context, pClDevice);
+    size_t gws[3] = {1, 0, 0};
+    cl_event event = nullptr;
+
+    buffer.getGraphicsAllocation()->setAllocationType(GraphicsAllocation::AllocationType::BUFFER_COMPRESSED);
+    mockKernel.kernelInfo.kernelArgInfo.resize(1);
+    mockKernel.kernelInfo.kernelArgInfo.at(0).kernelArgPatchInfoVector.resize(1);
+    mockKernel.kernelInfo.kernelArgInfo.at(0).pureStatefulBufferAccess = false;
+    mockKernel.mockKernel->initialize();
+    mockKernel.mockKernel->auxTranslationRequired = true;
+    mockKernel.mockKernel->setArgBuffer(0, sizeof(cl_mem *), &clMem);
+
+    cmdQ.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
+    cmdQ.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, &event);
+    EXPECT_EQ(4u, cmdQ.getAuxTranslationCounters().translationsRequired);
+    EXPECT_EQ(2u, cmdQ.getAuxTranslationCounters().translationsDispatched);
+
+    cmdQ.finish();
+    EXPECT_EQ(2u, cmdQ.getAuxTranslationCounters().translationsDispatched);
+    clReleaseEvent(event);
+}
+
+HWTEST_F(EnqueueAuxKernelTests, givenAuxTranslationTrackingDisabledWhenEnqueuingThenAllTranslationsAreDispatched) {
+    DebugManager.flags.EnableAuxTranslationTracking.set(0);
+
+    MockBuffer buffer;
+    cl_mem clMem = &buffer;
+    MockKernelWithInternals mockKernel(*pClDevice, context);
+    MyCmdQ<FamilyType> cmdQ(context, pClDevice);
+    size_t gws[3] = {1, 0, 0};
+
+    buffer.getGraphicsAllocation()->setAllocationType(GraphicsAllocation::AllocationType::BUFFER_COMPRESSED);
+    mockKernel.kernelInfo.kernelArgInfo.resize(1);
+    mockKernel.kernelInfo.kernelArgInfo.at(0).kernelArgPatchInfoVector.resize(1);
+    mockKernel.kernelInfo.kernelArgInfo.at(0).pureStatefulBufferAccess = false;
+    mockKernel.mockKernel->initialize();
+    mockKernel.mockKernel->auxTranslationRequired = true;
+    mockKernel.mockKernel->setArgBuffer(0, sizeof(cl_mem *), &clMem);
+
+    cmdQ.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
+    cmdQ.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(4u, cmdQ.dispatchAuxTranslationInputs.size());
+    EXPECT_EQ(0u, cmdQ.getAuxTranslationCounters().translationsRequired);
+}
+
 HWCMDTEST_F(IGFX_GEN8_CORE, EnqueueKernelTest, givenCacheFlushAfterWalkerEnabledWhenAllocationRequiresCacheFlushThenFlushCommandPresentAfterWalker) {
     using GPGPU_WALKER = typename FamilyType::GPGPU_WALKER;
     using PIPE_CONTROL = typename FamilyType::PIPE_CONTROL;
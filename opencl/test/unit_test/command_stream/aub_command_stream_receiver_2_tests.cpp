@@ -655,22 +655,18 @@ HWTEST_F(AubCommandStreamReceiverTests, givenAubCommandStreamReceiverWhenProcess
 HWTEST_F(AubCommandStreamReceiverTests, givenAubCommandStreamReceiverWhenWriteMemoryIsCalledThenGraphicsAllocationSizeIsReadCorrectly) {
     pDevice->executionEnvironment->rootDeviceEnvironments[0]->aubCenter.reset(new AubCenter());
 
-    auto aubCsr = std::make_unique<AUBCommandStreamReceiverHw<FamilyType>>("", false, *pDevice->executionEnvironment, pDevice->getRootDeviceIndex());
-    aubCsr->setupContext(*pDevice->getDefaultEngine().osContext);
-    std::unique_ptr<MemoryManager> memoryManager(new OsAgnosticMemoryManager(*pDevice->executionEnvironment));
-
-    PhysicalAddressAllocator allocator;
-    struct PpgttMock : std::conditional<is64bit, PML4, PDPE>::type {
-        PpgttMock(PhysicalAddressAllocator *allocator) : std::conditional<is64bit, PML4, PDPE>::type(allocator) {}
+    struct AubCsrMock : AUBCommandStreamReceiverHw<FamilyType> {
+        using AUBCommandStreamReceiverHw<FamilyType>::AUBCommandStreamReceiverHw;
+        using AUBCommandStreamReceiverHw<FamilyType>::writeMemory;
 
-        void pageWalk(uintptr_t vm, size_t size, size_t offset, uint64_t entryBits, PageWalker &pageWalker, uint32_t memoryBank) override {
+        void writeMemory(uint64_t gpuAddress, void *cpuAddress, size_t size, uint32_t memoryBank, uint64_t entryBits) override {
             receivedSize = size;
         }
         size_t receivedSize = 0;
     };
-    auto ppgttMock = new PpgttMock(&allocator);
-
-    aubCsr->ppgtt.reset(ppgttMock);
+    auto aubCsr = std::make_unique<AubCsrMock>("", false, *pDevice->executionEnvironment, pDevice->getRootDeviceIndex());
+    aubCsr->setupContext(*pDevice->getDefaultEngine().osContext);
+    std::unique_ptr<MemoryManager> memoryManager(new OsAgnosticMemoryManager(*pDevice->executionEnvironment));
 
     auto gfxAllocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{MemoryConstants::pageSize});
     aubCsr->setAubWritable(true, *gfxAllocation);
@@ -684,9 +680,9 @@ HWTEST_F(AubCommandStreamReceiverTests, givenAubCommandStreamReceiverWhenWriteMe
         aubCsr->writeMemory(*gfxAllocation);
 
         if (compressed) {
-            EXPECT_EQ(gfxAllocation->getDefaultGmm()->gmmResourceInfo->getSizeAllocation(), ppgttMock->receivedSize);
+            EXPECT_EQ(gfxAllocation->getDefaultGmm()->gmmResourceInfo->getSizeAllocation(), aubCsr->receivedSize);
         } else {
-            EXPECT_EQ(gfxAllocation->getUnderlyingBufferSize(), ppgttMock->receivedSize);
+            EXPECT_EQ(gfxAllocation->getUnderlyingBufferSize(), aubCsr->receivedSize);
         }
     }
 
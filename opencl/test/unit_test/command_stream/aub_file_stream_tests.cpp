@@ -28,7 +28,9 @@
 #include "driver_version.h"
 
 #include <fstream>
+#include <iterator>
 #include <memory>
+#include <string>
 
 using namespace NEO;
 
@@ -998,3 +1000,32 @@ HWTEST_F(AubFileStreamTests, givenAubCommandStreamReceiverWhenCreateFullFilePath
     fullName = AUBCommandStreamReceiver::createFullFilePath(*platformDevices[0], "aubfile");
     EXPECT_NE(std::string::npos, fullName.find("2tx"));
 }
+
+TEST(AubFileStreamBackgroundWriterTests, givenDefaultSettingsWhenAubFileIsOpenedThenRecordsAreWrittenOnSubmittingThread) {
+    AubMemDump::AubFileStream stream;
+    stream.open("file_name.aub");
+    ASSERT_TRUE(stream.isOpen());
+
+    EXPECT_EQ(nullptr, stream.fileWriter.get());
+    stream.close();
+}
+
+TEST(AubFileStreamBackgroundWriterTests, givenBackgroundWriterEnabledWhenAubFileIsClosedThenAllRecordsArePersisted) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.AubDumpBackgroundWriter.set(1);
+
+    AubMemDump::AubFileStream stream;
+    stream.open("file_name.aub");
+    ASSERT_TRUE(stream.isOpen());
+    EXPECT_NE(nullptr, stream.fileWriter.get());
+
+    stream.write("abcd", 4);
+    stream.flush();
+    stream.write("efgh", 4);
+    stream.close();
+    EXPECT_EQ(nullptr, stream.fileWriter.get());
+
+    std::ifstream input("file_name.aub", std::ifstream::binary);
+    std::string content((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+    EXPECT_EQ("abcdefgh", content);
+}
@@ -26,6 +26,9 @@
 #include "opencl/test/unit_test/mocks/mock_submissions_aggregator.h"
 #include "test.h"
 
+#include <chrono>
+#include <thread>
+
 using namespace NEO;
 
 typedef UltCommandStreamReceiverTest CommandStreamReceiverFlushTaskTests;
@@ -1705,3 +1708,117 @@ HWTEST_F(CommandStreamReceiverFlushTaskTests, givenCommandStreamReceiverWhenInit
     EXPECT_FALSE(csr->pageTableManagerInitialized);
     memoryManager->freeGraphicsMemory(graphicsAllocation);
 }
+
+struct BatchedDispatchWithCounterTests : public CommandStreamReceiverFlushTaskTests {
+    template <typename FamilyType>
+    MockCsrHw2<FamilyType> *createMockCsr() {
+        auto mockCsr = new MockCsrHw2<FamilyType>(*pDevice->executionEnvironment, pDevice->getRootDeviceIndex());
+        pDevice->resetCommandStreamReceiver(mockCsr);
+        mockCsr->overrideDispatchPolicy(DispatchMode::BatchedDispatchWithCounter);
+        return mockCsr;
+    }
+
+    template <typename FamilyType>
+    void flushTasks(MockCsrHw2<FamilyType> &mockCsr, LinearStream &commandStream, uint32_t tasksCount) {
+        DispatchFlags dispatchFlags = DispatchFlagsHelper::createDefaultDispatchFlags();
+        dispatchFlags.guardCommandBufferWithPipeControl = true;
+        for (uint32_t i = 0; i < tasksCount; i++) {
+            mockCsr.flushTask(commandStream, commandStream.getUsed(), dsh, ioh, ssh, taskLevel, dispatchFlags, *pDevice);
+        }
+    }
+
+    DebugManagerStateRestore restorer;
+};
+
+HWTEST_F(BatchedDispatchWithCounterTests, givenCommandBuffersLimitWhenTasksAreFlushedThenBatchIsSubmittedEveryLimitTasks) {
+    DebugManager.flags.BatchedDispatchMaxCommandBuffers.set(4);
+    DebugManager.flags.BatchedDispatchDeadlineMicroseconds.set(0);
+    CommandQueueHw<FamilyType> commandQueue(nullptr, pClDevice, 0, false);
+    auto &commandStream = commandQueue.getCS(4096u);
+    auto mockCsr = createMockCsr<FamilyType>();
+
+    flushTasks(*mockCsr, commandStream, 3);
+    EXPECT_EQ(0, mockCsr->flushCalledCount);
+    EXPECT_EQ(3u, mockCsr->peekSubmissionAggregator()->getPendingCommandBuffersCount());
+
+    flushTasks(*mockCsr, commandStream, 7);
+    // 10 tasks are submitted with 2 execbuffers, 2 tasks stay batched
+    EXPECT_EQ(2, mockCsr->flushCalledCount);
+    EXPECT_EQ(8u, mockCsr->peekLatestFlushedTaskCount());
+    EXPECT_EQ(2u, mockCsr->peekSubmissionAggregator()->getPendingCommandBuffersCount());
+    EXPECT_EQ(nullptr, mockCsr->implicitFlushTimer.get());
+
+    mockCsr->flushBatchedSubmissions();
+    EXPECT_EQ(3, mockCsr->flushCalledCount);
+    EXPECT_EQ(0u, mockCsr->peekSubmissionAggregator()->getPendingCommandBuffersCount());
+    EXPECT_EQ(0u, mockCsr->peekSubmissionAggregator()->getPendingCommandBuffersSize());
+}
+
+HWTEST_F(BatchedDispatchWithCounterTests, givenCommandsSizeBudgetWhenRecordedCommandsExceedItThenBatchIsSubmitted) {
+    DebugManager.flags.BatchedDispatchDeadlineMicroseconds.set(0);
+    CommandQueueHw<FamilyType> commandQueue(nullptr, pClDevice, 0, false);
+    auto &commandStream = commandQueue.getCS(4096u);
+    auto mockCsr = createMockCsr<FamilyType>();
+
+    flushTasks(*mockCsr, commandStream, 1);
+    EXPECT_EQ(0, mockCsr->flushCalledCount);
+    auto taskCommandsSize = mockCsr->peekSubmissionAggregator()->getPendingCommandBuffersSize();
+    EXPECT_NE(0u, taskCommandsSize);
+    mockCsr->flushBatchedSubmissions();
+
+    DebugManager.flags.BatchedDispatchMaxCommandsSize.set(static_cast<int32_t>(taskCommandsSize));
+    flushTasks(*mockCsr, commandStream, 4);
+    EXPECT_EQ(5, mockCsr->flushCalledCount);
+}
+
+HWTEST_F(BatchedDispatchWithCounterTests, givenDeadlinePassedWhenNextTaskIsFlushedThenWholeBatchIsSubmitted) {
+    DebugManager.flags.BatchedDispatchDeadlineMicroseconds.set(0);
+    CommandQueueHw<FamilyType> commandQueue(nullptr, pClDevice, 0, false);
+    auto &commandStream = commandQueue.getCS(4096u);
+    auto mockCsr = createMockCsr<FamilyType>();
+
+    flushTasks(*mockCsr, commandStream, 2);
+    EXPECT_EQ(0, mockCsr->flushCalledCount);
+
+    DebugManager.flags.BatchedDispatchDeadlineMicroseconds.set(1);
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    flushTasks(*mockCsr, commandStream, 1);
+    EXPECT_EQ(1, mockCsr->flushCalledCount);
+    EXPECT_EQ(3u, mockCsr->peekLatestFlushedTaskCount());
+}
+
+HWTEST_F(BatchedDispatchWithCounterTests, givenDeadlineWhenNoFurtherTasksAreFlushedThenTimerSubmitsBatch) {
+    DebugManager.flags.BatchedDispatchDeadlineMicroseconds.set(1000);
+    CommandQueueHw<FamilyType> commandQueue(nullptr, pClDevice, 0, false);
+    auto &commandStream = commandQueue.getCS(4096u);
+    auto mockCsr = createMockCsr<FamilyType>();
+
+    flushTasks(*mockCsr, commandStream, 2);
+    ASSERT_NE(nullptr, mockCsr->implicitFlushTimer.get());
+
+    auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (mockCsr->peekLatestFlushedTaskCount() < 2u && std::chrono::steady_clock::now() < timeout) {
+        std::this_thread::yield();
+    }
+    EXPECT_EQ(2u, mockCsr->peekLatestFlushedTaskCount());
+    mockCsr->stopImplicitFlushTimer();
+    EXPECT_NE(0u, mockCsr->implicitFlushTimer->getExpirationsCount());
+    EXPECT_TRUE(mockCsr->peekSubmissionAggregator()->peekCmdBufferList().peekIsEmpty());
+}
+
+HWTEST_F(BatchedDispatchWithCounterTests, givenBlockingTaskWhenFlushedThenBatchIsSubmittedAndPendingCountersAreReset) {
+    DebugManager.flags.BatchedDispatchDeadlineMicroseconds.set(0);
+    CommandQueueHw<FamilyType> commandQueue(nullptr, pClDevice, 0, false);
+    auto &commandStream = commandQueue.getCS(4096u);
+    auto mockCsr = createMockCsr<FamilyType>();
+
+    flushTasks(*mockCsr, commandStream, 2);
+
+    DispatchFlags dispatchFlags = DispatchFlagsHelper::createDefaultDispatchFlags();
+    dispatchFlags.blocking = true;
+    mockCsr->flushTask(commandStream, commandStream.getUsed(), dsh, ioh, ssh, taskLevel, dispatchFlags, *pDevice);
+
+    EXPECT_EQ(1, mockCsr->flushCalledCount);
+    EXPECT_EQ(3u, mockCsr->peekLatestFlushedTaskCount());
+    EXPECT_EQ(0u, mockCsr->peekSubmissionAggregator()->getPendingCommandBuffersCount());
+}
@@ -0,0 +1,169 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/command_stream/scratch_space_controller_base.h"
+#include "shared/source/command_stream/scratch_space_registry.h"
+#include "shared/source/execution_environment/root_device_environment.h"
+#include "shared/source/memory_manager/graphics_allocation.h"
+#include "shared/source/os_interface/os_context.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
+
+#include "opencl/test/unit_test/fixtures/device_fixture.h"
+#include "opencl/test/unit_test/libult/ult_command_stream_receiver.h"
+#include "opencl/test/unit_test/mocks/mock_device.h"
+#include "test.h"
+
+#include <memory>
+
+using namespace NEO;
+
+struct MockScratchSpaceControllerBase : public ScratchSpaceControllerBase {
+    using ScratchSpaceControllerBase::computeUnitsUsedForScratch;
+    using ScratchSpaceControllerBase::ScratchSpaceControllerBase;
+    using ScratchSpaceControllerBase::scratchSizeBytes;
+};
+
+struct ScratchSpaceRegistryTest : public DeviceFixture, public ::testing::Test {
+    void SetUp() override {
+        DeviceFixture::SetUp();
+        registry = pDevice->getRootDeviceEnvironment().scratchSpaceRegistry.get();
+        osContext = pDevice->getDefaultEngine().osContext;
+    }
+
+    void TearDown() override {
+        DeviceFixture::TearDown();
+    }
+
+    std::unique_ptr<MockScratchSpaceControllerBase> createController() {
+        auto &csr = pDevice->getGpgpuCommandStreamReceiver();
+        return std::make_unique<MockScratchSpaceControllerBase>(pDevice->getRootDeviceIndex(), *pDevice->getExecutionEnvironment(), *csr.getInternalAllocationStorage());
+    }
+
+    void setRequiredScratchSpace(MockScratchSpaceControllerBase &controller, uint32_t perThreadScratchSize) {
+        stateBaseAddressDirty = false;
+        vfeStateDirty = false;
+        controller.setRequiredScratchSpace(nullptr, perThreadScratchSize, 0u, 0u, *osContext, stateBaseAddressDirty, vfeStateDirty);
+    }
+
+    DebugManagerStateRestore restorer;
+    ScratchSpaceRegistry *registry = nullptr;
+    OsContext *osContext = nullptr;
+    bool stateBaseAddressDirty = false;
+    bool vfeStateDirty = false;
+};
+
+TEST_F(ScratchSpaceRegistryTest, givenRegisteredSizesWhenUnregisteringThenMaxIsTrackedAndGenerationChangesOnlyWhenMaxDrops) {
+    EXPECT_EQ(0u, registry->getMaxPerThreadScratchSize());
+
+    registry->registerPerThreadScratchSize(0x100);
+    registry->registerPerThreadScratchSize(0x400);
+    registry->registerPerThreadScratchSize(0x400);
+    EXPECT_EQ(0x400u, registry->getMaxPerThreadScratchSize());
+    auto generation = registry->getGeneration();
+
+    registry->unregisterPerThreadScratchSize(0x400);
+    EXPECT_EQ(0x400u, registry->getMaxPerThreadScratchSize());
+    EXPECT_EQ(generation, registry->getGeneration());
+
+    registry->unregisterPerThreadScratchSize(0x400);
+    EXPECT_EQ(0x100u, registry->getMaxPerThreadScratchSize());
+    EXPECT_NE(generation, registry->getGeneration());
+
+    registry->unregisterPerThreadScratchSize(0x100);
+    EXPECT_EQ(0u, registry->getMaxPerThreadScratchSize());
+}
+
+TEST_F(ScratchSpaceRegistryTest, givenRegisteredProgramScratchWhenSmallerScratchIsRequiredThenAllocationFitsRegisteredMaximum) {
+    DebugManager.flags.EnableSharedScratchSpace.set(0);
+    auto controller = createController();
+    registry->registerPerThreadScratchSize(0x400);
+
+    setRequiredScratchSpace(*controller, 0x100);
+    ASSERT_NE(nullptr, controller->getScratchSpaceAllocation());
+    EXPECT_EQ(0x400u * controller->computeUnitsUsedForScratch, controller->scratchSizeBytes);
+    EXPECT_TRUE(vfeStateDirty);
+
+    auto scratchAllocation = controller->getScratchSpaceAllocation();
+    setRequiredScratchSpace(*controller, 0x400);
+    EXPECT_EQ(scratchAllocation, controller->getScratchSpaceAllocation());
+    EXPECT_FALSE(stateBaseAddressDirty);
+    EXPECT_TRUE(vfeStateDirty);
+
+    setRequiredScratchSpace(*controller, 0x400);
+    EXPECT_FALSE(vfeStateDirty);
+
+    registry->unregisterPerThreadScratchSize(0x400);
+}
+
+TEST_F(ScratchSpaceRegistryTest, givenUnregisteredProgramScratchWhenScratchIsRequiredThenAllocationShrinks) {
+    DebugManager.flags.EnableSharedScratchSpace.set(0);
+    auto controller = createController();
+    registry->registerPerThreadScratchSize(0x400);
+    setRequiredScratchSpace(*controller, 0x100);
+    auto scratchAllocation = controller->getScratchSpaceAllocation();
+
+    registry->unregisterPerThreadScratchSize(0x400);
+    setRequiredScratchSpace(*controller, 0x100);
+    EXPECT_NE(scratchAllocation, controller->getScratchSpaceAllocation());
+    EXPECT_EQ(0x100u * controller->computeUnitsUsedForScratch, controller->scratchSizeBytes);
+    EXPECT_TRUE(vfeStateDirty);
+}
+
+TEST_F(ScratchSpaceRegistryTest, givenSharedScratchSpaceWhenControllersOfSameEngineRequireScratchThenAllocationIsShared) {
+    DebugManager.flags.EnableSharedScratchSpace.set(1);
+    auto controller1 = createController();
+    auto controller2 = createController();
+    EXPECT_TRUE(controller1->isSharedScratchSpaceEnabled());
+
+    setRequiredScratchSpace(*controller1, 0x100);
+    setRequiredScratchSpace(*controller2, 0x100);
+    ASSERT_NE(nullptr, controller1->getScratchSpaceAllocation());
+    EXPECT_EQ(controller1->getScratchSpaceAllocation(), controller2->getScratchSpaceAllocation());
+    EXPECT_EQ(1u, registry->getSharedScratchAllocationsCount());
+
+    setRequiredScratchSpace(*controller2, 0x200);
+    EXPECT_NE(controller1->getScratchSpaceAllocation(), controller2->getScratchSpaceAllocation());
+    EXPECT_EQ(2u, registry->getSharedScratchAllocationsCount());
+    EXPECT_EQ(0x200u * controller2->computeUnitsUsedForScratch, controller2->scratchSizeBytes);
+
+    setRequiredScratchSpace(*controller1, 0x100);
+    EXPECT_EQ(controller1->getScratchSpaceAllocation(), controller2->getScratchSpaceAllocation());
+    EXPECT_EQ(1u, registry->getSharedScratchAllocationsCount());
+    EXPECT_TRUE(vfeStateDirty);
+
+    controller1.reset();
+    EXPECT_EQ(1u, registry->getSharedScratchAllocationsCount());
+    controller2.reset();
+    EXPECT_EQ(0u, registry->getSharedScratchAllocationsCount());
+}
+
+TEST_F(ScratchSpaceRegistryTest, givenSharedScratchSpaceWhenOneUserRequiresBiggerScratchThenSharedAllocationDoesNotShrinkBelowIt) {
+    DebugManager.flags.EnableSharedScratchSpace.set(1);
+    auto controller1 = createController();
+    auto controller2 = createController();
+
+    setRequiredScratchSpace(*controller1, 0x400);
+    setRequiredScratchSpace(*controller2, 0x100);
+    EXPECT_EQ(controller1->getScratchSpaceAllocation(), controller2->getScratchSpaceAllocation());
+    EXPECT_EQ(0x400u * controller2->computeUnitsUsedForScratch, controller2->scratchSizeBytes);
+}
+
+HWTEST_F(ScratchSpaceRegistryTest, givenProgramWithBiggerScratchUnregisteredWhenSettingRequiredScratchSizesThenHighWaterMarkStartsOver) {
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    registry->registerPerThreadScratchSize(0x100);
+    registry->registerPerThreadScratchSize(0x400);
+
+    csr.setRequiredScratchSizes(0x400, 0u);
+    csr.setRequiredScratchSizes(0x100, 0u);
+    EXPECT_EQ(0x400u, csr.requiredScratchSize);
+
+    registry->unregisterPerThreadScratchSize(0x400);
+    csr.setRequiredScratchSizes(0x100, 0u);
+    EXPECT_EQ(0x100u, csr.requiredScratchSize);
+
+    registry->unregisterPerThreadScratchSize(0x100);
+}
@@ -5,12 +5,15 @@
  *
  */
 
+#include "shared/source/helpers/register_offsets.h"
 #include "shared/source/memory_manager/internal_allocation_storage.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/os_interface/os_context.h"
 #include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
 
 #include "opencl/test/unit_test/command_queue/enqueue_fixture.h"
+#include "opencl/test/unit_test/helpers/hw_parse.h"
+#include "opencl/test/unit_test/mocks/mock_command_queue.h"
 #include "opencl/test/unit_test/mocks/mock_event.h"
 
 #include "event_fixture.h"
@@ -1075,3 +1078,179 @@ TEST_F(EventTests, givenUserEventWhenSetStatusIsDoneThenDeviceMutextisAcquired)
     clSetUserEventStatus(&mockEvent, CL_COMPLETE);
     EXPECT_TRUE(mockEvent.mutexProperlyAcquired);
 }
+
+HWTEST_F(EventTests, givenGpuWaitForUserEventsEnabledWhenEnqueueingKernelDependingOnUserEventThenKernelIsSubmittedWithSemaphoreAndPredicatedWalker) {
+    using MI_SEMAPHORE_WAIT = typename FamilyType::MI_SEMAPHORE_WAIT;
+    using MI_LOAD_REGISTER_MEM = typename FamilyType::MI_LOAD_REGISTER_MEM;
+    using WALKER_TYPE = typename FamilyType::WALKER_TYPE;
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableGpuWaitForUserEvents.set(1);
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    csr.timestampPacketWriteEnabled = true;
+    MockCommandQueueHw<FamilyType> cmdQ(context, pClDevice, nullptr);
+
+    auto userEvent = make_releaseable<UserEvent>(context);
+    cl_event waitEvent = userEvent.get();
+    cl_event outEvent = nullptr;
+    auto taskCount = csr.peekTaskCount();
+    size_t gws[3] = {1, 1, 1};
+
+    auto retVal = cmdQ.enqueueKernel(pKernel, 1, nullptr, gws, nullptr, 1, &waitEvent, &outEvent);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(taskCount + 1, csr.peekTaskCount());
+    EXPECT_EQ(nullptr, cmdQ.virtualEvent);
+    EXPECT_FALSE(cmdQ.isQueueBlocked());
+
+    ASSERT_NE(nullptr, userEvent->getTimestampPacketNodes());
+    ASSERT_EQ(1u, userEvent->getTimestampPacketNodes()->peekNodes().size());
+    auto userEventNode = userEvent->getTimestampPacketNodes()->peekNodes()[0];
+    EXPECT_FALSE(userEventNode->tagForCpuAccess->isCompleted());
+    EXPECT_TRUE(csr.isMadeResident(userEventNode->getBaseGraphicsAllocation()));
+
+    // output event reports status of user event
+    auto outputEvent = castToObject<Event>(outEvent);
+    EXPECT_TRUE(outputEvent->peekIsBlocked());
+
+    HardwareParse hwParse;
+    hwParse.parseCommands<FamilyType>(cmdQ.getCS(0), 0);
+    bool semaphoreFound = false;
+    bool predicateLoadedAfterSemaphore = false;
+    uint32_t walkersFound = 0;
+    for (auto &cmd : hwParse.cmdList) {
+        if (auto semaphore = genCmdCast<MI_SEMAPHORE_WAIT *>(cmd)) {
+            semaphoreFound |= (semaphore->getSemaphoreGraphicsAddress() == userEventNode->getGpuAddress() + offsetof(TimestampPacketStorage, packets[0].contextEnd));
+        }
+        if (auto loadRegisterMem = genCmdCast<MI_LOAD_REGISTER_MEM *>(cmd)) {
+            if (loadRegisterMem->getRegisterAddress() == CS_PREDICATE_RESULT) {
+                EXPECT_EQ(userEventNode->getGpuAddress() + offsetof(TimestampPacketStorage, packets[0].contextStart), loadRegisterMem->getMemoryAddress());
+                predicateLoadedAfterSemaphore = semaphoreFound;
+            }
+        }
+        if (auto walker = genCmdCast<WALKER_TYPE *>(cmd)) {
+            EXPECT_TRUE(walker->getPredicateEnable());
+            walkersFound++;
+        }
+    }
+    EXPECT_TRUE(semaphoreFound);
+    EXPECT_TRUE(predicateLoadedAfterSemaphore);
+    EXPECT_EQ(1u, walkersFound);
+
+    // GPU would decrement it after semaphore
+    userEventNode->tagForCpuAccess->implicitDependenciesCount.store(0);
+    retVal = clSetUserEventStatus(userEvent.get(), CL_COMPLETE);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_TRUE(userEventNode->tagForCpuAccess->isCompleted());
+    EXPECT_EQ(1u, userEventNode->tagForCpuAccess->packets[0].contextStart);
+    EXPECT_EQ(taskCount + 1, csr.peekTaskCount());
+    EXPECT_FALSE(outputEvent->peekIsBlocked());
+    EXPECT_LE(0, outputEvent->peekExecutionStatus());
+
+    clReleaseEvent(outEvent);
+}
+
+HWTEST_F(EventTests, givenGpuWaitForUserEventsEnabledWhenUserEventIsTerminatedThenPredicateIsClearedAndOutputEventIsTerminated) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableGpuWaitForUserEvents.set(1);
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    csr.timestampPacketWriteEnabled = true;
+    MockCommandQueueHw<FamilyType> cmdQ(context, pClDevice, nullptr);
+
+    auto userEvent = make_releaseable<UserEvent>(context);
+    cl_event waitEvent = userEvent.get();
+    cl_event outEvent = nullptr;
+    size_t gws[3] = {1, 1, 1};
+
+    auto retVal = cmdQ.enqueueKernel(pKernel, 1, nullptr, gws, nullptr, 1, &waitEvent, &outEvent);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    auto userEventNode = userEvent->getTimestampPacketNodes()->peekNodes()[0];
+    auto outputEvent = castToObject<Event>(outEvent);
+
+    userEventNode->tagForCpuAccess->implicitDependenciesCount.store(0);
+    retVal = clSetUserEventStatus(userEvent.get(), -1);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_TRUE(userEventNode->tagForCpuAccess->isCompleted());
+    EXPECT_EQ(0u, userEventNode->tagForCpuAccess->packets[0].contextStart);
+    EXPECT_EQ(-1, outputEvent->peekExecutionStatus());
+
+    clReleaseEvent(outEvent);
+}
+
+HWTEST_F(EventTests, givenUserEventWaitedOnGpuWhenItIsReleasedWithoutStatusThenWaitingEventsAreTerminatedAndGpuIsReleased) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableGpuWaitForUserEvents.set(1);
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    MockEvent<Event> outputEvent(pCmdQ, CL_COMMAND_NDRANGE_KERNEL, 0, 0);
+
+    auto userEvent = new UserEvent(context);
+    EXPECT_TRUE(userEvent->prepareForGpuWait(csr, &outputEvent));
+    EXPECT_TRUE(outputEvent.peekIsBlocked());
+    auto userEventNode = userEvent->getTimestampPacketNodes()->peekNodes()[0];
+    userEventNode->incRefCount();
+
+    userEvent->release();
+    EXPECT_FALSE(outputEvent.peekIsBlocked());
+    EXPECT_GT(0, outputEvent.peekExecutionStatus());
+    EXPECT_EQ(0u, userEventNode->tagForCpuAccess->packets[0].contextEnd);
+    EXPECT_EQ(0u, userEventNode->tagForCpuAccess->packets[0].contextStart);
+    userEventNode->returnTag();
+}
+
+HWTEST_F(EventTests, givenGpuWaitForUserEventsEnabledWhenUserEventStatusIsAlreadySetThenUserEventIsNotPreparedForGpuWait) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableGpuWaitForUserEvents.set(1);
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+
+    auto userEvent = make_releaseable<UserEvent>(context);
+    EXPECT_TRUE(userEvent->prepareForGpuWait(csr, nullptr));
+    EXPECT_TRUE(userEvent->prepareForGpuWait(csr, nullptr));
+    EXPECT_EQ(1u, userEvent->getTimestampPacketNodes()->peekNodes().size());
+
+    userEvent->setStatus(-1);
+    EXPECT_FALSE(userEvent->prepareForGpuWait(csr, nullptr));
+    auto userEventNode = userEvent->getTimestampPacketNodes()->peekNodes()[0];
+    EXPECT_TRUE(userEventNode->tagForCpuAccess->isCompleted());
+}
+
+HWTEST_F(EventTests, givenGpuWaitForUserEventsEnabledWhenEnqueueCantBePredicatedOnSingleUserEventThenUserEventsAreNotWaitedOnGpu) {
+    struct MyCmdQ : public MockCommandQueueHw<FamilyType> {
+        using MockCommandQueueHw<FamilyType>::MockCommandQueueHw;
+        using CommandQueue::prepareUserEventsForGpuWait;
+    };
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableGpuWaitForUserEvents.set(1);
+    pDevice->getUltCommandStreamReceiver<FamilyType>().timestampPacketWriteEnabled = true;
+    MyCmdQ cmdQ(context, pClDevice, nullptr);
+
+    auto userEvent = make_releaseable<UserEvent>(context);
+    auto secondUserEvent = make_releaseable<UserEvent>(context);
+    MockEvent<Event> submittedEvent(&cmdQ, CL_COMMAND_NDRANGE_KERNEL, 3, 1);
+    MockEvent<Event> notSubmittedEvent(&cmdQ, CL_COMMAND_NDRANGE_KERNEL, CompletionStamp::levelNotReady, 0);
+
+    MultiDispatchInfo multiDispatchInfo(pKernel);
+    multiDispatchInfo.push(DispatchInfo(pKernel, 1, {1, 1, 1}, {1, 1, 1}, {0, 0, 0}));
+    MultiDispatchInfo emptyMultiDispatchInfo;
+
+    std::vector<cl_event> eventsForTaskLevel;
+    cl_event waitList[] = {userEvent.get(), &submittedEvent};
+    EXPECT_EQ(userEvent.get(), cmdQ.prepareUserEventsForGpuWait(CL_COMMAND_NDRANGE_KERNEL, multiDispatchInfo, 2, waitList, nullptr, eventsForTaskLevel));
+    ASSERT_EQ(1u, eventsForTaskLevel.size());
+    EXPECT_EQ(&submittedEvent, eventsForTaskLevel[0]);
+
+    eventsForTaskLevel.clear();
+    EXPECT_EQ(nullptr, cmdQ.prepareUserEventsForGpuWait(CL_COMMAND_MARKER, emptyMultiDispatchInfo, 2, waitList, nullptr, eventsForTaskLevel));
+
+    eventsForTaskLevel.clear();
+    cl_event waitListWithNotSubmittedEvent[] = {userEvent.get(), &notSubmittedEvent};
+    EXPECT_EQ(nullptr, cmdQ.prepareUserEventsForGpuWait(CL_COMMAND_NDRANGE_KERNEL, multiDispatchInfo, 2, waitListWithNotSubmittedEvent, nullptr, eventsForTaskLevel));
+
+    eventsForTaskLevel.clear();
+    cl_event waitListWithTwoUserEvents[] = {userEvent.get(), secondUserEvent.get()};
+    EXPECT_EQ(nullptr, cmdQ.prepareUserEventsForGpuWait(CL_COMMAND_NDRANGE_KERNEL, multiDispatchInfo, 2, waitListWithTwoUserEvents, nullptr, eventsForTaskLevel));
+    EXPECT_EQ(nullptr, secondUserEvent->getTimestampPacketNodes());
+
+    eventsForTaskLevel.clear();
+    DebugManager.flags.EnableGpuWaitForUserEvents.set(0);
+    EXPECT_EQ(nullptr, cmdQ.prepareUserEventsForGpuWait(CL_COMMAND_NDRANGE_KERNEL, multiDispatchInfo, 2, waitList, nullptr, eventsForTaskLevel));
+
+    userEvent->setStatus(CL_COMPLETE);
+}
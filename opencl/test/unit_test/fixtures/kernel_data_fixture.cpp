@@ -117,6 +117,10 @@ void KernelDataTest::buildAndDecode() {
         EXPECT_EQ(0, memcmp(pKernelInfo->heapInfo.pSsh, pSsh, sshSize));
     }
     if (kernelHeapSize) {
+        if (pKernelInfo->isKernelAllocationDeferred()) {
+            EXPECT_EQ(nullptr, pKernelInfo->getGraphicsAllocation());
+            EXPECT_TRUE(const_cast<KernelInfo *>(pKernelInfo)->createDeferredKernelAllocation());
+        }
         auto kernelAllocation = pKernelInfo->getGraphicsAllocation();
         UNRECOVERABLE_IF(kernelAllocation == nullptr);
         EXPECT_EQ(kernelAllocation->getUnderlyingBufferSize(), kernelHeapSize);
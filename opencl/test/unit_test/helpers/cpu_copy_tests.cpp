@@ -0,0 +1,157 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/utilities/cpu_info.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
+
+#include "opencl/source/helpers/cpu_copy.h"
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+using namespace NEO;
+
+namespace {
+std::vector<uint8_t> createPattern(size_t size) {
+    std::vector<uint8_t> pattern(size);
+    for (size_t i = 0; i < size; i++) {
+        pattern[i] = static_cast<uint8_t>(i * 7 + i / 251);
+    }
+    return pattern;
+}
+} // namespace
+
+struct CpuCopyNonTemporalTest : public ::testing::TestWithParam<void (*)(void *, const void *, size_t)> {
+};
+
+TEST_P(CpuCopyNonTemporalTest, givenUnalignedPointersAndSizesWhenCopyingThenAllBytesAreCopiedAndNeighboursAreUntouched) {
+    auto copyFunction = GetParam();
+    if (copyFunction == copyNonTemporalAvx2 && !CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureAvX2)) {
+        GTEST_SKIP();
+    }
+
+    auto source = createPattern(1024);
+    for (size_t size : {0u, 1u, 15u, 31u, 64u, 129u, 517u}) {
+        for (size_t misalignment : {0u, 1u, 7u, 33u}) {
+            std::vector<uint8_t> destination(1024 + 64, 0xcd);
+            copyFunction(destination.data() + misalignment, source.data() + 3, size);
+
+            EXPECT_EQ(0, memcmp(destination.data() + misalignment, source.data() + 3, size));
+            for (size_t i = 0; i < misalignment; i++) {
+                EXPECT_EQ(0xcd, destination[i]);
+            }
+            EXPECT_EQ(0xcd, destination[misalignment + size]);
+        }
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(CpuCopy,
+                        CpuCopyNonTemporalTest,
+                        ::testing::Values(copyNonTemporalSse2, copyNonTemporalAvx2));
+
+TEST(CpuCopyHelperTest, givenAvx2SupportWhenCheckingNonTemporalCopyFunctionThenAvx2VersionIsSelected) {
+    if (CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureAvX2)) {
+        EXPECT_EQ(copyNonTemporalAvx2, CpuCopyHelper::copyNonTemporal);
+    } else {
+        EXPECT_EQ(copyNonTemporalSse2, CpuCopyHelper::copyNonTemporal);
+    }
+}
+
+TEST(CpuCopyHelperTest, givenCopySizeWhenGettingThreadCountThenSmallCopiesAreSingleThreaded) {
+    DebugManagerStateRestore restorer;
+    size_t defaultMultiThreadThreshold = CpuCopyHelper::defaultMultiThreadThreshold;
+    size_t minChunkSize = CpuCopyHelper::minChunkSize;
+    size_t maxDefaultThreadCount = CpuCopyHelper::maxDefaultThreadCount;
+
+    EXPECT_EQ(1u, CpuCopyHelper::getThreadCount(defaultMultiThreadThreshold - 1));
+    EXPECT_LE(CpuCopyHelper::getThreadCount(defaultMultiThreadThreshold), maxDefaultThreadCount);
+
+    DebugManager.flags.CpuCopyThreadCount.set(4);
+    EXPECT_EQ(4u, CpuCopyHelper::getThreadCount(defaultMultiThreadThreshold));
+
+    DebugManager.flags.CpuCopyMultiThreadThreshold.set(0);
+    EXPECT_EQ(1u, CpuCopyHelper::getThreadCount(minChunkSize));
+    EXPECT_EQ(2u, CpuCopyHelper::getThreadCount(2 * minChunkSize));
+}
+
+TEST(CpuCopyHelperTest, givenDebugFlagWhenCheckingNonTemporalStoresThenFlagOverridesSizeHeuristic) {
+    DebugManagerStateRestore restorer;
+    size_t nonTemporalThreshold = CpuCopyHelper::nonTemporalThreshold;
+
+    EXPECT_FALSE(CpuCopyHelper::useNonTemporalStores(nonTemporalThreshold - 1));
+    EXPECT_TRUE(CpuCopyHelper::useNonTemporalStores(nonTemporalThreshold));
+
+    DebugManager.flags.EnableCpuCopyNonTemporalStores.set(0);
+    EXPECT_FALSE(CpuCopyHelper::useNonTemporalStores(nonTemporalThreshold));
+
+    DebugManager.flags.EnableCpuCopyNonTemporalStores.set(1);
+    EXPECT_TRUE(CpuCopyHelper::useNonTemporalStores(1));
+}
+
+TEST(CpuCopyHelperTest, givenCopySplitAcrossThreadsWhenCopyingThenAllBytesAreCopied) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.CpuCopyMultiThreadThreshold.set(0);
+    DebugManager.flags.CpuCopyThreadCount.set(3);
+
+    size_t size = 3 * CpuCopyHelper::minChunkSize + 13;
+    auto source = createPattern(size + 1);
+
+    for (auto nonTemporal : {0, 1}) {
+        DebugManager.flags.EnableCpuCopyNonTemporalStores.set(nonTemporal);
+        std::vector<uint8_t> destination(size + 1, 0u);
+        CpuCopyHelper::copy(destination.data() + 1, source.data(), size);
+        EXPECT_EQ(0, memcmp(destination.data() + 1, source.data(), size));
+    }
+}
+
+TEST(CpuCopyHelperTest, givenPitchedRegionWhenCopyingThenOnlyRegionRowsAreCopied) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.CpuCopyMultiThreadThreshold.set(0);
+    DebugManager.flags.CpuCopyThreadCount.set(2);
+
+    constexpr size_t rowSize = 24;
+    constexpr size_t rows = 5;
+    constexpr size_t slices = 3;
+    constexpr size_t srcRowPitch = 32;
+    constexpr size_t srcSlicePitch = srcRowPitch * rows + 16;
+    constexpr size_t dstRowPitch = 40;
+    constexpr size_t dstSlicePitch = dstRowPitch * rows;
+
+    auto source = createPattern(srcSlicePitch * slices);
+    std::vector<uint8_t> destination(dstSlicePitch * slices, 0xcd);
+
+    CpuCopyHelper::copyRegion(destination.data(), dstRowPitch, dstSlicePitch,
+                              source.data(), srcRowPitch, srcSlicePitch,
+                              {{rowSize, rows, slices}});
+
+    for (size_t slice = 0; slice < slices; slice++) {
+        for (size_t row = 0; row < rows; row++) {
+            auto dstRow = ptrOffset(destination.data(), slice * dstSlicePitch + row * dstRowPitch);
+            auto srcRow = ptrOffset(source.data(), slice * srcSlicePitch + row * srcRowPitch);
+            EXPECT_EQ(0, memcmp(dstRow, srcRow, rowSize));
+            for (size_t i = rowSize; i < dstRowPitch; i++) {
+                EXPECT_EQ(0xcd, dstRow[i]);
+            }
+        }
+    }
+}
+
+TEST(CpuCopyHelperTest, givenContiguousRegionWhenCopyingThenWholeRegionIsCopied) {
+    constexpr size_t rowSize = 16;
+    constexpr size_t rows = 4;
+    constexpr size_t slices = 2;
+
+    auto source = createPattern(rowSize * rows * slices);
+    std::vector<uint8_t> destination(rowSize * rows * slices, 0u);
+
+    CpuCopyHelper::copyRegion(destination.data(), rowSize, rowSize * rows,
+                              source.data(), rowSize, rowSize * rows,
+                              {{rowSize, rows, slices}});
+    EXPECT_EQ(source, destination);
+}
@@ -48,9 +48,11 @@ struct KmdNotifyTests : public ::testing::Test {
     class MockKmdNotifyHelper : public KmdNotifyHelper {
       public:
         using KmdNotifyHelper::acLineConnected;
+        using KmdNotifyHelper::averageWaitLatencyUs;
         using KmdNotifyHelper::getMicrosecondsSinceEpoch;
         using KmdNotifyHelper::lastWaitForCompletionTimestampUs;
         using KmdNotifyHelper::properties;
+        using KmdNotifyHelper::waitsCount;
 
         MockKmdNotifyHelper() = delete;
         MockKmdNotifyHelper(const KmdNotifyProperties *newProperties) : KmdNotifyHelper(newProperties){};
@@ -413,6 +415,119 @@ TEST_F(KmdNotifyTests, givenEnabledKmdNotifyMechanismWhenPowerSavingModeIsSetAnd
     EXPECT_EQ(0, timeout);
 }
 
+TEST_F(KmdNotifyTests, givenAdaptiveWaitDisabledWhenWaitsWereRecordedThenBaseTimeoutIsUsed) {
+    overrideKmdNotifyParams(true, 150, false, 0, false, 0);
+    MockKmdNotifyHelper helper(&(hwInfo->capabilityTable.kmdNotifyProperties));
+    helper.waitsCount = KmdNotifyConstants::adaptiveWaitMinimumSamples;
+    helper.averageWaitLatencyUs = 10;
+
+    int64_t timeout = 0;
+    EXPECT_TRUE(helper.obtainTimeoutParams(timeout, false, 1, 2, 2, false));
+    EXPECT_EQ(150, timeout);
+    EXPECT_EQ(0u, helper.getWaitStatistics().adaptiveSpinDecisions);
+}
+
+TEST_F(KmdNotifyTests, givenAdaptiveWaitEnabledAndNotEnoughSamplesWhenObtainingTimeoutThenBaseTimeoutIsUsed) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.EnableAdaptiveKmdNotifyWait.set(1);
+    overrideKmdNotifyParams(true, 150, false, 0, false, 0);
+    MockKmdNotifyHelper helper(&(hwInfo->capabilityTable.kmdNotifyProperties));
+    helper.waitsCount = KmdNotifyConstants::adaptiveWaitMinimumSamples - 1;
+    helper.averageWaitLatencyUs = 10;
+
+    int64_t timeout = 0;
+    EXPECT_TRUE(helper.obtainTimeoutParams(timeout, false, 1, 2, 2, false));
+    EXPECT_EQ(150, timeout);
+}
+
+TEST_F(KmdNotifyTests, givenAdaptiveWaitEnabledAndShortCompletionLatencyWhenObtainingTimeoutThenSpinPeriodIsShortened) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.EnableAdaptiveKmdNotifyWait.set(1);
+    overrideKmdNotifyParams(true, 150, false, 0, false, 0);
+    MockKmdNotifyHelper helper(&(hwInfo->capabilityTable.kmdNotifyProperties));
+    helper.waitsCount = KmdNotifyConstants::adaptiveWaitMinimumSamples;
+    helper.averageWaitLatencyUs = 10;
+
+    int64_t timeout = 0;
+    EXPECT_TRUE(helper.obtainTimeoutParams(timeout, false, 1, 2, 2, false));
+    EXPECT_EQ(10 * KmdNotifyConstants::adaptiveWaitSpinMultiplier, timeout);
+
+    helper.averageWaitLatencyUs = 100;
+    EXPECT_TRUE(helper.obtainTimeoutParams(timeout, false, 1, 2, 2, false));
+    EXPECT_EQ(150, timeout);
+
+    auto statistics = helper.getWaitStatistics();
+    EXPECT_EQ(2u, statistics.adaptiveSpinDecisions);
+    EXPECT_EQ(0u, statistics.adaptiveSleepDecisions);
+}
+
+TEST_F(KmdNotifyTests, givenAdaptiveWaitEnabledAndLongCompletionLatencyWhenObtainingTimeoutThenKmdSleepIsUsedImmediately) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.EnableAdaptiveKmdNotifyWait.set(1);
+    overrideKmdNotifyParams(true, 150, false, 0, false, 0);
+    MockKmdNotifyHelper helper(&(hwInfo->capabilityTable.kmdNotifyProperties));
+    helper.waitsCount = KmdNotifyConstants::adaptiveWaitMinimumSamples;
+    helper.averageWaitLatencyUs = 1000;
+
+    int64_t timeout = 150;
+    EXPECT_TRUE(helper.obtainTimeoutParams(timeout, false, 1, 2, 2, false));
+    EXPECT_EQ(0, timeout);
+
+    auto statistics = helper.getWaitStatistics();
+    EXPECT_EQ(0u, statistics.adaptiveSpinDecisions);
+    EXPECT_EQ(1u, statistics.adaptiveSleepDecisions);
+}
+
+TEST_F(KmdNotifyTests, givenAdaptiveWaitEnabledAndDisabledKmdNotifyWhenObtainingTimeoutThenTimeoutIsNotAdjusted) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.EnableAdaptiveKmdNotifyWait.set(1);
+    overrideKmdNotifyParams(false, 150, false, 0, false, 0);
+    MockKmdNotifyHelper helper(&(hwInfo->capabilityTable.kmdNotifyProperties));
+    helper.waitsCount = KmdNotifyConstants::adaptiveWaitMinimumSamples;
+    helper.averageWaitLatencyUs = 1000;
+
+    int64_t timeout = 0;
+    EXPECT_FALSE(helper.obtainTimeoutParams(timeout, false, 1, 2, 2, false));
+    EXPECT_EQ(150, timeout);
+    EXPECT_EQ(0u, helper.getWaitStatistics().adaptiveSleepDecisions);
+}
+
+TEST_F(KmdNotifyTests, givenRecordedWaitsWhenUpdatingWaitStatisticsThenWeightedAverageLatencyAndCountersAreUpdated) {
+    MockKmdNotifyHelper helper(&(hwInfo->capabilityTable.kmdNotifyProperties));
+
+    auto now = helper.getMicrosecondsSinceEpoch();
+    helper.updateWaitStatistics(now + 1000000, true);
+    auto statistics = helper.getWaitStatistics();
+    EXPECT_EQ(1u, statistics.waitsCount);
+    EXPECT_EQ(1u, statistics.completedDuringSpin);
+    EXPECT_EQ(0, statistics.averageWaitLatencyUs);
+
+    helper.updateWaitStatistics(helper.getMicrosecondsSinceEpoch() - 8000, false);
+    statistics = helper.getWaitStatistics();
+    EXPECT_EQ(2u, statistics.waitsCount);
+    EXPECT_EQ(1u, statistics.completedAfterSleep);
+    EXPECT_LE(1000, statistics.averageWaitLatencyUs);
+    EXPECT_GT(8000, statistics.averageWaitLatencyUs);
+}
+
+HWTEST_F(KmdNotifyTests, givenTaskCountNotReachedOnEntryWhenWaitingThenWaitIsRecordedInStatistics) {
+    auto csr = createMockCsr<FamilyType>();
+    *csr->getTagAddress() = taskCountToWait - 1;
+
+    EXPECT_CALL(*csr, waitForCompletionWithTimeout(::testing::_, ::testing::_, taskCountToWait)).Times(1).WillOnce(::testing::Invoke([&](bool, int64_t, uint32_t) {
+        *csr->getTagAddress() = taskCountToWait;
+        return true;
+    }));
+    csr->waitForTaskCountWithKmdNotifyFallback(taskCountToWait, flushStampToWait, false, false);
+
+    EXPECT_EQ(1u, mockKmdNotifyHelper->getWaitStatistics().waitsCount);
+    EXPECT_EQ(1u, mockKmdNotifyHelper->getWaitStatistics().completedDuringSpin);
+
+    EXPECT_CALL(*csr, waitForCompletionWithTimeout(::testing::_, ::testing::_, taskCountToWait)).Times(1).WillOnce(::testing::Return(true));
+    csr->waitForTaskCountWithKmdNotifyFallback(taskCountToWait, flushStampToWait, false, false);
+    EXPECT_EQ(1u, mockKmdNotifyHelper->getWaitStatistics().waitsCount);
+}
+
 #if defined(__clang__)
 #pragma clang diagnostic pop
 #endif
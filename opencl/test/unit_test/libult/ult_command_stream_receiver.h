@@ -86,6 +86,9 @@ class UltCommandStreamReceiver : public CommandStreamReceiverHw<GfxFamily>, publ
 
     UltCommandStreamReceiver(ExecutionEnvironment &executionEnvironment, uint32_t rootDeviceIndex) : BaseClass(executionEnvironment, rootDeviceIndex), recursiveLockCounter(0),
                                                                                                      recordedDispatchFlags(DispatchFlagsHelper::createDefaultDispatchFlags()) {}
+    ~UltCommandStreamReceiver() override {
+        this->stopImplicitFlushTimer();
+    }
     static CommandStreamReceiver *create(bool withAubDump, ExecutionEnvironment &executionEnvironment, uint32_t rootDeviceIndex) {
         return new UltCommandStreamReceiver<GfxFamily>(executionEnvironment, rootDeviceIndex);
     }
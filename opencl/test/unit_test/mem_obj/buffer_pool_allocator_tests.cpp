@@ -0,0 +1,169 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/os_interface/os_context.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
+
+#include "opencl/source/mem_obj/buffer.h"
+#include "opencl/source/mem_obj/buffer_pool_allocator.h"
+#include "opencl/test/unit_test/mocks/mock_cl_device.h"
+#include "opencl/test/unit_test/mocks/mock_context.h"
+#include "opencl/test/unit_test/mocks/mock_device.h"
+
+#include "gtest/gtest.h"
+
+#include <memory>
+
+using namespace NEO;
+
+struct BufferPoolAllocatorTest : public ::testing::Test {
+    void SetUp() override {
+        DebugManager.flags.EnableSmallBufferPool.set(1);
+        device = std::make_unique<MockClDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+        context = std::make_unique<MockContext>(device.get());
+        context->bufferPoolAllocator = new BufferPoolAllocator(*context);
+    }
+
+    void TearDown() override {
+        delete context->bufferPoolAllocator;
+        context->bufferPoolAllocator = nullptr;
+    }
+
+    Buffer *createBuffer(cl_mem_flags flags, size_t size, void *hostPtr = nullptr) {
+        retVal = CL_INVALID_VALUE;
+        return Buffer::create(context.get(), flags, size, hostPtr, retVal);
+    }
+
+    DebugManagerStateRestore restorer;
+    std::unique_ptr<MockClDevice> device;
+    std::unique_ptr<MockContext> context;
+    cl_int retVal = CL_SUCCESS;
+};
+
+TEST_F(BufferPoolAllocatorTest, givenSmallBuffersWhenCreatedThenTheyShareOnePoolAllocationAtDifferentOffsets) {
+    std::unique_ptr<Buffer> buffer1(createBuffer(CL_MEM_READ_WRITE, 256));
+    ASSERT_NE(nullptr, buffer1);
+    std::unique_ptr<Buffer> buffer2(createBuffer(CL_MEM_READ_ONLY, 1024));
+    ASSERT_NE(nullptr, buffer2);
+
+    EXPECT_TRUE(buffer1->isPooled());
+    EXPECT_TRUE(buffer2->isPooled());
+    EXPECT_EQ(buffer1->getGraphicsAllocation(), buffer2->getGraphicsAllocation());
+    EXPECT_NE(buffer1->getOffset(), buffer2->getOffset());
+    EXPECT_EQ(ptrOffset(buffer1->getGraphicsAllocation()->getUnderlyingBuffer(), buffer1->getOffset()), buffer1->getCpuAddress());
+    EXPECT_EQ(ptrOffset(buffer2->getGraphicsAllocation()->getUnderlyingBuffer(), buffer2->getOffset()), buffer2->getCpuAddress());
+    EXPECT_EQ(256u, buffer1->getSize());
+
+    auto statistics = context->getBufferPoolAllocator()->getStatistics();
+    EXPECT_EQ(1u, statistics.poolsCount);
+    EXPECT_EQ(2u, statistics.buffersCount);
+    EXPECT_EQ(2u, statistics.pooledBuffersCreated);
+    EXPECT_EQ(256u + 1024u, statistics.requestedSize);
+    EXPECT_LE(statistics.requestedSize, statistics.allocatedSize);
+}
+
+TEST_F(BufferPoolAllocatorTest, givenPooledBufferWhenQueryingOffsetThenPoolOffsetIsNotVisible) {
+    std::unique_ptr<Buffer> filler(createBuffer(CL_MEM_READ_WRITE, 256));
+    std::unique_ptr<Buffer> buffer(createBuffer(CL_MEM_READ_WRITE, 1024));
+    ASSERT_NE(nullptr, buffer);
+    EXPECT_NE(0u, buffer->getPoolOffset());
+
+    size_t offset = 1;
+    EXPECT_EQ(CL_SUCCESS, buffer->getMemObjectInfo(CL_MEM_OFFSET, sizeof(offset), &offset, nullptr));
+    EXPECT_EQ(0u, offset);
+
+    cl_buffer_region region = {static_cast<size_t>(device->getDeviceInfo().memBaseAddressAlign / 8), 64};
+    std::unique_ptr<Buffer> subBuffer(buffer->createSubBuffer(CL_MEM_READ_WRITE, 0, &region, retVal));
+    ASSERT_NE(nullptr, subBuffer);
+    EXPECT_EQ(buffer->getOffset() + region.origin, subBuffer->getOffset());
+    EXPECT_EQ(ptrOffset(buffer->getCpuAddress(), region.origin), subBuffer->getCpuAddress());
+
+    EXPECT_EQ(CL_SUCCESS, subBuffer->getMemObjectInfo(CL_MEM_OFFSET, sizeof(offset), &offset, nullptr));
+    EXPECT_EQ(region.origin, offset);
+}
+
+TEST_F(BufferPoolAllocatorTest, givenCopyHostPtrFlagWhenCreatingPooledBufferThenDataIsCopied) {
+    uint8_t hostData[128];
+    for (size_t i = 0; i < sizeof(hostData); i++) {
+        hostData[i] = static_cast<uint8_t>(i);
+    }
+
+    std::unique_ptr<Buffer> buffer(createBuffer(CL_MEM_READ_WRITE | CL_MEM_COPY_HOST_PTR, sizeof(hostData), hostData));
+    ASSERT_NE(nullptr, buffer);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_TRUE(buffer->isPooled());
+    EXPECT_EQ(0, memcmp(hostData, buffer->getCpuAddress(), sizeof(hostData)));
+}
+
+TEST_F(BufferPoolAllocatorTest, givenIncompatibleFlagsOrLargeSizeWhenCreatingBufferThenRegularAllocationIsUsed) {
+    uint8_t hostData[128] = {};
+
+    std::unique_ptr<Buffer> useHostPtrBuffer(createBuffer(CL_MEM_READ_WRITE | CL_MEM_USE_HOST_PTR, sizeof(hostData), hostData));
+    ASSERT_NE(nullptr, useHostPtrBuffer);
+    EXPECT_FALSE(useHostPtrBuffer->isPooled());
+
+    std::unique_ptr<Buffer> largeBuffer(createBuffer(CL_MEM_READ_WRITE, BufferPoolAllocator::defaultSmallBufferThreshold + 1));
+    ASSERT_NE(nullptr, largeBuffer);
+    EXPECT_FALSE(largeBuffer->isPooled());
+
+    auto statistics = context->getBufferPoolAllocator()->getStatistics();
+    EXPECT_EQ(1u, statistics.fallbacks);
+    EXPECT_EQ(0u, statistics.poolsCount);
+    EXPECT_EQ(0u, statistics.buffersCount);
+}
+
+TEST_F(BufferPoolAllocatorTest, givenThresholdDebugFlagWhenCreatingBufferThenThresholdIsRespected) {
+    DebugManager.flags.SmallBufferPoolThreshold.set(64);
+    BufferPoolAllocator allocator(*context);
+    EXPECT_TRUE(allocator.isSizeSuitable(64));
+    EXPECT_FALSE(allocator.isSizeSuitable(65));
+}
+
+TEST_F(BufferPoolAllocatorTest, givenReleasedPooledBufferNotUsedByGpuWhenCreatingNextBufferThenChunkIsReused) {
+    auto buffer = createBuffer(CL_MEM_READ_WRITE, 256);
+    ASSERT_NE(nullptr, buffer);
+    auto offset = buffer->getOffset();
+    delete buffer;
+
+    auto statistics = context->getBufferPoolAllocator()->getStatistics();
+    EXPECT_EQ(0u, statistics.buffersCount);
+    EXPECT_EQ(0u, statistics.allocatedSize);
+    EXPECT_EQ(0u, statistics.pendingFreeSize);
+    EXPECT_EQ(1u, statistics.poolsCount);
+
+    std::unique_ptr<Buffer> nextBuffer(createBuffer(CL_MEM_READ_WRITE, 256));
+    ASSERT_NE(nullptr, nextBuffer);
+    EXPECT_EQ(offset, nextBuffer->getOffset());
+}
+
+TEST_F(BufferPoolAllocatorTest, givenReleasedPooledBufferUsedByGpuWhenCreatingNextBufferThenChunkIsReusedOnlyAfterCompletion) {
+    auto &engine = device->getDefaultEngine();
+    auto tagAddress = engine.commandStreamReceiver->getTagAddress();
+    auto osContextId = engine.osContext->getContextId();
+    *tagAddress = 0u;
+
+    auto buffer = createBuffer(CL_MEM_READ_WRITE, 256);
+    ASSERT_NE(nullptr, buffer);
+    auto offset = buffer->getOffset();
+    buffer->getGraphicsAllocation()->updateTaskCount(5u, osContextId);
+    delete buffer;
+
+    auto statistics = context->getBufferPoolAllocator()->getStatistics();
+    EXPECT_EQ(256u, statistics.pendingFreeSize);
+
+    std::unique_ptr<Buffer> busyBuffer(createBuffer(CL_MEM_READ_WRITE, 256));
+    ASSERT_NE(nullptr, busyBuffer);
+    EXPECT_NE(offset, busyBuffer->getOffset());
+
+    *tagAddress = 5u;
+    std::unique_ptr<Buffer> nextBuffer(createBuffer(CL_MEM_READ_WRITE, 256));
+    ASSERT_NE(nullptr, nextBuffer);
+    EXPECT_EQ(offset, nextBuffer->getOffset());
+    EXPECT_EQ(0u, context->getBufferPoolAllocator()->getStatistics().pendingFreeSize);
+}
@@ -2177,6 +2177,55 @@ HWTEST_F(BufferSetSurfaceTests, givenBufferWithOffsetWhenSetArgStatefulIsCalledT
     DebugManager.flags.Force32bitAddressing.set(false);
 }
 
+HWTEST_F(BufferSetSurfaceTests, givenSurfaceStateTemplatesWhenSetArgStatefulIsCalledThenSurfaceStateMatchesProgrammedOneAndTemplateIsReusedPerCachePolicy) {
+    DebugManagerStateRestore restorer;
+    MockContext context;
+    auto retVal = CL_SUCCESS;
+    std::unique_ptr<Buffer> buffer(Buffer::create(&context, CL_MEM_READ_WRITE, MemoryConstants::pageSize, nullptr, retVal));
+    ASSERT_NE(nullptr, buffer);
+    auto bufferHw = static_cast<BufferHw<FamilyType> *>(buffer.get());
+
+    using RENDER_SURFACE_STATE = typename FamilyType::RENDER_SURFACE_STATE;
+    RENDER_SURFACE_STATE expectedSurfaceState = FamilyType::cmdInitRenderSurfaceState;
+    DebugManager.flags.EnableSurfaceStateTemplates.set(0);
+    buffer->setArgStateful(&expectedSurfaceState, false, true, false, false);
+    EXPECT_EQ(0u, bufferHw->surfaceStateTemplates.getTemplatesCount());
+
+    DebugManager.flags.EnableSurfaceStateTemplates.set(1);
+    RENDER_SURFACE_STATE surfaceState = {};
+    buffer->setArgStateful(&surfaceState, false, true, false, false);
+    EXPECT_EQ(0, memcmp(&expectedSurfaceState, &surfaceState, sizeof(RENDER_SURFACE_STATE)));
+    EXPECT_EQ(1u, bufferHw->surfaceStateTemplates.getTemplatesCount());
+
+    buffer->setArgStateful(&surfaceState, false, true, false, false);
+    EXPECT_EQ(1u, bufferHw->surfaceStateTemplates.getTemplatesCount());
+
+    buffer->setArgStateful(&surfaceState, false, false, false, true);
+    EXPECT_EQ(2u, bufferHw->surfaceStateTemplates.getTemplatesCount());
+}
+
+HWTEST_F(BufferSetSurfaceTests, givenSurfaceStateTemplatesWhenAllocationOfBufferChangesThenTemplatesAreReprogrammed) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableSurfaceStateTemplates.set(1);
+    MockContext context;
+    auto retVal = CL_SUCCESS;
+    std::unique_ptr<Buffer> buffer(Buffer::create(&context, CL_MEM_READ_WRITE, MemoryConstants::pageSize, nullptr, retVal));
+    ASSERT_NE(nullptr, buffer);
+    auto bufferHw = static_cast<BufferHw<FamilyType> *>(buffer.get());
+
+    using RENDER_SURFACE_STATE = typename FamilyType::RENDER_SURFACE_STATE;
+    RENDER_SURFACE_STATE surfaceState = {};
+    buffer->setArgStateful(&surfaceState, false, false, false, false);
+    buffer->setArgStateful(&surfaceState, false, true, false, false);
+    EXPECT_EQ(2u, bufferHw->surfaceStateTemplates.getTemplatesCount());
+
+    auto newAllocation = context.getMemoryManager()->allocateGraphicsMemoryWithProperties(MockAllocationProperties{MemoryConstants::pageSize});
+    buffer->resetGraphicsAllocation(newAllocation);
+    buffer->setArgStateful(&surfaceState, false, false, false, false);
+    EXPECT_EQ(1u, bufferHw->surfaceStateTemplates.getTemplatesCount());
+    EXPECT_EQ(newAllocation->getGpuAddress(), surfaceState.getSurfaceBaseAddress());
+}
+
 HWTEST_F(BufferSetSurfaceTests, givenBufferWhenSetArgStatefulWithL3ChacheDisabledIsCalledThenL3CacheShouldBeOffAndSizeIsAlignedTo512) {
     MockContext context;
     auto size = 128;
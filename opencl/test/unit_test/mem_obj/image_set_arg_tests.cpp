@@ -12,6 +12,7 @@
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/graphics_allocation.h"
 #include "shared/source/memory_manager/surface.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
 
 #include "opencl/source/helpers/surface_formats.h"
 #include "opencl/source/kernel/kernel.h"
@@ -1149,3 +1150,50 @@ HWTEST_F(ImageSetArgTest, givenMediaCompressedResourceSurfaceModeIsNone) {
 
     EXPECT_EQ(surfaceState.getAuxiliarySurfaceMode(), AUXILIARY_SURFACE_MODE::AUXILIARY_SURFACE_MODE_AUX_NONE);
 }
+
+HWTEST_F(ImageSetArgTest, givenSurfaceStateTemplatesWhenSetImageArgIsCalledThenSurfaceStateMatchesProgrammedOneAndTemplateIsReusedPerMipLevel) {
+    typedef typename FamilyType::RENDER_SURFACE_STATE RENDER_SURFACE_STATE;
+    DebugManagerStateRestore restorer;
+    auto imageHw = static_cast<ImageHw<FamilyType> *>(srcImage);
+
+    RENDER_SURFACE_STATE expectedSurfaceState = FamilyType::cmdInitRenderSurfaceState;
+    DebugManager.flags.EnableSurfaceStateTemplates.set(0);
+    srcImage->setImageArg(&expectedSurfaceState, false, 0);
+    EXPECT_EQ(0u, imageHw->surfaceStateTemplates.getTemplatesCount());
+
+    DebugManager.flags.EnableSurfaceStateTemplates.set(1);
+    RENDER_SURFACE_STATE surfaceState = {};
+    srcImage->setImageArg(&surfaceState, false, 0);
+    EXPECT_EQ(0, memcmp(&expectedSurfaceState, &surfaceState, sizeof(RENDER_SURFACE_STATE)));
+    srcImage->setImageArg(&surfaceState, false, 0);
+    EXPECT_EQ(1u, imageHw->surfaceStateTemplates.getTemplatesCount());
+
+    srcImage->setImageArg(&surfaceState, false, 1);
+    EXPECT_EQ(2u, imageHw->surfaceStateTemplates.getTemplatesCount());
+    EXPECT_EQ(1u, surfaceState.getSurfaceMinLod());
+    srcImage->setImageArg(&surfaceState, true, 0);
+    EXPECT_EQ(3u, imageHw->surfaceStateTemplates.getTemplatesCount());
+}
+
+HWTEST_F(ImageSetArgTest, givenSurfaceStateTemplatesWhenImageIsModifiedThenTemplatesAreReprogrammed) {
+    typedef typename FamilyType::RENDER_SURFACE_STATE RENDER_SURFACE_STATE;
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableSurfaceStateTemplates.set(1);
+    auto imageHw = static_cast<ImageHw<FamilyType> *>(srcImage);
+
+    RENDER_SURFACE_STATE surfaceState = {};
+    srcImage->setImageArg(&surfaceState, false, 0);
+    srcImage->setImageArg(&surfaceState, false, 1);
+    EXPECT_EQ(2u, imageHw->surfaceStateTemplates.getTemplatesCount());
+
+    srcImage->setMipCount(3);
+    srcImage->setImageArg(&surfaceState, false, 0);
+    EXPECT_EQ(1u, imageHw->surfaceStateTemplates.getTemplatesCount());
+    EXPECT_EQ(2u, surfaceState.getMipCountLod());
+
+    auto graphicsAllocation = srcImage->getGraphicsAllocation();
+    graphicsAllocation->setCpuPtrAndGpuAddress(graphicsAllocation->getUnderlyingBuffer(), 0xAAABBBCCCDDD000ull);
+    srcImage->setImageArg(&surfaceState, false, 1);
+    EXPECT_EQ(1u, imageHw->surfaceStateTemplates.getTemplatesCount());
+    EXPECT_EQ(srcImage->getGraphicsAllocation()->getGpuAddress(), surfaceState.getSurfaceBaseAddress());
+}
@@ -7,6 +7,7 @@
 
 #include "shared/source/helpers/ptr_math.h"
 
+#include "opencl/source/aub_mem_dump/aub_mem_dump.h"
 #include "opencl/source/aub_mem_dump/page_table_entry_bits.h"
 #include "opencl/source/memory_manager/memory_banks.h"
 #include "opencl/source/memory_manager/page_table.h"
@@ -17,6 +18,7 @@
 #include "gtest/gtest.h"
 
 #include <memory>
+#include <vector>
 
 using namespace NEO;
 
@@ -183,6 +185,100 @@ TEST_F(PageTableTests48, pageWalkSimple) {
     EXPECT_EQ(lSize, walked);
 }
 
+TEST_F(PageTableTests48, givenPagesContiguousInPhysicalMemoryWhenRangeWalkIsCalledThenSingleRangeIsReported) {
+    std::unique_ptr<PPGTTPageTable> pageTable(new PPGTTPageTable(&allocator));
+    uintptr_t gpuVa = refAddr + (510 * pageSize) + 0x10;
+    size_t size = 8 * pageSize;
+    auto address = allocator.mainAllocator.load();
+
+    std::vector<std::pair<uint64_t, size_t>> ranges;
+    size_t lastOffset = 0;
+    auto walker = [&](uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {
+        EXPECT_EQ(lastOffset, offset);
+        ranges.push_back({physAddress, size});
+        lastOffset += size;
+    };
+    pageTable->rangeWalk(gpuVa, size, 0, 0, walker, MemoryBanks::MainBank);
+
+    ASSERT_EQ(1u, ranges.size());
+    EXPECT_EQ(address + 0x10, ranges[0].first);
+    EXPECT_EQ(size, ranges[0].second);
+}
+
+TEST_F(PageTableTests48, givenContiguousRunLargerThanPteWriteLimitWhenRangeWalkIsCalledThenRunIsSplitIntoRangesFittingSinglePteWrite) {
+    std::unique_ptr<PPGTTPageTable> pageTable(new PPGTTPageTable(&allocator));
+    uintptr_t gpuVa = refAddr;
+    constexpr size_t maxRangeSize = PhysicalRangeCoalescer<PageWalker>::maxRangeSize;
+    size_t size = 2 * maxRangeSize + pageSize;
+    auto address = allocator.mainAllocator.load();
+
+    std::vector<std::pair<uint64_t, size_t>> ranges;
+    size_t lastOffset = 0;
+    auto walker = [&](uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {
+        EXPECT_EQ(lastOffset, offset);
+        ranges.push_back({physAddress, size});
+        lastOffset += size;
+    };
+    pageTable->rangeWalk(gpuVa, size, 0, 0, walker, MemoryBanks::MainBank);
+
+    EXPECT_EQ(size, lastOffset);
+    ASSERT_EQ(3u, ranges.size());
+    EXPECT_EQ(address, ranges[0].first);
+    EXPECT_EQ(maxRangeSize, ranges[0].second);
+    EXPECT_EQ(address + maxRangeSize, ranges[1].first);
+    EXPECT_EQ(maxRangeSize, ranges[1].second);
+    EXPECT_EQ(address + 2 * maxRangeSize, ranges[2].first);
+    EXPECT_EQ(pageSize, ranges[2].second);
+
+    auto maxPTEWriteSize = (maxRangeSize / pageSize + 1) * sizeof(uint64_t) + sizeof(AubMemDump::CmdServicesMemTraceMemoryWrite);
+    EXPECT_GE(AubMemDump::g_dwordCountMax * sizeof(uint32_t), maxPTEWriteSize);
+}
+
+TEST_F(PageTableTests48, givenPagesNotContiguousInPhysicalMemoryWhenRangeWalkIsCalledThenRangeIsReportedForEveryContiguousRun) {
+    std::unique_ptr<PPGTTPageTable> pageTable(new PPGTTPageTable(&allocator));
+    uintptr_t gpuVa = refAddr;
+
+    pageTable->map(gpuVa + 2 * pageSize, pageSize, 0, MemoryBanks::MainBank);
+    auto address = allocator.mainAllocator.load();
+
+    std::vector<std::pair<size_t, size_t>> ranges;
+    size_t walked = 0u;
+    auto walker = [&](uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {
+        ranges.push_back({offset, size});
+        walked += size;
+    };
+    pageTable->rangeWalk(gpuVa, 4 * pageSize, 0, 0, walker, MemoryBanks::MainBank);
+
+    EXPECT_EQ(4 * pageSize, walked);
+    ASSERT_EQ(3u, ranges.size());
+    EXPECT_EQ(0u, ranges[0].first);
+    EXPECT_EQ(2 * pageSize, ranges[0].second);
+    EXPECT_EQ(2 * pageSize, ranges[1].first);
+    EXPECT_EQ(pageSize, ranges[1].second);
+    EXPECT_EQ(3 * pageSize, ranges[2].first);
+    EXPECT_EQ(pageSize, ranges[2].second);
+    EXPECT_EQ(address + 3 * pageSize, allocator.mainAllocator.load());
+}
+
+TEST_F(PageTableTests48, givenPagesWithDifferentEntryBitsWhenRangeWalkIsCalledThenRangesAreNotMerged) {
+    std::unique_ptr<PPGTTPageTable> pageTable(new PPGTTPageTable(&allocator));
+    uintptr_t gpuVa = refAddr;
+
+    auto emptyWalker = [&](uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {};
+    pageTable->rangeWalk(gpuVa, pageSize, 0, 0x2, emptyWalker, MemoryBanks::MainBank);
+    pageTable->rangeWalk(gpuVa + pageSize, pageSize, 0, 0x4, emptyWalker, MemoryBanks::MainBank);
+
+    std::vector<uint64_t> rangeEntryBits;
+    auto walker = [&](uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {
+        rangeEntryBits.push_back(entryBits);
+    };
+    pageTable->rangeWalk(gpuVa, 2 * pageSize, 0, PageTableEntry::nonValidBits, walker, MemoryBanks::MainBank);
+
+    ASSERT_EQ(2u, rangeEntryBits.size());
+    EXPECT_EQ(0x3u, rangeEntryBits[0]);
+    EXPECT_EQ(0x5u, rangeEntryBits[1]);
+}
+
 TEST_F(PageTableTests48, givenReservedPhysicalAddressWhenPageWalkIsCalledThenPageTablesAreFilledWithProperAddresses) {
     if (is64Bit) {
         std::unique_ptr<MockPML4> pageTable(std::make_unique<MockPML4>(&allocator));
@@ -7,6 +7,7 @@
 
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/memory_manager/allocations_list.h"
+#include "shared/source/memory_manager/host_ptr_manager.h"
 #include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
 #include "shared/test/unit_test/page_fault_manager/mock_cpu_page_fault_manager.h"
 
@@ -585,6 +586,72 @@ TEST_F(ShareableUnifiedMemoryManagerPropertiesTest, givenShareableUnifiedPropert
     svmManager->freeSVMAlloc(ptr);
 }
 
+struct MultiRootDeviceSVMAllocsManagerTest : public ::testing::Test {
+    MultiRootDeviceSVMAllocsManagerTest() : executionEnvironment(*platformDevices, true, 3u) {}
+
+    void SetUp() override {
+        bool svmSupported = executionEnvironment.rootDeviceEnvironments[0]->getHardwareInfo()->capabilityTable.ftrSvm;
+        if (!svmSupported) {
+            GTEST_SKIP();
+        }
+        executionEnvironment.initGmm();
+        memoryManager = std::make_unique<MockMemoryManager>(false, false, executionEnvironment);
+        svmManager = std::make_unique<MockSVMAllocsManager>(memoryManager.get());
+    }
+
+    MockExecutionEnvironment executionEnvironment;
+    std::unique_ptr<MockMemoryManager> memoryManager;
+    std::unique_ptr<MockSVMAllocsManager> svmManager;
+};
+
+TEST_F(MultiRootDeviceSVMAllocsManagerTest, givenHostUsmAllocationWhenObtainingAllocationsForOtherRootDevicesThenCpuBackingStoreIsMappedOncePerRootDeviceAtSameGpuAddress) {
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties;
+    unifiedMemoryProperties.memoryType = InternalMemoryType::HOST_UNIFIED_MEMORY;
+    auto ptr = svmManager->createUnifiedMemoryAllocation(0u, 4096u, unifiedMemoryProperties);
+    ASSERT_NE(nullptr, ptr);
+    auto svmData = svmManager->getSVMAlloc(ptr);
+
+    EXPECT_EQ(svmData->gpuAllocation, svmManager->obtainGraphicsAllocation(*svmData, 0u));
+    EXPECT_EQ(nullptr, svmData->getGraphicsAllocation(1u));
+
+    auto allocation = svmManager->obtainGraphicsAllocation(*svmData, 1u);
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_NE(svmData->gpuAllocation, allocation);
+    EXPECT_EQ(1u, allocation->getRootDeviceIndex());
+    EXPECT_EQ(svmData->gpuAllocation->getGpuAddress(), allocation->getGpuAddress());
+    EXPECT_EQ(svmData->gpuAllocation->getUnderlyingBuffer(), allocation->getUnderlyingBuffer());
+    EXPECT_EQ(GraphicsAllocation::AllocationType::BUFFER_HOST_MEMORY, allocation->getAllocationType());
+
+    EXPECT_EQ(allocation, svmManager->obtainGraphicsAllocation(*svmData, 1u));
+    EXPECT_EQ(allocation, svmData->getGraphicsAllocation(1u));
+    EXPECT_EQ(1u, svmManager->SVMAllocs.getNumAllocs());
+
+    auto allocationOfThirdRootDevice = svmManager->obtainGraphicsAllocation(*svmData, 2u);
+    ASSERT_NE(nullptr, allocationOfThirdRootDevice);
+    EXPECT_NE(allocation, allocationOfThirdRootDevice);
+    EXPECT_EQ(2u, allocationOfThirdRootDevice->getRootDeviceIndex());
+    EXPECT_EQ(svmData->gpuAllocation->getGpuAddress(), allocationOfThirdRootDevice->getGpuAddress());
+    EXPECT_EQ(0u, allocation->fragmentsStorage.fragmentCount);
+    EXPECT_EQ(0u, allocationOfThirdRootDevice->fragmentsStorage.fragmentCount);
+    EXPECT_EQ(nullptr, memoryManager->getHostPtrManager()->getFragment(ptr));
+
+    EXPECT_TRUE(svmManager->freeSVMAlloc(ptr, true));
+    EXPECT_EQ(0u, svmManager->SVMAllocs.getNumAllocs());
+}
+
+TEST_F(MultiRootDeviceSVMAllocsManagerTest, givenDeviceUsmAllocationWhenObtainingAllocationForOtherRootDeviceThenPrimaryAllocationIsReturned) {
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties;
+    unifiedMemoryProperties.memoryType = InternalMemoryType::DEVICE_UNIFIED_MEMORY;
+    auto ptr = svmManager->createUnifiedMemoryAllocation(0u, 4096u, unifiedMemoryProperties);
+    ASSERT_NE(nullptr, ptr);
+    auto svmData = svmManager->getSVMAlloc(ptr);
+
+    EXPECT_EQ(svmData->gpuAllocation, svmManager->obtainGraphicsAllocation(*svmData, 1u));
+    EXPECT_TRUE(svmData->rootDeviceAllocations.empty());
+
+    svmManager->freeSVMAlloc(ptr);
+}
+
 TEST(UnfiedSharedMemoryTransferCalls, givenHostUSMllocationWhenPointerIsUsedForTransferCallsThenUSMAllocationIsReused) {
     MockContext mockContext;
     cl_context clContext = &mockContext;
@@ -15,6 +15,7 @@ class TestedDrmCommandStreamReceiver : public DrmCommandStreamReceiver<GfxFamily
   public:
     using CommandStreamReceiver::commandStream;
     using CommandStreamReceiver::makeResident;
+    using CommandStreamReceiverHw<GfxFamily>::directSubmission;
     using DrmCommandStreamReceiver<GfxFamily>::makeResidentBufferObjects;
     using DrmCommandStreamReceiver<GfxFamily>::residency;
     using CommandStreamReceiverHw<GfxFamily>::CommandStreamReceiver::lastSentSliceCount;
@@ -14,6 +14,7 @@
 namespace NEO {
 class MockContext : public Context {
   public:
+    using Context::bufferPoolAllocator;
     using Context::contextType;
     using Context::driverDiagnostics;
     using Context::memoryManager;
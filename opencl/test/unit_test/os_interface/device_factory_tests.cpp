@@ -238,6 +238,35 @@ TEST_F(DeviceFactoryTest, givenGetDevicesCallWhenItIsDoneThenOsInterfaceIsAlloca
     EXPECT_NE(nullptr, executionEnvironment->rootDeviceEnvironments[0]->osInterface);
 }
 
+TEST(DeviceFactory, givenParallelRootDeviceInitializationDebugFlagWhenGettingInitializationThreadCountThenFlagValueLimitedByRootDeviceCountIsReturned) {
+    DebugManagerStateRestore stateRestore;
+
+    DebugManager.flags.ParallelRootDeviceInitialization.set(0);
+    EXPECT_EQ(1u, DeviceFactory::getRootDeviceInitializationThreadCount(4u));
+
+    DebugManager.flags.ParallelRootDeviceInitialization.set(2);
+    EXPECT_EQ(2u, DeviceFactory::getRootDeviceInitializationThreadCount(4u));
+
+    DebugManager.flags.ParallelRootDeviceInitialization.set(8);
+    EXPECT_EQ(4u, DeviceFactory::getRootDeviceInitializationThreadCount(4u));
+
+    DebugManager.flags.ParallelRootDeviceInitialization.set(-1);
+    EXPECT_EQ(1u, DeviceFactory::getRootDeviceInitializationThreadCount(4u));
+}
+
+TEST_F(DeviceFactoryTest, givenParallelRootDeviceInitializationWhenGetDevicesIsCalledThenOsInterfaceIsAllocatedForEachRootDevice) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.ParallelRootDeviceInitialization.set(4);
+
+    size_t numDevices = 0;
+    bool success = DeviceFactory::getDevices(numDevices, *executionEnvironment);
+    EXPECT_TRUE(success);
+    ASSERT_EQ(numDevices, executionEnvironment->rootDeviceEnvironments.size());
+    for (auto &rootDeviceEnvironment : executionEnvironment->rootDeviceEnvironments) {
+        EXPECT_NE(nullptr, rootDeviceEnvironment->osInterface);
+    }
+}
+
 TEST(DeviceFactory, givenHwModeSelectedWhenIsHwModeSelectedIsCalledThenTrueIsReturned) {
     DebugManagerStateRestore stateRestore;
     constexpr int32_t hwModes[] = {-1, CommandStreamReceiverType::CSR_HW, CommandStreamReceiverType::CSR_HW_WITH_AUB};
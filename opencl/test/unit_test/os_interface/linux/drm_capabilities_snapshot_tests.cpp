@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/file_io.h"
+#include "shared/source/os_interface/linux/drm_capabilities_snapshot.h"
+
+#include "opencl/test/unit_test/os_interface/linux/drm_mock.h"
+
+#include "gtest/gtest.h"
+
+#include <cstdio>
+#include <memory>
+
+using namespace NEO;
+
+using Capability = DrmCapabilitiesSnapshot::Capability;
+
+struct DrmCapabilitiesSnapshotTest : public ::testing::Test {
+    void TearDown() override {
+        for (auto &fileName : fileNames) {
+            std::remove(fileName.c_str());
+        }
+    }
+
+    std::unique_ptr<DrmCapabilitiesSnapshot> createSnapshot(const std::string &key) {
+        auto snapshot = std::make_unique<DrmCapabilitiesSnapshot>(".", key);
+        fileNames.push_back(snapshot->getFileName());
+        return snapshot;
+    }
+
+    std::vector<std::string> fileNames;
+};
+
+TEST_F(DrmCapabilitiesSnapshotTest, givenSavedSnapshotWhenLoadingWithSameKeyThenStoredCapabilitiesAreReturned) {
+    auto snapshot = createSnapshot("1234;1;0000:00:02.0;1.6.0;20200114");
+    EXPECT_FALSE(snapshot->load());
+    EXPECT_FALSE(snapshot->isDirty());
+
+    snapshot->set(Capability::EuTotal, 24);
+    snapshot->set(Capability::GttSize, 1ll << 47);
+    snapshot->setSysFsPciPath("/sys/bus/pci/devices/0000:00:02.0");
+    EXPECT_TRUE(snapshot->isDirty());
+    EXPECT_TRUE(snapshot->save());
+    EXPECT_FALSE(snapshot->isDirty());
+
+    auto loadedSnapshot = createSnapshot(snapshot->getKey());
+    ASSERT_TRUE(loadedSnapshot->load());
+
+    int64_t value = 0;
+    EXPECT_TRUE(loadedSnapshot->get(Capability::EuTotal, value));
+    EXPECT_EQ(24, value);
+    EXPECT_TRUE(loadedSnapshot->get(Capability::GttSize, value));
+    EXPECT_EQ(1ll << 47, value);
+    EXPECT_FALSE(loadedSnapshot->get(Capability::SubsliceTotal, value));
+    EXPECT_FALSE(loadedSnapshot->get(Capability::Count, value));
+
+    std::string path;
+    EXPECT_TRUE(loadedSnapshot->getSysFsPciPath(path));
+    EXPECT_EQ("/sys/bus/pci/devices/0000:00:02.0", path);
+
+    loadedSnapshot->set(Capability::EuTotal, 24);
+    EXPECT_FALSE(loadedSnapshot->isDirty());
+}
+
+TEST_F(DrmCapabilitiesSnapshotTest, givenSnapshotOfDifferentKeyOrTruncatedSnapshotWhenLoadingThenItIsRejected) {
+    auto snapshot = createSnapshot("1234;1;0000:00:02.0;1.6.0;20200114");
+    snapshot->set(Capability::EuTotal, 24);
+    ASSERT_TRUE(snapshot->save());
+
+    size_t size = 0;
+    auto data = loadDataFromFile(snapshot->getFileName().c_str(), size);
+    ASSERT_NE(0u, size);
+
+    auto otherDriverSnapshot = createSnapshot("1234;1;0000:00:02.0;1.6.0;20200515");
+    writeDataToFile(otherDriverSnapshot->getFileName().c_str(), data.get(), size);
+    EXPECT_FALSE(otherDriverSnapshot->load());
+
+    writeDataToFile(snapshot->getFileName().c_str(), data.get(), size - 1);
+    auto truncatedSnapshot = createSnapshot(snapshot->getKey());
+    EXPECT_FALSE(truncatedSnapshot->load());
+}
+
+TEST_F(DrmCapabilitiesSnapshotTest, givenDrmWithSnapshotWhenParamIsQueriedThenSuccessfulResultIsStoredAndReusedWithoutIoctl) {
+    auto drm = std::make_unique<DrmMock>();
+    drm->capabilitiesSnapshot = createSnapshot("1234;1;0000:00:02.0;1.6.0;20200114");
+    drm->StoredEUVal = 24;
+    drm->StoredRetValForMinEUinPool = -1;
+
+    int value = 0;
+    EXPECT_EQ(0, drm->getEuTotal(value));
+    EXPECT_EQ(24, value);
+    EXPECT_NE(0, drm->getMinEuInPool(value));
+    EXPECT_TRUE(drm->saveCapabilitiesSnapshot());
+
+    auto nextProcessDrm = std::make_unique<DrmMock>();
+    nextProcessDrm->capabilitiesSnapshot = createSnapshot(drm->capabilitiesSnapshot->getKey());
+    ASSERT_TRUE(nextProcessDrm->capabilitiesSnapshot->load());
+    nextProcessDrm->StoredEUVal = 0;
+
+    value = 0;
+    EXPECT_EQ(0, nextProcessDrm->getEuTotal(value));
+    EXPECT_EQ(24, value);
+    EXPECT_EQ(0u, nextProcessDrm->ioctlCallsCount);
+
+    EXPECT_NE(0, nextProcessDrm->getMinEuInPool(value));
+    EXPECT_EQ(1u, nextProcessDrm->ioctlCallsCount);
+    EXPECT_FALSE(nextProcessDrm->saveCapabilitiesSnapshot());
+}
+
+TEST_F(DrmCapabilitiesSnapshotTest, givenDrmWithoutSnapshotWhenSavingThenNothingIsSaved) {
+    auto drm = std::make_unique<DrmMock>();
+    EXPECT_EQ(nullptr, drm->getCapabilitiesSnapshot());
+    EXPECT_FALSE(drm->saveCapabilitiesSnapshot());
+}
@@ -6,6 +6,7 @@
  */
 
 #include "shared/source/command_stream/preemption.h"
+#include "shared/source/direct_submission/linux/drm_direct_submission.h"
 #include "shared/source/gmm_helper/gmm_helper.h"
 #include "shared/source/gmm_helper/page_table_mngr.h"
 #include "shared/source/gmm_helper/resource_info.h"
@@ -14,6 +15,7 @@
 #include "shared/source/memory_manager/internal_allocation_storage.h"
 #include "shared/source/memory_manager/residency.h"
 #include "shared/source/os_interface/linux/drm_buffer_object.h"
+#include "shared/source/os_interface/linux/drm_memory_operations_handler.h"
 #include "shared/source/os_interface/linux/os_context_linux.h"
 #include "shared/source/os_interface/linux/os_interface.h"
 #include "shared/source/os_interface/os_context.h"
@@ -38,6 +40,11 @@
 #include "drm/i915_drm.h"
 #include "gmock/gmock.h"
 
+#include <atomic>
+#include <chrono>
+#include <errno.h>
+#include <thread>
+
 using namespace NEO;
 
 ACTION_P(copyIoctlParam, dstValue) {
@@ -558,6 +565,61 @@ HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenTaskThatRequiresLargeResou
     EXPECT_EQ(11u, execStorage.size());
 }
 
+HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenAllocationsMadeResidentWithMemoryOperationsHandlerWhenFlushingThenTheyAreAddedToExecOnce) {
+    executionEnvironment->rootDeviceEnvironments[0]->memoryOperationsInterface = std::make_unique<DrmMemoryOperationsHandler>();
+    auto memoryOperationsInterface = executionEnvironment->rootDeviceEnvironments[0]->memoryOperationsInterface.get();
+
+    auto residentAllocation = mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{MemoryConstants::pageSize});
+    auto kernelAllocation = mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{MemoryConstants::pageSize});
+    GraphicsAllocation *allocations[] = {residentAllocation, kernelAllocation};
+    EXPECT_EQ(MemoryOperationsStatus::SUCCESS, memoryOperationsInterface->makeResident(ArrayRef<GraphicsAllocation *>(allocations, 2)));
+
+    auto commandBuffer = mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{MemoryConstants::pageSize});
+    LinearStream cs(commandBuffer);
+    CommandStreamReceiverHw<FamilyType>::addBatchBufferEnd(cs, nullptr);
+    CommandStreamReceiverHw<FamilyType>::alignToCacheLine(cs);
+    BatchBuffer batchBuffer{cs.getGraphicsAllocation(), 0, 0, nullptr, false, false, QueueThrottle::MEDIUM, QueueSliceCount::defaultSliceCount, cs.getUsed(), &cs, nullptr};
+
+    csr->makeResident(*kernelAllocation);
+    csr->flush(batchBuffer, csr->getResidencyAllocations());
+    csr->makeSurfacePackNonResident(csr->getResidencyAllocations());
+
+    auto getExecHandles = [&]() {
+        std::vector<uint32_t> handles;
+        auto execObjects = reinterpret_cast<drm_i915_gem_exec_object2 *>(this->mock->execBuffer.buffers_ptr);
+        for (auto i = 0u; i < this->mock->execBuffer.buffer_count; i++) {
+            handles.push_back(execObjects[i].handle);
+        }
+        return handles;
+    };
+    auto residentHandle = static_cast<uint32_t>(static_cast<DrmAllocation *>(residentAllocation)->getBO()->peekHandle());
+    auto kernelHandle = static_cast<uint32_t>(static_cast<DrmAllocation *>(kernelAllocation)->getBO()->peekHandle());
+
+    auto handles = getExecHandles();
+    EXPECT_EQ(3u, handles.size());
+    EXPECT_EQ(1, std::count(handles.begin(), handles.end(), residentHandle));
+    EXPECT_EQ(1, std::count(handles.begin(), handles.end(), kernelHandle));
+
+    csr->flush(batchBuffer, csr->getResidencyAllocations());
+    handles = getExecHandles();
+    EXPECT_EQ(3u, handles.size());
+    EXPECT_EQ(1, std::count(handles.begin(), handles.end(), residentHandle));
+    EXPECT_EQ(1, std::count(handles.begin(), handles.end(), kernelHandle));
+
+    EXPECT_EQ(MemoryOperationsStatus::SUCCESS, memoryOperationsInterface->evict(*residentAllocation));
+    csr->flush(batchBuffer, csr->getResidencyAllocations());
+    handles = getExecHandles();
+    EXPECT_EQ(2u, handles.size());
+    EXPECT_EQ(0, std::count(handles.begin(), handles.end(), residentHandle));
+
+    mm->freeGraphicsMemory(kernelAllocation);
+    csr->flush(batchBuffer, csr->getResidencyAllocations());
+    EXPECT_EQ(1u, this->mock->execBuffer.buffer_count);
+
+    mm->freeGraphicsMemory(residentAllocation);
+    mm->freeGraphicsMemory(commandBuffer);
+}
+
 HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenGemCloseWorkerInactiveModeWhenMakeResidentIsCalledThenRefCountsAreNotUpdated) {
     auto dummyAllocation = static_cast<DrmAllocation *>(mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{MemoryConstants::pageSize}));
 
@@ -634,6 +696,200 @@ HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenDrmCsrCreatedWithInactiveG
     EXPECT_EQ(gemCloseWorkerMode::gemCloseWorkerInactive, testedCsr.peekGemCloseWorkerOperationMode());
 }
 
+template <typename GfxFamily>
+struct MockDrmDirectSubmissionForCsr : public DrmDirectSubmission<GfxFamily> {
+    using DrmDirectSubmission<GfxFamily>::ringCommandStream;
+    using DrmDirectSubmission<GfxFamily>::ringStart;
+    using DrmDirectSubmission<GfxFamily>::semaphoreData;
+    using DrmDirectSubmission<GfxFamily>::tagAddress;
+};
+
+HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenDirectSubmissionDisabledWhenInitializingDirectSubmissionThenFeatureIsNotAvailable) {
+    auto testedCsr = static_cast<TestedDrmCommandStreamReceiver<FamilyType> *>(csr);
+
+    EXPECT_TRUE(testedCsr->initDirectSubmission(*device, testedCsr->getOsContext()));
+    EXPECT_FALSE(testedCsr->isDirectSubmissionEnabled());
+    EXPECT_EQ(0, mock->ioctl_cnt.execbuffer2);
+}
+
+HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenDirectSubmissionEnabledOnEngineWhenInitializingDirectSubmissionThenRingIsStartedWithSingleExec) {
+    DebugManager.flags.EnableDirectSubmission.set(1);
+    auto testedCsr = static_cast<TestedDrmCommandStreamReceiver<FamilyType> *>(csr);
+    auto &osContext = testedCsr->getOsContext();
+    osContext.setDefaultContext(true);
+
+    auto hwInfo = device->getRootDeviceEnvironment().getMutableHardwareInfo();
+    hwInfo->capabilityTable.directSubmissionEngines.data[osContext.getEngineType()].engineSupported = true;
+    hwInfo->capabilityTable.directSubmissionEngines.data[osContext.getEngineType()].submitOnInit = true;
+    mock->ioctl_cnt.reset();
+
+    EXPECT_TRUE(testedCsr->initDirectSubmission(*device, osContext));
+    EXPECT_TRUE(testedCsr->isDirectSubmissionEnabled());
+    EXPECT_TRUE(static_cast<MockDrmDirectSubmissionForCsr<FamilyType> *>(testedCsr->directSubmission.get())->ringStart);
+    EXPECT_EQ(1, mock->ioctl_cnt.execbuffer2);
+}
+
+HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenDirectSubmissionStartedWhenFlushingThenCommandBufferIsNotExecutedAndFlushStampIsRingTagValue) {
+    DebugManager.flags.EnableDirectSubmission.set(1);
+    auto testedCsr = static_cast<TestedDrmCommandStreamReceiver<FamilyType> *>(csr);
+    auto &osContext = testedCsr->getOsContext();
+    osContext.setDefaultContext(true);
+
+    auto hwInfo = device->getRootDeviceEnvironment().getMutableHardwareInfo();
+    hwInfo->capabilityTable.directSubmissionEngines.data[osContext.getEngineType()].engineSupported = true;
+    hwInfo->capabilityTable.directSubmissionEngines.data[osContext.getEngineType()].submitOnInit = true;
+    ASSERT_TRUE(testedCsr->initDirectSubmission(*device, osContext));
+    ASSERT_TRUE(testedCsr->isDirectSubmissionEnabled());
+
+    auto &cs = csr->getCS();
+    auto endCmdPtr = cs.getSpace(0);
+    CommandStreamReceiverHw<FamilyType>::addBatchBufferEnd(cs, nullptr);
+    CommandStreamReceiverHw<FamilyType>::alignToCacheLine(cs);
+    BatchBuffer batchBuffer{cs.getGraphicsAllocation(), 0, 0, nullptr, false, false, QueueThrottle::MEDIUM, QueueSliceCount::defaultSliceCount, cs.getUsed(), &cs, endCmdPtr};
+
+    mock->ioctl_cnt.reset();
+    EXPECT_TRUE(csr->flush(batchBuffer, csr->getResidencyAllocations()));
+    // command buffer object is bound once with exec of residency batch, ring itself is not submitted again
+    EXPECT_EQ(1, mock->ioctl_cnt.execbuffer2);
+    EXPECT_EQ(1u, csr->obtainCurrentFlushStamp());
+
+    mock->ioctl_cnt.reset();
+    EXPECT_TRUE(csr->flush(batchBuffer, csr->getResidencyAllocations()));
+    EXPECT_EQ(0, mock->ioctl_cnt.execbuffer2);
+    EXPECT_EQ(2u, csr->obtainCurrentFlushStamp());
+}
+
+HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenDirectSubmissionStartedWhenWaitingForFlushStampThenWaitReturnsOnlyAfterRingTagIsWritten) {
+    DebugManager.flags.EnableDirectSubmission.set(1);
+    auto testedCsr = static_cast<TestedDrmCommandStreamReceiver<FamilyType> *>(csr);
+    auto &osContext = testedCsr->getOsContext();
+    osContext.setDefaultContext(true);
+
+    auto hwInfo = device->getRootDeviceEnvironment().getMutableHardwareInfo();
+    hwInfo->capabilityTable.directSubmissionEngines.data[osContext.getEngineType()].engineSupported = true;
+    hwInfo->capabilityTable.directSubmissionEngines.data[osContext.getEngineType()].submitOnInit = true;
+    ASSERT_TRUE(testedCsr->initDirectSubmission(*device, osContext));
+    ASSERT_TRUE(testedCsr->isDirectSubmissionEnabled());
+
+    auto directSubmission = static_cast<MockDrmDirectSubmissionForCsr<FamilyType> *>(testedCsr->directSubmission.get());
+    std::atomic<bool> waitReturned{false};
+    std::atomic<bool> waitResult{false};
+    FlushStamp flushStamp = 2u;
+    *directSubmission->tagAddress = 1u;
+    // running ring batch never becomes idle, GEM_WAIT times out
+    mock->ioctl_res = -1;
+    mock->errnoValue = ETIME;
+
+    std::thread waitingThread([&] {
+        waitResult = csr->waitForFlushStamp(flushStamp);
+        waitReturned = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_FALSE(waitReturned);
+
+    *directSubmission->tagAddress = 2u;
+    waitingThread.join();
+    EXPECT_TRUE(waitReturned);
+    EXPECT_TRUE(waitResult);
+    mock->ioctl_res = 0;
+    mock->errnoValue = 0;
+}
+
+HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenDirectSubmissionRingEndedWithoutWritingTagWhenWaitingForFlushStampThenWaitFailsInsteadOfSpinning) {
+    DebugManager.flags.EnableDirectSubmission.set(1);
+    auto testedCsr = static_cast<TestedDrmCommandStreamReceiver<FamilyType> *>(csr);
+    auto &osContext = testedCsr->getOsContext();
+    osContext.setDefaultContext(true);
+
+    auto hwInfo = device->getRootDeviceEnvironment().getMutableHardwareInfo();
+    hwInfo->capabilityTable.directSubmissionEngines.data[osContext.getEngineType()].engineSupported = true;
+    hwInfo->capabilityTable.directSubmissionEngines.data[osContext.getEngineType()].submitOnInit = true;
+    ASSERT_TRUE(testedCsr->initDirectSubmission(*device, osContext));
+    ASSERT_TRUE(testedCsr->isDirectSubmissionEnabled());
+
+    auto directSubmission = static_cast<MockDrmDirectSubmissionForCsr<FamilyType> *>(testedCsr->directSubmission.get());
+    FlushStamp flushStamp = 2u;
+    *directSubmission->tagAddress = 1u;
+    mock->ioctl_cnt.reset();
+
+    // idle ring batch means the ring was ended, e.g. by reset after GPU hang
+    EXPECT_FALSE(csr->waitForFlushStamp(flushStamp));
+    EXPECT_EQ(1, mock->ioctl_cnt.gemWait);
+}
+
+HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenBufferObjectBoundByDirectSubmissionRingWhenItIsClosedThenRingIsStoppedBeforeCloseAndRestartedOnNextFlush) {
+    DebugManager.flags.EnableDirectSubmission.set(1);
+    auto testedCsr = static_cast<TestedDrmCommandStreamReceiver<FamilyType> *>(csr);
+    auto &osContext = testedCsr->getOsContext();
+    osContext.setDefaultContext(true);
+
+    auto hwInfo = device->getRootDeviceEnvironment().getMutableHardwareInfo();
+    hwInfo->capabilityTable.directSubmissionEngines.data[osContext.getEngineType()].engineSupported = true;
+    hwInfo->capabilityTable.directSubmissionEngines.data[osContext.getEngineType()].submitOnInit = true;
+    ASSERT_TRUE(testedCsr->initDirectSubmission(*device, osContext));
+    ASSERT_TRUE(testedCsr->isDirectSubmissionEnabled());
+
+    auto directSubmission = static_cast<MockDrmDirectSubmissionForCsr<FamilyType> *>(testedCsr->directSubmission.get());
+    auto unboundBo = createBO(MemoryConstants::pageSize);
+    auto boundBo = createBO(MemoryConstants::pageSize);
+    boundBo->setDirectSubmissionSession(directSubmission->peekRingSession());
+    mock->ioctl_cnt.reset();
+
+    mm->unreference(unboundBo, false);
+    EXPECT_TRUE(directSubmission->ringStart);
+    EXPECT_EQ(0, mock->ioctl_cnt.gemWait);
+    EXPECT_EQ(1, mock->ioctl_cnt.gemClose);
+
+    mm->unreference(boundBo, false);
+    EXPECT_FALSE(directSubmission->ringStart);
+    EXPECT_EQ(0u, directSubmission->peekRingSession());
+    EXPECT_EQ(1, mock->ioctl_cnt.gemWait);
+    EXPECT_EQ(2, mock->ioctl_cnt.gemClose);
+
+    auto &cs = csr->getCS();
+    auto endCmdPtr = cs.getSpace(0);
+    CommandStreamReceiverHw<FamilyType>::addBatchBufferEnd(cs, nullptr);
+    CommandStreamReceiverHw<FamilyType>::alignToCacheLine(cs);
+    BatchBuffer batchBuffer{cs.getGraphicsAllocation(), 0, 0, nullptr, false, false, QueueThrottle::MEDIUM, QueueSliceCount::defaultSliceCount, cs.getUsed(), &cs, endCmdPtr};
+
+    mock->ioctl_cnt.reset();
+    EXPECT_TRUE(csr->flush(batchBuffer, csr->getResidencyAllocations()));
+    EXPECT_TRUE(directSubmission->ringStart);
+    EXPECT_NE(0u, directSubmission->peekRingSession());
+    EXPECT_EQ(1, mock->ioctl_cnt.execbuffer2);
+}
+
+HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenDirectSubmissionStartedWhenBindingResidencyFailsThenFlushFailsAndNothingIsDispatchedToRing) {
+    DebugManager.flags.EnableDirectSubmission.set(1);
+    auto testedCsr = static_cast<TestedDrmCommandStreamReceiver<FamilyType> *>(csr);
+    auto &osContext = testedCsr->getOsContext();
+    osContext.setDefaultContext(true);
+
+    auto hwInfo = device->getRootDeviceEnvironment().getMutableHardwareInfo();
+    hwInfo->capabilityTable.directSubmissionEngines.data[osContext.getEngineType()].engineSupported = true;
+    hwInfo->capabilityTable.directSubmissionEngines.data[osContext.getEngineType()].submitOnInit = true;
+    ASSERT_TRUE(testedCsr->initDirectSubmission(*device, osContext));
+    ASSERT_TRUE(testedCsr->isDirectSubmissionEnabled());
+
+    auto directSubmission = static_cast<MockDrmDirectSubmissionForCsr<FamilyType> *>(testedCsr->directSubmission.get());
+    auto ringUsed = directSubmission->ringCommandStream.getUsed();
+    auto queueWorkCount = directSubmission->semaphoreData->QueueWorkCount;
+
+    auto &cs = csr->getCS();
+    auto endCmdPtr = cs.getSpace(0);
+    CommandStreamReceiverHw<FamilyType>::addBatchBufferEnd(cs, nullptr);
+    CommandStreamReceiverHw<FamilyType>::alignToCacheLine(cs);
+    BatchBuffer batchBuffer{cs.getGraphicsAllocation(), 0, 0, nullptr, false, false, QueueThrottle::MEDIUM, QueueSliceCount::defaultSliceCount, cs.getUsed(), &cs, endCmdPtr};
+
+    mock->ioctl_res = -1;
+    mock->errnoValue = EINVAL;
+    EXPECT_FALSE(csr->flush(batchBuffer, csr->getResidencyAllocations()));
+    EXPECT_EQ(ringUsed, directSubmission->ringCommandStream.getUsed());
+    EXPECT_EQ(queueWorkCount, directSubmission->semaphoreData->QueueWorkCount);
+    mock->ioctl_res = 0;
+    mock->errnoValue = 0;
+}
+
 class DrmCommandStreamBatchingTests : public DrmCommandStreamEnhancedTest {
   public:
     DrmAllocation *tagAllocation;
@@ -361,6 +361,27 @@ TEST_F(DrmMemoryManagerTest, AllocateThenFree) {
     memoryManager->freeGraphicsMemory(alloc);
 }
 
+TEST_F(DrmMemoryManagerTest, givenHostPtrWhenCreatingGraphicsAllocationFromHostPtrMappingThenUserptrBoIsCreatedAtCpuAddressWithoutHostPtrManagerFragments) {
+    if (memoryManager->isLimitedRange(0u)) {
+        GTEST_SKIP();
+    }
+    mock->ioctl_expected.gemUserptr = 1;
+    mock->ioctl_expected.gemWait = 1;
+    mock->ioctl_expected.gemClose = 1;
+
+    auto hostPtr = reinterpret_cast<void *>(0x10000);
+    AllocationProperties properties{0u, false, MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER_HOST_MEMORY, false};
+    auto allocation = static_cast<DrmAllocation *>(memoryManager->createGraphicsAllocationFromHostPtrMapping(properties, hostPtr));
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_EQ(hostPtr, allocation->getUnderlyingBuffer());
+    EXPECT_EQ(castToUint64(hostPtr), allocation->getGpuAddress());
+    EXPECT_EQ(castToUint64(hostPtr), allocation->getBO()->peekAddress());
+    EXPECT_EQ(0u, allocation->fragmentsStorage.fragmentCount);
+    EXPECT_EQ(nullptr, memoryManager->getHostPtrManager()->getFragment(hostPtr));
+
+    memoryManager->freeGraphicsMemory(allocation);
+}
+
 TEST_F(DrmMemoryManagerTest, AllocateNewFail) {
     mock->ioctl_expected.total = -1; //don't care
 
@@ -24,6 +24,7 @@ using namespace NEO;
 // Mock DRM class that responds to DRM_IOCTL_I915_GETPARAMs
 class DrmMock : public Drm {
   public:
+    using Drm::capabilitiesSnapshot;
     using Drm::checkQueueSliceSupport;
     using Drm::engineInfo;
     using Drm::getQueueSliceCount;
@@ -10,7 +10,9 @@
 #include "opencl/test/unit_test/mocks/mock_graphics_allocation.h"
 #include "test.h"
 
+#include <atomic>
 #include <memory>
+#include <thread>
 
 using namespace NEO;
 
@@ -26,13 +28,64 @@ struct DrmMemoryOperationsHandlerTest : public ::testing::Test {
     std::unique_ptr<DrmMemoryOperationsHandler> drmMemoryOperationsHandler;
 };
 
-TEST_F(DrmMemoryOperationsHandlerTest, whenMakingResidentAllocaionExpectMakeResidentFail) {
-    EXPECT_EQ(drmMemoryOperationsHandler->makeResident(ArrayRef<GraphicsAllocation *>(&allocationPtr, 1)), MemoryOperationsStatus::UNSUPPORTED);
-    EXPECT_EQ(drmMemoryOperationsHandler->isResident(graphicsAllocation), MemoryOperationsStatus::UNSUPPORTED);
+TEST_F(DrmMemoryOperationsHandlerTest, whenMakingResidentAllocaionExpectMakeResidentSucceed) {
+    EXPECT_EQ(drmMemoryOperationsHandler->makeResident(ArrayRef<GraphicsAllocation *>(&allocationPtr, 1)), MemoryOperationsStatus::SUCCESS);
+    EXPECT_EQ(drmMemoryOperationsHandler->isResident(graphicsAllocation), MemoryOperationsStatus::SUCCESS);
 }
 
-TEST_F(DrmMemoryOperationsHandlerTest, whenEvictingResidentAllocationExpectEvictFalse) {
-    EXPECT_EQ(drmMemoryOperationsHandler->makeResident(ArrayRef<GraphicsAllocation *>(&allocationPtr, 1)), MemoryOperationsStatus::UNSUPPORTED);
-    EXPECT_EQ(drmMemoryOperationsHandler->evict(graphicsAllocation), MemoryOperationsStatus::UNSUPPORTED);
-    EXPECT_EQ(drmMemoryOperationsHandler->isResident(graphicsAllocation), MemoryOperationsStatus::UNSUPPORTED);
+TEST_F(DrmMemoryOperationsHandlerTest, whenEvictingResidentAllocationExpectEvictSucceed) {
+    EXPECT_EQ(drmMemoryOperationsHandler->makeResident(ArrayRef<GraphicsAllocation *>(&allocationPtr, 1)), MemoryOperationsStatus::SUCCESS);
+    EXPECT_EQ(drmMemoryOperationsHandler->evict(graphicsAllocation), MemoryOperationsStatus::SUCCESS);
+    EXPECT_EQ(drmMemoryOperationsHandler->isResident(graphicsAllocation), MemoryOperationsStatus::MEMORY_NOT_FOUND);
+}
+
+TEST_F(DrmMemoryOperationsHandlerTest, whenEvictingNonResidentAllocationExpectMemoryNotFound) {
+    EXPECT_EQ(drmMemoryOperationsHandler->evict(graphicsAllocation), MemoryOperationsStatus::MEMORY_NOT_FOUND);
+    EXPECT_EQ(drmMemoryOperationsHandler->isResident(graphicsAllocation), MemoryOperationsStatus::MEMORY_NOT_FOUND);
+}
+
+TEST_F(DrmMemoryOperationsHandlerTest, givenResidentAllocationsWhenMergingWithResidencyContainerThenOnlyMissingAllocationsAreAppended) {
+    MockGraphicsAllocation graphicsAllocation2;
+    GraphicsAllocation *allocations[] = {&graphicsAllocation, &graphicsAllocation2};
+    EXPECT_EQ(drmMemoryOperationsHandler->makeResident(ArrayRef<GraphicsAllocation *>(allocations, 2)), MemoryOperationsStatus::SUCCESS);
+
+    ResidencyContainer allocationsForResidency = {&graphicsAllocation};
+    ResidencyContainer residentAllocations;
+    drmMemoryOperationsHandler->mergeWithResidencyContainer(allocationsForResidency, residentAllocations);
+    ASSERT_EQ(1u, residentAllocations.size());
+    EXPECT_EQ(&graphicsAllocation2, residentAllocations[0]);
+
+    residentAllocations.clear();
+    drmMemoryOperationsHandler->mergeWithResidencyContainer({}, residentAllocations);
+    EXPECT_EQ(2u, residentAllocations.size());
+}
+
+TEST_F(DrmMemoryOperationsHandlerTest, givenNoResidentAllocationsWhenMergingWithResidencyContainerThenNothingIsAppendedAndLockIsNotTaken) {
+    ResidencyContainer allocationsForResidency = {&graphicsAllocation};
+    ResidencyContainer residentAllocations;
+    auto lock = drmMemoryOperationsHandler->mergeWithResidencyContainer(allocationsForResidency, residentAllocations);
+    EXPECT_EQ(0u, residentAllocations.size());
+    EXPECT_FALSE(lock.owns_lock());
+}
+
+TEST_F(DrmMemoryOperationsHandlerTest, givenMergeLockHeldWhenEvictingFromOtherThreadThenEvictWaitsUntilLockIsReleased) {
+    EXPECT_EQ(drmMemoryOperationsHandler->makeResident(ArrayRef<GraphicsAllocation *>(&allocationPtr, 1)), MemoryOperationsStatus::SUCCESS);
+
+    ResidencyContainer residentAllocations;
+    auto lock = drmMemoryOperationsHandler->mergeWithResidencyContainer({}, residentAllocations);
+    EXPECT_TRUE(lock.owns_lock());
+    ASSERT_EQ(1u, residentAllocations.size());
+
+    std::atomic<bool> evicted{false};
+    std::thread evictThread([&] {
+        drmMemoryOperationsHandler->evict(graphicsAllocation);
+        evicted = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_FALSE(evicted);
+
+    lock.unlock();
+    evictThread.join();
+    EXPECT_TRUE(evicted);
+    EXPECT_EQ(drmMemoryOperationsHandler->isResident(graphicsAllocation), MemoryOperationsStatus::MEMORY_NOT_FOUND);
 }
@@ -8,6 +8,7 @@
 #include "shared/source/os_interface/linux/drm_neo.h"
 #include "shared/source/os_interface/linux/os_interface.h"
 #include "shared/source/os_interface/linux/os_time_linux.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
 
 #include "opencl/test/unit_test/os_interface/linux/device_command_stream_fixture.h"
 #include "opencl/test/unit_test/os_interface/linux/mock_os_time_linux.h"
@@ -37,7 +38,35 @@ int resolutionFuncTrue(clockid_t clkId, struct timespec *res) throw() {
     return 0;
 }
 
+static uint64_t mockCpuTime = 0;
+
+int getTimeFuncMockClock(clockid_t clkId, struct timespec *tp) throw() {
+    tp->tv_sec = mockCpuTime / NSEC_PER_SEC;
+    tp->tv_nsec = mockCpuTime % NSEC_PER_SEC;
+    return 0;
+}
+
 using namespace NEO;
+
+class DrmMockGpuClock : public DrmMockCustom {
+  public:
+    int ioctl(unsigned long request, void *arg) override {
+        if (request == DRM_IOCTL_I915_REG_READ) {
+            ioctl_cnt.regRead++;
+            reinterpret_cast<drm_i915_reg_read *>(arg)->val = getGpuTimeStamp();
+            return 0;
+        }
+        return DrmMockCustom::ioctl(request, arg);
+    }
+
+    uint64_t getGpuTimeStamp() const {
+        return gpuTimeStampOffset + static_cast<uint64_t>(static_cast<double>(mockCpuTime) * gpuTicksPerNs);
+    }
+
+    double gpuTicksPerNs = 0.0;
+    uint64_t gpuTimeStampOffset = 0x1000;
+};
+
 struct DrmTimeTest : public ::testing::Test {
   public:
     void SetUp() override {
@@ -244,3 +273,99 @@ TEST_F(DrmTimeTest, givenAlwaysPassingResolutionFuncWhenGetCpuRawTimestampIsCall
     auto retVal = osTime->getCpuRawTimestamp();
     EXPECT_EQ(1ull, retVal);
 }
+
+struct DrmTimeModelTest : public DrmTimeTest {
+    void SetUp() override {
+        DrmTimeTest::SetUp();
+        DebugManager.flags.CpuGpuTimeModelRecalibrationPeriodMs.set(10);
+        osTime->setGetTimeFunc(getTimeFuncMockClock);
+        mockCpuTime = NSEC_PER_SEC;
+
+        drm = new DrmMockGpuClock();
+        drm->getParamRetValue = nominalFrequency;
+        osTime->updateDrm(drm);
+        drm->ioctl_cnt.reset();
+    }
+
+    DebugManagerStateRestore restorer;
+    DrmMockGpuClock *drm = nullptr;
+    const int nominalFrequency = 12500000;
+    const double nominalGpuTicksPerNs = 0.0125;
+    const uint64_t millisecond = 1000000u;
+};
+
+TEST_F(DrmTimeModelTest, givenGpuClockDriftingAgainstCpuClockWhenGettingCpuGpuTimeThenTimestampsAreServedFromModelWithBoundedError) {
+    const double drift = 100e-6;
+    drm->gpuTicksPerNs = nominalGpuTicksPerNs * (1.0 + drift);
+
+    TimeStampData cpuGpuTime = {};
+    EXPECT_TRUE(osTime->getCpuGpuTime(&cpuGpuTime));
+    EXPECT_EQ(1, drm->ioctl_cnt.regRead);
+    EXPECT_EQ(mockCpuTime, cpuGpuTime.CPUTimeinNS);
+    EXPECT_EQ(drm->getGpuTimeStamp(), cpuGpuTime.GPUTimeStamp);
+
+    // nominal rate is used until second calibration, error grows with drift
+    auto maxError = static_cast<int64_t>(10 * millisecond * nominalGpuTicksPerNs * drift) + 1;
+    for (int i = 1; i < 10; i++) {
+        auto previousGpuTimeStamp = cpuGpuTime.GPUTimeStamp;
+        mockCpuTime += millisecond;
+        EXPECT_TRUE(osTime->getCpuGpuTime(&cpuGpuTime));
+        EXPECT_EQ(1, drm->ioctl_cnt.regRead);
+        EXPECT_EQ(mockCpuTime, cpuGpuTime.CPUTimeinNS);
+        EXPECT_GT(cpuGpuTime.GPUTimeStamp, previousGpuTimeStamp);
+        EXPECT_LE(std::abs(static_cast<int64_t>(cpuGpuTime.GPUTimeStamp - drm->getGpuTimeStamp())), maxError);
+    }
+
+    mockCpuTime += millisecond;
+    EXPECT_TRUE(osTime->getCpuGpuTime(&cpuGpuTime));
+    EXPECT_EQ(2, drm->ioctl_cnt.regRead);
+    EXPECT_EQ(drm->getGpuTimeStamp(), cpuGpuTime.GPUTimeStamp);
+
+    // measured rate follows GPU clock
+    for (int i = 1; i < 10; i++) {
+        mockCpuTime += millisecond;
+        EXPECT_TRUE(osTime->getCpuGpuTime(&cpuGpuTime));
+        EXPECT_EQ(2, drm->ioctl_cnt.regRead);
+        EXPECT_LE(std::abs(static_cast<int64_t>(cpuGpuTime.GPUTimeStamp - drm->getGpuTimeStamp())), 1);
+    }
+}
+
+TEST_F(DrmTimeModelTest, givenGpuClockSlowerThanModelWhenRecalibratingThenGpuTimestampDoesNotGoBackwards) {
+    drm->gpuTicksPerNs = nominalGpuTicksPerNs * 0.995;
+
+    TimeStampData cpuGpuTime = {};
+    EXPECT_TRUE(osTime->getCpuGpuTime(&cpuGpuTime));
+    mockCpuTime += 10 * millisecond - 1000u;
+    EXPECT_TRUE(osTime->getCpuGpuTime(&cpuGpuTime));
+    auto lastServedGpuTimeStamp = cpuGpuTime.GPUTimeStamp;
+    EXPECT_GT(lastServedGpuTimeStamp, drm->getGpuTimeStamp());
+
+    mockCpuTime += 1000u;
+    EXPECT_TRUE(osTime->getCpuGpuTime(&cpuGpuTime));
+    EXPECT_EQ(2, drm->ioctl_cnt.regRead);
+    EXPECT_EQ(lastServedGpuTimeStamp, cpuGpuTime.GPUTimeStamp);
+}
+
+TEST_F(DrmTimeModelTest, givenModelDisabledWhenGettingCpuGpuTimeThenGpuTimestampIsReadEachTime) {
+    DebugManager.flags.CpuGpuTimeModelRecalibrationPeriodMs.set(0);
+    drm->gpuTicksPerNs = nominalGpuTicksPerNs;
+
+    TimeStampData cpuGpuTime = {};
+    EXPECT_TRUE(osTime->getCpuGpuTime(&cpuGpuTime));
+    mockCpuTime += millisecond;
+    EXPECT_TRUE(osTime->getCpuGpuTime(&cpuGpuTime));
+    EXPECT_EQ(2, drm->ioctl_cnt.regRead);
+    EXPECT_EQ(drm->getGpuTimeStamp(), cpuGpuTime.GPUTimeStamp);
+}
+
+TEST_F(DrmTimeModelTest, givenUnknownGpuTimestampFrequencyWhenGettingCpuGpuTimeThenGpuTimestampIsReadEachTime) {
+    drm->getParamRetValue = 0;
+    drm->gpuTicksPerNs = nominalGpuTicksPerNs;
+
+    TimeStampData cpuGpuTime = {};
+    EXPECT_TRUE(osTime->getCpuGpuTime(&cpuGpuTime));
+    mockCpuTime += millisecond;
+    EXPECT_TRUE(osTime->getCpuGpuTime(&cpuGpuTime));
+    EXPECT_EQ(2, drm->ioctl_cnt.regRead);
+    EXPECT_EQ(drm->getGpuTimeStamp(), cpuGpuTime.GPUTimeStamp);
+}
@@ -49,6 +49,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 
 using namespace NEO;
@@ -594,6 +595,8 @@ TEST_P(ProgramFromBinaryTest, GetBuildInfo_GlobalVariableTotalSize) {
 }
 
 TEST_P(ProgramFromBinaryTest, givenProgramWhenItIsBeingBuildThenItContainsGraphicsAllocationInKernelInfo) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.DeferKernelIsaAllocation.set(0);
     cl_device_id device = pClDevice;
     pProgram->build(1, &device, nullptr, nullptr, nullptr, true);
     auto kernelInfo = pProgram->getKernelInfo(size_t(0));
@@ -610,6 +613,54 @@ TEST_P(ProgramFromBinaryTest, givenProgramWhenItIsBeingBuildThenItContainsGraphi
     EXPECT_EQ(GmmHelper::decanonize(graphicsAllocation->getGpuBaseAddress()), pProgram->getDevice().getMemoryManager()->getInternalHeapBaseAddress(rootDeviceIndex));
 }
 
+TEST_P(ProgramFromBinaryTest, givenDeferredKernelIsaAllocationWhenProgramIsBuiltThenIsaIsUploadedOnlyWhenFirstKernelIsCreated) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.DeferKernelIsaAllocation.set(1);
+    cl_device_id device = pClDevice;
+    pProgram->build(1, &device, nullptr, nullptr, nullptr, true);
+    auto kernelInfo = pProgram->getKernelInfo(size_t(0));
+    EXPECT_TRUE(kernelInfo->isKernelAllocationDeferred());
+    EXPECT_EQ(nullptr, kernelInfo->getGraphicsAllocation());
+
+    cl_int retVal = CL_INVALID_VALUE;
+    std::unique_ptr<Kernel> kernel(Kernel::create(pProgram, *kernelInfo, &retVal));
+    ASSERT_EQ(CL_SUCCESS, retVal);
+    EXPECT_FALSE(kernelInfo->isKernelAllocationDeferred());
+    auto graphicsAllocation = kernelInfo->getGraphicsAllocation();
+    ASSERT_NE(nullptr, graphicsAllocation);
+    EXPECT_EQ(0, memcmp(graphicsAllocation->getUnderlyingBuffer(), kernelInfo->heapInfo.pKernelHeap, kernelInfo->heapInfo.pKernelHeader->KernelHeapSize));
+
+    std::unique_ptr<Kernel> secondKernel(Kernel::create(pProgram, *kernelInfo, &retVal));
+    ASSERT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(graphicsAllocation, kernelInfo->getGraphicsAllocation());
+}
+
+TEST_P(ProgramFromBinaryTest, givenDeferredKernelIsaAllocationWhenKernelsAreCreatedConcurrentlyThenIsaIsUploadedOnce) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.DeferKernelIsaAllocation.set(1);
+    cl_device_id device = pClDevice;
+    pProgram->build(1, &device, nullptr, nullptr, nullptr, true);
+    auto kernelInfo = pProgram->getKernelInfo(size_t(0));
+    ASSERT_TRUE(kernelInfo->isKernelAllocationDeferred());
+
+    GraphicsAllocation *allocations[4] = {};
+    std::vector<std::thread> threads;
+    for (auto &allocation : allocations) {
+        threads.emplace_back([&kernelInfo, &allocation]() {
+            const_cast<KernelInfo *>(kernelInfo)->createDeferredKernelAllocation();
+            allocation = kernelInfo->getGraphicsAllocation();
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_NE(nullptr, allocations[0]);
+    for (auto allocation : allocations) {
+        EXPECT_EQ(allocations[0], allocation);
+    }
+}
+
 TEST_P(ProgramFromBinaryTest, whenProgramIsBeingRebuildThenOutdatedGlobalBuffersAreFreed) {
     cl_device_id device = pClDevice;
     pProgram->build(1, &device, nullptr, nullptr, nullptr, true);
@@ -636,6 +687,8 @@ TEST_P(ProgramFromBinaryTest, givenProgramWhenCleanKernelInfoIsCalledThenKernelA
 }
 
 HWTEST_P(ProgramFromBinaryTest, givenProgramWhenCleanCurrentKernelInfoIsCalledButGpuIsNotYetDoneThenKernelAllocationIsPutOnDefferedFreeListAndCsrRegistersCacheFlush) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.DeferKernelIsaAllocation.set(0);
     cl_device_id device = pClDevice;
     auto &csr = pDevice->getGpgpuCommandStreamReceiver();
     EXPECT_TRUE(csr.getTemporaryAllocations().peekIsEmpty());
@@ -650,6 +703,8 @@ HWTEST_P(ProgramFromBinaryTest, givenProgramWhenCleanCurrentKernelInfoIsCalledBu
 }
 
 HWTEST_P(ProgramFromBinaryTest, givenIsaAllocationUsedByMultipleCsrsWhenItIsDeletedItRegistersCacheFlushInEveryCsrThatUsedIt) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.DeferKernelIsaAllocation.set(0);
     auto &csr0 = this->pDevice->getUltCommandStreamReceiverFromIndex<FamilyType>(0u);
     auto &csr1 = this->pDevice->getUltCommandStreamReceiverFromIndex<FamilyType>(1u);
 
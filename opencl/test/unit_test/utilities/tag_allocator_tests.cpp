@@ -7,6 +7,7 @@
 
 #include "shared/source/helpers/timestamp_packet.h"
 #include "shared/source/utilities/tag_allocator.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
 
 #include "opencl/test/unit_test/fixtures/memory_allocator_fixture.h"
 #include "test.h"
@@ -91,7 +92,8 @@ TEST_F(TagAllocatorTest, Initialize) {
 }
 
 TEST_F(TagAllocatorTest, GetReturnTagCheckFreeAndUsedLists) {
-
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableTagAllocatorMagazines.set(0);
     MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 10, 16);
 
     ASSERT_NE(nullptr, tagAllocator.getGraphicsAllocation());
@@ -294,6 +296,8 @@ TEST_F(TagAllocatorTest, whenNewTagIsTakenThenInitialize) {
 }
 
 TEST_F(TagAllocatorTest, givenMultipleReferencesOnTagWhenReleasingThenReturnWhenAllRefCountsAreReleased) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableTagAllocatorMagazines.set(0);
     MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 2, 1);
 
     auto tag = tagAllocator.getTag();
@@ -415,3 +419,168 @@ TEST_F(TagAllocatorTest, givenTagAllocatorWhenGraphicsAllocationIsCreatedThenSet
     EXPECT_EQ(GraphicsAllocation::AllocationType::PROFILING_TAG_BUFFER, hwTimeStampsTag->getBaseGraphicsAllocation()->getAllocationType());
     EXPECT_EQ(GraphicsAllocation::AllocationType::PROFILING_TAG_BUFFER, hwPerfCounterTag->getBaseGraphicsAllocation()->getAllocationType());
 }
+
+TEST_F(TagAllocatorTest, givenMagazinesEnabledWhenTagIsTakenThenFreeTagsArePrefetchedAndUsedForNextTags) {
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 4, 1);
+
+    auto node1 = tagAllocator.getTag();
+    EXPECT_TRUE(tagAllocator.freeTags.peekIsEmpty());
+
+    auto node2 = tagAllocator.getTag();
+    EXPECT_NE(node1, node2);
+    EXPECT_EQ(1u, tagAllocator.getGraphicsAllocationsCount());
+    EXPECT_FALSE(tagAllocator.usedTags.peekContains(*node2));
+
+    tagAllocator.returnTag(node1);
+    tagAllocator.returnTag(node2);
+}
+
+TEST_F(TagAllocatorTest, givenMagazinesDisabledWhenTagIsTakenThenRemainingTagsStayOnFreeList) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableTagAllocatorMagazines.set(0);
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 4, 1);
+
+    auto node = tagAllocator.getTag();
+    size_t freeTagsCount = 0;
+    for (auto freeNode = tagAllocator.freeTags.peekHead(); freeNode != nullptr; freeNode = freeNode->next) {
+        freeTagsCount++;
+    }
+    EXPECT_EQ(3u, freeTagsCount);
+
+    tagAllocator.returnTag(node);
+}
+
+TEST_F(TagAllocatorTest, givenAllTagsOfAdditionalPoolsReturnedWhenTrimmingThenPoolsAreFreedExceptInitialOne) {
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 1, 4096);
+    constexpr auto idlePassesBeforeTrim = TagAllocator<TimeStamps>::idlePassesBeforeTrim;
+
+    auto node1 = tagAllocator.getTag();
+    auto node2 = tagAllocator.getTag();
+    auto node3 = tagAllocator.getTag();
+    EXPECT_EQ(3u, tagAllocator.getGraphicsAllocationsCount());
+
+    tagAllocator.returnTag(node3);
+    for (uint32_t pass = 1; pass < idlePassesBeforeTrim; pass++) {
+        tagAllocator.trimIdleChunks();
+    }
+    EXPECT_EQ(2u, tagAllocator.getGraphicsAllocationsCount());
+    EXPECT_EQ(2u, tagAllocator.getTagPoolCount());
+
+    tagAllocator.returnTag(node1);
+    EXPECT_EQ(2u, tagAllocator.getGraphicsAllocationsCount());
+    EXPECT_EQ(node2->getBaseGraphicsAllocation(), tagAllocator.getGraphicsAllocation(1));
+
+    tagAllocator.returnTag(node2);
+    for (uint32_t pass = 1; pass < idlePassesBeforeTrim; pass++) {
+        tagAllocator.trimIdleChunks();
+    }
+    EXPECT_EQ(1u, tagAllocator.getGraphicsAllocationsCount());
+    EXPECT_EQ(1u, tagAllocator.getTagPoolCount());
+    EXPECT_EQ(node1, tagAllocator.getFreeTagsHead());
+    EXPECT_EQ(nullptr, tagAllocator.getFreeTagsHead()->next);
+}
+
+TEST_F(TagAllocatorTest, givenPoolIdleForFewerPassesThanRequiredWhenTrimmingThenPoolIsKept) {
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 1, 4096);
+    constexpr auto idlePassesBeforeTrim = TagAllocator<TimeStamps>::idlePassesBeforeTrim;
+
+    auto node1 = tagAllocator.getTag();
+    auto node2 = tagAllocator.getTag();
+
+    tagAllocator.returnTag(node2);
+    for (uint32_t pass = 2; pass < idlePassesBeforeTrim; pass++) {
+        tagAllocator.trimIdleChunks();
+    }
+    EXPECT_EQ(2u, tagAllocator.getGraphicsAllocationsCount());
+
+    tagAllocator.trimIdleChunks();
+    EXPECT_EQ(1u, tagAllocator.getGraphicsAllocationsCount());
+
+    tagAllocator.returnTag(node1);
+}
+
+TEST_F(TagAllocatorTest, givenIdlePoolReusedBeforeTrimWhenTrimmingThenIdlePassesAreCountedFromScratch) {
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 1, 4096);
+    constexpr auto idlePassesBeforeTrim = TagAllocator<TimeStamps>::idlePassesBeforeTrim;
+
+    auto node1 = tagAllocator.getTag();
+    auto node2 = tagAllocator.getTag();
+
+    tagAllocator.returnTag(node2);
+    for (uint32_t pass = 2; pass < idlePassesBeforeTrim; pass++) {
+        tagAllocator.trimIdleChunks();
+    }
+    node2 = tagAllocator.getTag();
+    EXPECT_EQ(tagAllocator.getGraphicsAllocation(1), node2->getBaseGraphicsAllocation());
+    tagAllocator.trimIdleChunks();
+
+    tagAllocator.returnTag(node2);
+    for (uint32_t pass = 2; pass < idlePassesBeforeTrim; pass++) {
+        tagAllocator.trimIdleChunks();
+    }
+    EXPECT_EQ(2u, tagAllocator.getGraphicsAllocationsCount());
+
+    tagAllocator.trimIdleChunks();
+    EXPECT_EQ(1u, tagAllocator.getGraphicsAllocationsCount());
+
+    tagAllocator.returnTag(node1);
+}
+
+TEST_F(TagAllocatorTest, givenMiddlePoolTrimmedWhenLaterPoolBecomesIdleThenItIsTrimmedToo) {
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 1, 4096);
+    constexpr auto idlePassesBeforeTrim = TagAllocator<TimeStamps>::idlePassesBeforeTrim;
+
+    auto node1 = tagAllocator.getTag();
+    auto node2 = tagAllocator.getTag();
+    auto node3 = tagAllocator.getTag();
+
+    tagAllocator.returnTag(node2);
+    for (uint32_t pass = 1; pass < idlePassesBeforeTrim; pass++) {
+        tagAllocator.trimIdleChunks();
+    }
+    ASSERT_EQ(2u, tagAllocator.getGraphicsAllocationsCount());
+    EXPECT_EQ(node3->getBaseGraphicsAllocation(), tagAllocator.getGraphicsAllocation(1));
+
+    tagAllocator.returnTag(node3);
+    for (uint32_t pass = 1; pass < idlePassesBeforeTrim; pass++) {
+        tagAllocator.trimIdleChunks();
+    }
+    EXPECT_EQ(1u, tagAllocator.getGraphicsAllocationsCount());
+
+    tagAllocator.returnTag(node1);
+}
+
+TEST_F(TagAllocatorTest, givenNotCompletedTagWhenTrimmingThenItsPoolIsNotFreed) {
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 1, 4096);
+
+    auto node1 = tagAllocator.getTag();
+    auto node2 = tagAllocator.getTag();
+
+    node2->tagForCpuAccess->release = false;
+    tagAllocator.returnTag(node2);
+    tagAllocator.returnTag(node1);
+    for (uint32_t pass = 0; pass < TagAllocator<TimeStamps>::idlePassesBeforeTrim; pass++) {
+        tagAllocator.trimIdleChunks();
+    }
+    EXPECT_EQ(2u, tagAllocator.getGraphicsAllocationsCount());
+
+    node2->tagForCpuAccess->release = true;
+    tagAllocator.releaseDeferredTags();
+    for (uint32_t pass = 0; pass < TagAllocator<TimeStamps>::idlePassesBeforeTrim; pass++) {
+        tagAllocator.trimIdleChunks();
+    }
+    EXPECT_EQ(1u, tagAllocator.getGraphicsAllocationsCount());
+}
+
+TEST_F(TagAllocatorTest, givenTrimmingDisabledWhenAllTagsAreReturnedThenPoolsAreKept) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableTagAllocatorTrimming.set(0);
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 1, 4096);
+
+    auto node1 = tagAllocator.getTag();
+    auto node2 = tagAllocator.getTag();
+    tagAllocator.returnTag(node1);
+    tagAllocator.returnTag(node2);
+
+    EXPECT_EQ(2u, tagAllocator.getGraphicsAllocationsCount());
+}
@@ -9,8 +9,10 @@
 
 #include "shared/source/built_ins/built_ins.h"
 #include "shared/source/command_stream/experimental_command_buffer.h"
+#include "shared/source/command_stream/implicit_flush_timer.h"
 #include "shared/source/command_stream/preemption.h"
 #include "shared/source/command_stream/scratch_space_controller.h"
+#include "shared/source/command_stream/scratch_space_registry.h"
 #include "shared/source/device/device.h"
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/helpers/array_count.h"
@@ -32,6 +34,10 @@ namespace NEO {
 // Global table of CommandStreamReceiver factories for HW and tests
 CommandStreamReceiverCreateFunc commandStreamReceiverFactory[2 * IGFX_MAX_CORE] = {};
 
+constexpr uint32_t CommandStreamReceiver::defaultBatchedDispatchMaxCommandBuffers;
+constexpr size_t CommandStreamReceiver::defaultBatchedDispatchMaxCommandsSize;
+constexpr int64_t CommandStreamReceiver::defaultBatchedDispatchDeadlineMicroseconds;
+
 CommandStreamReceiver::CommandStreamReceiver(ExecutionEnvironment &executionEnvironment, uint32_t rootDeviceIndex)
     : executionEnvironment(executionEnvironment), rootDeviceIndex(rootDeviceIndex) {
     residencyAllocations.reserve(20);
@@ -49,6 +55,7 @@ CommandStreamReceiver::CommandStreamReceiver(ExecutionEnvironment &executionEnvi
 }
 
 CommandStreamReceiver::~CommandStreamReceiver() {
+    stopImplicitFlushTimer();
     for (int i = 0; i < IndirectHeap::NUM_TYPES; ++i) {
         if (indirectHeap[i] != nullptr) {
             auto allocation = indirectHeap[i]->getGraphicsAllocation();
@@ -75,6 +82,57 @@ bool CommandStreamReceiver::submitBatchBuffer(BatchBuffer &batchBuffer, Residenc
     return ret;
 }
 
+bool CommandStreamReceiver::isBatchedDispatchLimitReached() const {
+    auto pendingCommandBuffersCount = submissionAggregator->getPendingCommandBuffersCount();
+    if (pendingCommandBuffersCount == 0) {
+        return false;
+    }
+
+    uint32_t maxCommandBuffers = defaultBatchedDispatchMaxCommandBuffers;
+    if (DebugManager.flags.BatchedDispatchMaxCommandBuffers.get() != -1) {
+        maxCommandBuffers = static_cast<uint32_t>(DebugManager.flags.BatchedDispatchMaxCommandBuffers.get());
+    }
+    if (pendingCommandBuffersCount >= maxCommandBuffers) {
+        return true;
+    }
+
+    size_t maxCommandsSize = defaultBatchedDispatchMaxCommandsSize;
+    if (DebugManager.flags.BatchedDispatchMaxCommandsSize.get() != -1) {
+        maxCommandsSize = static_cast<size_t>(DebugManager.flags.BatchedDispatchMaxCommandsSize.get());
+    }
+    if (submissionAggregator->getPendingCommandBuffersSize() >= maxCommandsSize) {
+        return true;
+    }
+
+    auto deadline = std::chrono::microseconds(getBatchedDispatchDeadlineMicroseconds());
+    return deadline.count() > 0 &&
+           std::chrono::steady_clock::now() - submissionAggregator->getFirstPendingRecordTime() >= deadline;
+}
+
+int64_t CommandStreamReceiver::getBatchedDispatchDeadlineMicroseconds() {
+    if (DebugManager.flags.BatchedDispatchDeadlineMicroseconds.get() != -1) {
+        return DebugManager.flags.BatchedDispatchDeadlineMicroseconds.get();
+    }
+    return defaultBatchedDispatchDeadlineMicroseconds;
+}
+
+void CommandStreamReceiver::armImplicitFlushTimer() {
+    auto deadline = std::chrono::microseconds(getBatchedDispatchDeadlineMicroseconds());
+    if (deadline.count() <= 0 || submissionAggregator->getPendingCommandBuffersCount() == 0) {
+        return;
+    }
+    if (implicitFlushTimer == nullptr) {
+        implicitFlushTimer = std::make_unique<ImplicitFlushTimer>(*this);
+    }
+    implicitFlushTimer->arm(submissionAggregator->getFirstPendingRecordTime() + deadline);
+}
+
+void CommandStreamReceiver::stopImplicitFlushTimer() {
+    if (implicitFlushTimer) {
+        implicitFlushTimer->stop();
+    }
+}
+
 void CommandStreamReceiver::makeResident(GraphicsAllocation &gfxAllocation) {
     auto submissionTaskCount = this->taskCount + 1;
     if (gfxAllocation.isResidencyTaskCountBelow(submissionTaskCount, osContext->getContextId())) {
@@ -241,6 +299,12 @@ FlushStamp CommandStreamReceiver::obtainCurrentFlushStamp() const {
 }
 
 void CommandStreamReceiver::setRequiredScratchSizes(uint32_t newRequiredScratchSize, uint32_t newRequiredPrivateScratchSize) {
+    // programs with bigger scratch were released, kernels enqueued from now on start new high water mark
+    auto registryGeneration = executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->scratchSpaceRegistry->getGeneration();
+    if (registryGeneration != scratchSpaceRegistryGeneration) {
+        scratchSpaceRegistryGeneration = registryGeneration;
+        requiredScratchSize = 0;
+    }
     if (newRequiredScratchSize > requiredScratchSize) {
         requiredScratchSize = newRequiredScratchSize;
     }
@@ -30,6 +30,7 @@ class ExperimentalCommandBuffer;
 class GmmPageTableMngr;
 class GraphicsAllocation;
 class HostPtrSurface;
+class ImplicitFlushTimer;
 class IndirectHeap;
 class InternalAllocationStorage;
 class LinearStream;
@@ -48,7 +49,7 @@ enum class DispatchMode {
     DeviceDefault = 0,          //default for given device
     ImmediateDispatch,          //everything is submitted to the HW immediately
     AdaptiveDispatch,           //dispatching is handled to async thread, which combines batch buffers basing on load (not implemented)
-    BatchedDispatchWithCounter, //dispatching is batched, after n commands there is implicit flush (not implemented)
+    BatchedDispatchWithCounter, //dispatching is batched, implicit flush after n commands, commands size budget or deadline
     BatchedDispatch             // dispatching is batched, explicit clFlush is required
 };
 
@@ -60,6 +61,10 @@ class CommandStreamReceiver {
         samplerCacheFlushAfter   //add sampler cache flush after Walker with redescribed image
     };
     using MutexType = std::recursive_mutex;
+    static constexpr uint32_t defaultBatchedDispatchMaxCommandBuffers = 16;
+    static constexpr size_t defaultBatchedDispatchMaxCommandsSize = 256 * MemoryConstants::kiloByte;
+    static constexpr int64_t defaultBatchedDispatchDeadlineMicroseconds = 500;
+
     CommandStreamReceiver(ExecutionEnvironment &executionEnvironment, uint32_t rootDeviceIndex);
     virtual ~CommandStreamReceiver();
 
@@ -117,6 +122,11 @@ class CommandStreamReceiver {
     bool isNTo1SubmissionModelEnabled() const { return this->nTo1SubmissionModelEnabled; }
     void overrideDispatchPolicy(DispatchMode overrideValue) { this->dispatchMode = overrideValue; }
 
+    bool isBatchedDispatchLimitReached() const;
+    void armImplicitFlushTimer();
+    void stopImplicitFlushTimer();
+    static int64_t getBatchedDispatchDeadlineMicroseconds();
+
     void setMediaVFEStateDirty(bool dirty) { mediaVfeStateDirty = dirty; }
 
     void setRequiredScratchSizes(uint32_t newRequiredScratchSize, uint32_t newRequiredPrivateScratchSize);
@@ -202,6 +212,9 @@ class CommandStreamReceiver {
         return false;
     }
 
+    // Buffer objects bound by direct submission ring in given session stay referenced until the ring is stopped
+    virtual void releaseDirectSubmissionResidency(uint64_t session) {}
+
   protected:
     void cleanupResources();
 
@@ -215,6 +228,7 @@ class CommandStreamReceiver {
     std::unique_ptr<TagAllocator<HwTimeStamps>> profilingTimeStampAllocator;
     std::unique_ptr<TagAllocator<HwPerfCounter>> perfCounterAllocator;
     std::unique_ptr<TagAllocator<TimestampPacketStorage>> timestampPacketAllocator;
+    std::unique_ptr<ImplicitFlushTimer> implicitFlushTimer;
 
     ResidencyContainer residencyAllocations;
     ResidencyContainer evictionAllocations;
@@ -255,6 +269,7 @@ class CommandStreamReceiver {
 
     uint32_t requiredScratchSize = 0;
     uint32_t requiredPrivateScratchSize = 0;
+    uint32_t scratchSpaceRegistryGeneration = 0;
 
     const uint32_t rootDeviceIndex;
 
@@ -7,6 +7,7 @@
 
 #include "shared/source/command_stream/command_stream_receiver_hw.h"
 #include "shared/source/command_stream/experimental_command_buffer.h"
+#include "shared/source/command_stream/implicit_flush_timer.h"
 #include "shared/source/command_stream/linear_stream.h"
 #include "shared/source/command_stream/preemption.h"
 #include "shared/source/command_stream/scratch_space_controller_base.h"
@@ -35,7 +36,10 @@
 namespace NEO {
 
 template <typename GfxFamily>
-CommandStreamReceiverHw<GfxFamily>::~CommandStreamReceiverHw() = default;
+CommandStreamReceiverHw<GfxFamily>::~CommandStreamReceiverHw() {
+    // timer thread calls virtual flushBatchedSubmissions, it has to be stopped before this level is torn down
+    this->stopImplicitFlushTimer();
+}
 
 template <typename GfxFamily>
 CommandStreamReceiverHw<GfxFamily>::CommandStreamReceiverHw(ExecutionEnvironment &executionEnvironment, uint32_t rootDeviceIndex)
@@ -482,6 +486,7 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
             commandBuffer->surfaces.swap(this->getResidencyAllocations());
             commandBuffer->batchBufferEndLocation = bbEndLocation;
             commandBuffer->taskCount = this->taskCount + 1;
+            commandBuffer->commandsSize = (commandStreamTask.getUsed() - commandStreamStartTask) + (commandStreamCSR.getUsed() - commandStreamStartCSR);
             commandBuffer->flushStamp->replaceStampObject(dispatchFlags.flushStampReference);
             commandBuffer->pipeControlThatMayBeErasedLocation = currentPipeControlForNooping;
             commandBuffer->epiloguePipeControlLocation = epiloguePipeControlLocation;
@@ -498,7 +503,16 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
         }
     }
 
-    if (this->dispatchMode == DispatchMode::BatchedDispatch && (dispatchFlags.blocking || dispatchFlags.implicitFlush)) {
+    if (this->dispatchMode == DispatchMode::BatchedDispatchWithCounter) {
+        if (this->isBatchedDispatchLimitReached()) {
+            dispatchFlags.implicitFlush = true;
+        } else if (!dispatchFlags.blocking && !dispatchFlags.implicitFlush) {
+            this->armImplicitFlushTimer();
+        }
+    }
+
+    bool batchedDispatch = this->dispatchMode == DispatchMode::BatchedDispatch || this->dispatchMode == DispatchMode::BatchedDispatchWithCounter;
+    if (batchedDispatch && (dispatchFlags.blocking || dispatchFlags.implicitFlush)) {
         this->flushBatchedSubmissions();
     }
 
@@ -631,6 +645,12 @@ inline bool CommandStreamReceiverHw<GfxFamily>::flushBatchedSubmissions() {
             resourcePackage.clear();
         }
         this->totalMemoryUsed = 0;
+        if (commandBufferList.peekIsEmpty()) {
+            this->submissionAggregator->resetPendingCounters();
+            if (this->implicitFlushTimer) {
+                this->implicitFlushTimer->disarm();
+            }
+        }
     }
 
     return submitResult;
@@ -712,6 +732,9 @@ inline void CommandStreamReceiverHw<GfxFamily>::waitForTaskCountWithKmdNotifyFal
     int64_t waitTimeout = 0;
     bool enableTimeout = kmdNotifyHelper->obtainTimeoutParams(waitTimeout, useQuickKmdSleep, *getTagAddress(), taskCountToWait, flushStampToWait, forcePowerSavingMode);
 
+    bool completedOnEntry = *getTagAddress() >= taskCountToWait;
+    auto waitStartTimestamp = completedOnEntry ? 0 : kmdNotifyHelper->getMicrosecondsSinceEpoch();
+
     auto status = waitForCompletionWithTimeout(enableTimeout, waitTimeout, taskCountToWait);
     if (!status) {
         waitForFlushStamp(flushStampToWait);
@@ -720,6 +743,10 @@ inline void CommandStreamReceiverHw<GfxFamily>::waitForTaskCountWithKmdNotifyFal
     }
     UNRECOVERABLE_IF(*getTagAddress() < taskCountToWait);
 
+    if (!completedOnEntry) {
+        kmdNotifyHelper->updateWaitStatistics(waitStartTimestamp, status);
+    }
+
     if (kmdNotifyHelper->quickKmdSleepForSporadicWaitsEnabled()) {
         kmdNotifyHelper->updateLastWaitForCompletionTimestamp();
     }
@@ -22,5 +22,8 @@ class CsrDependencies : public StackVec<TimestampPacketContainer *, 32> {
     };
 
     void makeResident(CommandStreamReceiver &commandStreamReceiver) const;
+
+    // Node written by host with 0 in first context start when dependency was terminated, walkers are predicated on it
+    TimestampPacketContainer *dispatchPredicateNodes = nullptr;
 };
 } // namespace NEO
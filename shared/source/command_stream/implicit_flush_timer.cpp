@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/command_stream/implicit_flush_timer.h"
+
+#include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/os_interface/os_thread.h"
+
+namespace NEO {
+
+ImplicitFlushTimer::ImplicitFlushTimer(CommandStreamReceiver &csr) : csr(csr) {}
+
+ImplicitFlushTimer::~ImplicitFlushTimer() {
+    stop();
+}
+
+void ImplicitFlushTimer::arm(TimePoint newDeadline) {
+    std::unique_lock<std::mutex> lock(mtx);
+    if (stopRequested) {
+        return;
+    }
+    if (armed && deadline <= newDeadline) {
+        return;
+    }
+    armed = true;
+    deadline = newDeadline;
+    if (worker == nullptr) {
+        worker = Thread::create(run, reinterpret_cast<void *>(this));
+    }
+    lock.unlock();
+    condition.notify_one();
+}
+
+void ImplicitFlushTimer::disarm() {
+    std::lock_guard<std::mutex> lock(mtx);
+    armed = false;
+}
+
+void ImplicitFlushTimer::stop() {
+    std::unique_lock<std::mutex> lock(mtx);
+    stopRequested = true;
+    armed = false;
+    lock.unlock();
+    condition.notify_one();
+    if (worker) {
+        worker->join();
+        worker.reset();
+    }
+}
+
+void *ImplicitFlushTimer::run(void *arg) {
+    auto self = reinterpret_cast<ImplicitFlushTimer *>(arg);
+    std::unique_lock<std::mutex> lock(self->mtx);
+    while (!self->stopRequested) {
+        if (!self->armed) {
+            self->condition.wait(lock);
+            continue;
+        }
+        if (self->condition.wait_until(lock, self->deadline) == std::cv_status::no_timeout) {
+            // rearmed, disarmed or stopped, state is reevaluated
+            continue;
+        }
+        if (!self->armed || std::chrono::steady_clock::now() < self->deadline) {
+            continue;
+        }
+        self->armed = false;
+        lock.unlock();
+        self->csr.flushBatchedSubmissions();
+        self->expirationsCount++;
+        lock.lock();
+    }
+    return nullptr;
+}
+} // namespace NEO
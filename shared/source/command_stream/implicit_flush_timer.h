@@ -0,0 +1,48 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+
+namespace NEO {
+class CommandStreamReceiver;
+class Thread;
+
+// Flushes batched submissions of a csr once deadline of the oldest recorded command buffer passes,
+// so batches recorded in BatchedDispatchWithCounter mode are submitted even when no further work comes.
+// Worker thread is created on first arm() and calls csr.flushBatchedSubmissions() without holding the timer lock.
+class ImplicitFlushTimer {
+  public:
+    using TimePoint = std::chrono::steady_clock::time_point;
+
+    ImplicitFlushTimer(CommandStreamReceiver &csr);
+    ~ImplicitFlushTimer();
+
+    void arm(TimePoint deadline);
+    void disarm();
+    // joins worker thread, must not be called with csr ownership acquired
+    void stop();
+
+    uint32_t getExpirationsCount() const { return expirationsCount; }
+
+  protected:
+    static void *run(void *arg);
+
+    CommandStreamReceiver &csr;
+    std::unique_ptr<Thread> worker;
+    std::mutex mtx;
+    std::condition_variable condition;
+    TimePoint deadline;
+    bool armed = false;
+    bool stopRequested = false;
+    std::atomic<uint32_t> expirationsCount{0};
+};
+} // namespace NEO
@@ -7,7 +7,11 @@
 
 #include "shared/source/command_stream/scratch_space_controller_base.h"
 
+#include "shared/source/command_stream/preemption.h"
+#include "shared/source/command_stream/scratch_space_registry.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/execution_environment/execution_environment.h"
+#include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/hw_helper.h"
 #include "shared/source/helpers/preamble.h"
@@ -17,9 +21,25 @@
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/os_interface/os_context.h"
 
+#include <algorithm>
+
 namespace NEO {
 ScratchSpaceControllerBase::ScratchSpaceControllerBase(uint32_t rootDeviceIndex, ExecutionEnvironment &environment, InternalAllocationStorage &allocationStorage)
     : ScratchSpaceController(rootDeviceIndex, environment, allocationStorage) {
+    // mid-thread preempted kernels keep their scratch content, other contexts of the engine can't reuse it then
+    auto hwInfo = executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->getHardwareInfo();
+    sharedScratchSpaceEnabled = PreemptionHelper::getDefaultPreemptionMode(*hwInfo) != PreemptionMode::MidThread &&
+                                executionEnvironment.debugger.get() == nullptr;
+    if (DebugManager.flags.EnableSharedScratchSpace.get() != -1) {
+        sharedScratchSpaceEnabled = DebugManager.flags.EnableSharedScratchSpace.get() == 1;
+    }
+}
+
+ScratchSpaceControllerBase::~ScratchSpaceControllerBase() {
+    if (sharedScratchSpaceEnabled && scratchAllocation) {
+        getScratchSpaceRegistry().releaseSharedScratchAllocation(sharingKey, this, scratchAllocation, *getMemoryManager());
+        scratchAllocation = nullptr;
+    }
 }
 
 void ScratchSpaceControllerBase::setRequiredScratchSpace(void *sshBaseAddress,
@@ -30,13 +50,37 @@ void ScratchSpaceControllerBase::setRequiredScratchSpace(void *sshBaseAddress,
                                                          bool &stateBaseAddressDirty,
                                                          bool &vfeStateDirty) {
     size_t requiredScratchSizeInBytes = requiredPerThreadScratchSize * computeUnitsUsedForScratch;
-    if (requiredScratchSizeInBytes && (!scratchAllocation || scratchSizeBytes < requiredScratchSizeInBytes)) {
+    if (!requiredScratchSizeInBytes) {
+        return;
+    }
+    auto &scratchSpaceRegistry = getScratchSpaceRegistry();
+    size_t predictedScratchSizeInBytes = std::max(requiredScratchSizeInBytes,
+                                                  static_cast<size_t>(scratchSpaceRegistry.getMaxPerThreadScratchSize()) * computeUnitsUsedForScratch);
+
+    auto previousScratchAllocation = scratchAllocation;
+    if (sharedScratchSpaceEnabled) {
+        // registry releases previous allocation once all its users switch away, it has to see this context's usage
+        if (scratchAllocation) {
+            scratchAllocation->updateTaskCount(currentTaskCount, osContext.getContextId());
+        }
+        sharingKey = ScratchSpaceRegistry::getSharingKey(static_cast<uint32_t>(osContext.getEngineType()), static_cast<uint32_t>(osContext.getDeviceBitfield().to_ulong()));
+        scratchAllocation = scratchSpaceRegistry.obtainSharedScratchAllocation(sharingKey, this, scratchAllocation, requiredScratchSizeInBytes,
+                                                                              predictedScratchSizeInBytes, scratchSizeBytes, *getMemoryManager(), rootDeviceIndex);
+    } else if (!scratchAllocation || scratchSizeBytes < requiredScratchSizeInBytes || scratchSizeBytes > predictedScratchSizeInBytes) {
         if (scratchAllocation) {
             scratchAllocation->updateTaskCount(currentTaskCount, osContext.getContextId());
             csrAllocationStorage.storeAllocation(std::unique_ptr<GraphicsAllocation>(scratchAllocation), TEMPORARY_ALLOCATION);
         }
-        scratchSizeBytes = requiredScratchSizeInBytes;
+        scratchSizeBytes = predictedScratchSizeInBytes;
         createScratchSpaceAllocation();
+    }
+
+    // allocation may already fit bigger per-thread size, VFE state has to be reprogrammed nevertheless
+    if (requiredPerThreadScratchSize != perThreadScratchSize) {
+        perThreadScratchSize = requiredPerThreadScratchSize;
+        vfeStateDirty = true;
+    }
+    if (scratchAllocation != previousScratchAllocation) {
         vfeStateDirty = true;
         force32BitAllocation = getMemoryManager()->peekForce32BitAllocations();
         if (is64bit && !force32BitAllocation) {
@@ -50,6 +94,10 @@ void ScratchSpaceControllerBase::createScratchSpaceAllocation() {
     UNRECOVERABLE_IF(scratchAllocation == nullptr);
 }
 
+ScratchSpaceRegistry &ScratchSpaceControllerBase::getScratchSpaceRegistry() const {
+    return *executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->scratchSpaceRegistry;
+}
+
 uint64_t ScratchSpaceControllerBase::calculateNewGSH() {
     uint64_t gsh = 0;
     if (scratchAllocation) {
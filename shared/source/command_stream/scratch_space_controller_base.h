@@ -9,10 +9,12 @@
 #include "shared/source/command_stream/scratch_space_controller.h"
 
 namespace NEO {
+class ScratchSpaceRegistry;
 
 class ScratchSpaceControllerBase : public ScratchSpaceController {
   public:
     ScratchSpaceControllerBase(uint32_t rootDeviceIndex, ExecutionEnvironment &environment, InternalAllocationStorage &allocationStorage);
+    ~ScratchSpaceControllerBase() override;
 
     void setRequiredScratchSpace(void *sshBaseAddress,
                                  uint32_t requiredPerThreadScratchSize,
@@ -26,7 +28,14 @@ class ScratchSpaceControllerBase : public ScratchSpaceController {
 
     void reserveHeap(IndirectHeap::Type heapType, IndirectHeap *&indirectHeap) override;
 
+    bool isSharedScratchSpaceEnabled() const { return sharedScratchSpaceEnabled; }
+
   protected:
     void createScratchSpaceAllocation();
+    ScratchSpaceRegistry &getScratchSpaceRegistry() const;
+
+    bool sharedScratchSpaceEnabled = false;
+    uint64_t sharingKey = 0u;
+    uint32_t perThreadScratchSize = 0u;
 };
 } // namespace NEO
@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/command_stream/scratch_space_registry.h"
+
+#include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/memory_manager/graphics_allocation.h"
+#include "shared/source/memory_manager/memory_manager.h"
+
+#include <algorithm>
+
+namespace NEO {
+
+void ScratchSpaceRegistry::registerPerThreadScratchSize(uint32_t perThreadScratchSize) {
+    std::lock_guard<std::mutex> lock(mtx);
+    perThreadScratchSizes.insert(perThreadScratchSize);
+}
+
+void ScratchSpaceRegistry::unregisterPerThreadScratchSize(uint32_t perThreadScratchSize) {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto it = perThreadScratchSizes.find(perThreadScratchSize);
+    UNRECOVERABLE_IF(it == perThreadScratchSizes.end());
+    auto previousMax = *perThreadScratchSizes.rbegin();
+    perThreadScratchSizes.erase(it);
+    auto currentMax = perThreadScratchSizes.empty() ? 0u : *perThreadScratchSizes.rbegin();
+    if (currentMax < previousMax) {
+        generation++;
+    }
+}
+
+uint32_t ScratchSpaceRegistry::getMaxPerThreadScratchSize() {
+    std::lock_guard<std::mutex> lock(mtx);
+    return perThreadScratchSizes.empty() ? 0u : *perThreadScratchSizes.rbegin();
+}
+
+GraphicsAllocation *ScratchSpaceRegistry::obtainSharedScratchAllocation(uint64_t sharingKey, const void *user, GraphicsAllocation *userAllocation,
+                                                                        size_t requiredSize, size_t predictedSize, size_t &allocationSize,
+                                                                        MemoryManager &memoryManager, uint32_t rootDeviceIndex) {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto &sharedScratch = sharedScratchAllocations[sharingKey];
+    sharedScratch.requiredSizes[user] = requiredSize;
+
+    size_t maxRequiredSize = 0u;
+    for (auto &userRequiredSize : sharedScratch.requiredSizes) {
+        maxRequiredSize = std::max(maxRequiredSize, userRequiredSize.second);
+    }
+    auto sizeToAllocate = std::max(maxRequiredSize, predictedSize);
+
+    if (!sharedScratch.allocation || sharedScratch.size < maxRequiredSize || sharedScratch.size > sizeToAllocate) {
+        auto allocation = memoryManager.allocateGraphicsMemoryWithProperties({rootDeviceIndex, sizeToAllocate, GraphicsAllocation::AllocationType::SCRATCH_SURFACE});
+        UNRECOVERABLE_IF(allocation == nullptr);
+        // previous allocation stays alive until all users switch to the new one
+        if (sharedScratch.allocation) {
+            removeAllocationUser(sharedScratch.allocation, memoryManager);
+        }
+        sharedScratch.allocation = allocation;
+        sharedScratch.size = sizeToAllocate;
+        addAllocationUser(allocation);
+    }
+
+    if (userAllocation != sharedScratch.allocation) {
+        addAllocationUser(sharedScratch.allocation);
+        if (userAllocation) {
+            removeAllocationUser(userAllocation, memoryManager);
+        }
+    }
+    allocationSize = sharedScratch.size;
+    return sharedScratch.allocation;
+}
+
+void ScratchSpaceRegistry::releaseSharedScratchAllocation(uint64_t sharingKey, const void *user, GraphicsAllocation *userAllocation, MemoryManager &memoryManager) {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto it = sharedScratchAllocations.find(sharingKey);
+    UNRECOVERABLE_IF(it == sharedScratchAllocations.end());
+    auto &sharedScratch = it->second;
+
+    sharedScratch.requiredSizes.erase(user);
+    if (userAllocation) {
+        removeAllocationUser(userAllocation, memoryManager);
+    }
+    if (sharedScratch.requiredSizes.empty()) {
+        removeAllocationUser(sharedScratch.allocation, memoryManager);
+        sharedScratchAllocations.erase(it);
+    }
+}
+
+size_t ScratchSpaceRegistry::getSharedScratchAllocationsCount() {
+    std::lock_guard<std::mutex> lock(mtx);
+    return allocationUsers.size();
+}
+
+void ScratchSpaceRegistry::addAllocationUser(GraphicsAllocation *allocation) {
+    allocationUsers[allocation]++;
+}
+
+void ScratchSpaceRegistry::removeAllocationUser(GraphicsAllocation *allocation, MemoryManager &memoryManager) {
+    auto it = allocationUsers.find(allocation);
+    UNRECOVERABLE_IF(it == allocationUsers.end());
+    if (--it->second == 0u) {
+        allocationUsers.erase(it);
+        memoryManager.checkGpuUsageAndDestroyGraphicsAllocations(allocation);
+    }
+}
+} // namespace NEO
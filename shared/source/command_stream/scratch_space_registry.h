@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <set>
+#include <unordered_map>
+
+namespace NEO {
+
+class GraphicsAllocation;
+class MemoryManager;
+
+// Per root device knowledge about scratch space.
+// Programs and modules register per-thread scratch size of their biggest kernel when loaded and unregister it when released,
+// so scratch space controllers can allocate the final size upfront and shrink once such programs are gone.
+// Contexts of the same engine never run kernels concurrently, without mid-thread preemption they may use one shared scratch allocation.
+class ScratchSpaceRegistry {
+  public:
+    ScratchSpaceRegistry() = default;
+    ScratchSpaceRegistry(const ScratchSpaceRegistry &) = delete;
+    ScratchSpaceRegistry &operator=(const ScratchSpaceRegistry &) = delete;
+
+    void registerPerThreadScratchSize(uint32_t perThreadScratchSize);
+    void unregisterPerThreadScratchSize(uint32_t perThreadScratchSize);
+    uint32_t getMaxPerThreadScratchSize();
+
+    // incremented whenever maximal registered per-thread scratch size drops
+    uint32_t getGeneration() const { return generation; }
+
+    static uint64_t getSharingKey(uint32_t engineType, uint32_t deviceBitfield) {
+        return (static_cast<uint64_t>(engineType) << 32) | deviceBitfield;
+    }
+
+    // returns shared allocation fitting required sizes of all users, userAllocation is the one previously obtained by the user
+    GraphicsAllocation *obtainSharedScratchAllocation(uint64_t sharingKey, const void *user, GraphicsAllocation *userAllocation,
+                                                      size_t requiredSize, size_t predictedSize, size_t &allocationSize,
+                                                      MemoryManager &memoryManager, uint32_t rootDeviceIndex);
+    void releaseSharedScratchAllocation(uint64_t sharingKey, const void *user, GraphicsAllocation *userAllocation, MemoryManager &memoryManager);
+
+    size_t getSharedScratchAllocationsCount();
+
+  protected:
+    struct SharedScratchAllocation {
+        GraphicsAllocation *allocation = nullptr;
+        size_t size = 0u;
+        std::map<const void *, size_t> requiredSizes;
+    };
+
+    void addAllocationUser(GraphicsAllocation *allocation);
+    void removeAllocationUser(GraphicsAllocation *allocation, MemoryManager &memoryManager);
+
+    std::mutex mtx;
+    std::multiset<uint32_t> perThreadScratchSizes;
+    std::atomic<uint32_t> generation{0u};
+    std::unordered_map<uint64_t, SharedScratchAllocation> sharedScratchAllocations;
+    std::unordered_map<GraphicsAllocation *, uint32_t> allocationUsers;
+};
+} // namespace NEO
@@ -11,9 +11,19 @@
 #include "shared/source/memory_manager/graphics_allocation.h"
 
 void NEO::SubmissionAggregator::recordCommandBuffer(CommandBuffer *commandBuffer) {
+    if (pendingCommandBuffersCount == 0) {
+        firstPendingRecordTime = std::chrono::steady_clock::now();
+    }
+    pendingCommandBuffersCount++;
+    pendingCommandBuffersSize += commandBuffer->commandsSize;
     this->cmdBuffers.pushTailOne(*commandBuffer);
 }
 
+void NEO::SubmissionAggregator::resetPendingCounters() {
+    pendingCommandBuffersCount = 0;
+    pendingCommandBuffersSize = 0;
+}
+
 void NEO::SubmissionAggregator::aggregateCommandBuffers(ResourcePackage &resourcePackage, size_t &totalUsedSize, size_t totalMemoryBudget, uint32_t osContextId) {
     auto primaryCommandBuffer = this->cmdBuffers.peekHead();
     auto currentInspection = this->inspectionId;
@@ -12,6 +12,7 @@
 #include "shared/source/utilities/idlist.h"
 #include "shared/source/utilities/stackvec.h"
 
+#include <chrono>
 #include <vector>
 namespace NEO {
 class Device;
@@ -54,6 +55,7 @@ struct CommandBuffer : public IDNode<CommandBuffer> {
     void *batchBufferEndLocation = nullptr;
     uint32_t inspectionId = 0;
     uint32_t taskCount = 0u;
+    size_t commandsSize = 0u;
     void *pipeControlThatMayBeErasedLocation = nullptr;
     void *epiloguePipeControlLocation = nullptr;
     std::unique_ptr<FlushStampTracker> flushStamp;
@@ -70,8 +72,17 @@ class SubmissionAggregator {
     void aggregateCommandBuffers(ResourcePackage &resourcePackage, size_t &totalUsedSize, size_t totalMemoryBudget, uint32_t osContextId);
     CommandBufferList &peekCmdBufferList() { return cmdBuffers; }
 
+    // state of the batch recorded since last flush, used for implicit flushes in BatchedDispatchWithCounter mode
+    uint32_t getPendingCommandBuffersCount() const { return pendingCommandBuffersCount; }
+    size_t getPendingCommandBuffersSize() const { return pendingCommandBuffersSize; }
+    std::chrono::steady_clock::time_point getFirstPendingRecordTime() const { return firstPendingRecordTime; }
+    void resetPendingCounters();
+
   protected:
     CommandBufferList cmdBuffers;
     uint32_t inspectionId = 1;
+    uint32_t pendingCommandBuffersCount = 0;
+    size_t pendingCommandBuffersSize = 0;
+    std::chrono::steady_clock::time_point firstPendingRecordTime;
 };
 } // namespace NEO
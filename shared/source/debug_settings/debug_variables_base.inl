@@ -25,6 +25,8 @@ DECLARE_DEBUG_VARIABLE(int32_t, AUBDumpFilterKernelEndIdx, -1, "End index of ker
 DECLARE_DEBUG_VARIABLE(int32_t, AUBDumpToggleCaptureOnOff, 0, "Toggle AUB capture on/off")
 DECLARE_DEBUG_VARIABLE(int32_t, AubDumpOverrideMmioRegister, 0, "Override mmio offset from list with new value from AubDumpOverrideMmioRegisterValue")
 DECLARE_DEBUG_VARIABLE(int32_t, AubDumpOverrideMmioRegisterValue, 0, "Value to override mmio offset from AubDumpOverrideMmioRegister")
+DECLARE_DEBUG_VARIABLE(int32_t, AubDumpBackgroundWriter, -1, "-1: default (disabled), 0: write AUB file on submitting thread, 1: buffer AUB records and write them to file on background thread, file content is complete only after AUB file is closed")
+DECLARE_DEBUG_VARIABLE(int32_t, AubDumpWriterBufferSizeKB, -1, "-1: default (4096), >0: size of single buffer used by AUB background writer in KB")
 DECLARE_DEBUG_VARIABLE(int32_t, SetCommandStreamReceiver, -1, "Set command stream receiver to: 0 - HW, 1 - AUB, 2 - TBX, 3 - HW & AUB, 4 - TBX & AUB")
 DECLARE_DEBUG_VARIABLE(int32_t, TbxPort, 4321, "TCP-IP port of TBX server")
 DECLARE_DEBUG_VARIABLE(bool, FlattenBatchBufferForAUBDump, false, "Dump multi-level batch buffers to AUB as single, flat batch buffer")
@@ -32,6 +34,7 @@ DECLARE_DEBUG_VARIABLE(bool, AddPatchInfoCommentsForAUBDump, false, "Dump commen
 DECLARE_DEBUG_VARIABLE(bool, UseAubStream, true, "Use aub_stream for aub dumping")
 DECLARE_DEBUG_VARIABLE(bool, AUBDumpAllocsOnEnqueueReadOnly, false, "Force dumping buffers and images on clEnqueueReadBuffer/Image only (blocking calls)")
 DECLARE_DEBUG_VARIABLE(bool, AUBDumpForceAllToLocalMemory, false, "Force placing every allocation in local memory address space")
+DECLARE_DEBUG_VARIABLE(bool, EnableSimulationDirtyPageTracking, false, "Write only 4KB pages modified since previous upload when streaming allocations not written by GPU (command buffers, heaps, ISA) to AUB file or TBX server")
 
 /*DEBUG FLAGS*/
 DECLARE_DEBUG_VARIABLE(std::string, ForceDeviceId, std::string("unk"), "DeviceId selected for testing")
@@ -95,12 +98,34 @@ DECLARE_DEBUG_VARIABLE(bool, DisableZeroCopyForUseHostPtr, false, "When active a
 DECLARE_DEBUG_VARIABLE(bool, DisableZeroCopyForBuffers, false, "When active all buffer allocations will not share memory with CPU.")
 DECLARE_DEBUG_VARIABLE(bool, DisableDcFlushInEpilogue, false, "Disable DC flush in epilogue")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableHostPtrTracking, -1, "Enable host ptr tracking: -1 - default platform setting, 0 - disabled, 1 - enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, CpuCopyThreadCount, -1, "Maximal number of threads used by CPU copies of transfers: -1 - default (up to 8 threads), >0 - thread count")
+DECLARE_DEBUG_VARIABLE(int32_t, CpuCopyMultiThreadThreshold, -1, "Minimal size in bytes of CPU copy split across threads: -1 - default (4MB)")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableCpuCopyNonTemporalStores, -1, "Use streaming stores in CPU copies of transfers: -1 - default (copies over 1MB), 0 - disabled, 1 - enabled for all copies")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableTagAllocatorMagazines, -1, "Prefetch free tags to per thread caches in tag allocators: -1 - default (enabled), 0 - disabled, 1 - enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableTagAllocatorTrimming, -1, "Free tag allocator pools with all tags free: -1 - default (enabled), 0 - disabled, 1 - enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, CommandQueueBuffersCount, -1, "Initial number of command buffers in Level Zero command queue ring: -1 - default (2), >=2 - count")
+DECLARE_DEBUG_VARIABLE(int32_t, CommandQueueMaxBuffersCount, -1, "Maximal number of command buffers the Level Zero command queue ring grows to before blocking: -1 - default (8), >0 - count")
+DECLARE_DEBUG_VARIABLE(int32_t, DeferKernelIsaAllocation, -1, "Allocate and upload kernel ISA when the first kernel is created instead of at program build: -1 - default (enabled), 0 - disabled, 1 - enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, DeviceBinaryDecodingThreadCount, -1, "Number of threads used to decode, validate and process kernels of a device binary: -1 - default (depends on kernels count), >0 - threads count")
+DECLARE_DEBUG_VARIABLE(int32_t, BatchedDispatchMaxCommandBuffers, -1, "Number of command buffers recorded in BatchedDispatchWithCounter mode that triggers implicit flush: -1 - default (16), >0 - count")
+DECLARE_DEBUG_VARIABLE(int32_t, BatchedDispatchMaxCommandsSize, -1, "Size in bytes of commands recorded in BatchedDispatchWithCounter mode that triggers implicit flush: -1 - default (256KB), >=0 - size")
+DECLARE_DEBUG_VARIABLE(int32_t, BatchedDispatchDeadlineMicroseconds, -1, "Time after which batch recorded in BatchedDispatchWithCounter mode is implicitly flushed: -1 - default (500us), 0 - no deadline, >0 - microseconds")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableSharedScratchSpace, -1, "-1: default (shared unless mid-thread preemption is used), 0: each command stream receiver owns its scratch allocation, 1: contexts of the same engine share scratch allocation")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableSurfaceStateTemplates, -1, "-1: default (enabled), 0: program surface state of buffer and image kernel arguments on every set, 1: copy cached surface state templates of memory objects")
+DECLARE_DEBUG_VARIABLE(int32_t, SysmanSamplingPeriodMicroseconds, -1, "-1: default (disabled), >0: sysman samples frequency state on background thread with given period and queries return latest sample")
+DECLARE_DEBUG_VARIABLE(std::string, DeviceCapabilitiesSnapshotDir, std::string("unk"), "unk: default (disabled), otherwise directory where DRM device capabilities probed at startup are stored and reused by following processes")
+DECLARE_DEBUG_VARIABLE(int32_t, PerQueueBuiltinKernelShards, -1, "-1: default, >0: number of per-thread builtin kernel shards of command queue, clamped to 16")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableGpuWaitForUserEvents, -1, "-1: default (disabled), 0: disabled, 1: kernel enqueues depending on single user event are submitted with semaphore wait signaled by clSetUserEventStatus instead of being blocked on host, walkers are predicated off when event is terminated")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableAuxTranslationTracking, -1, "-1: default (disabled), 0: disabled, 1: buffers resolved for kernel stay in non-aux state until accessed differently, builtin aux translation mode only")
+DECLARE_DEBUG_VARIABLE(int32_t, CpuGpuTimeModelRecalibrationPeriodMs, -1, "-1: default (disabled), 0: disabled, >0: profiling CPU and GPU timestamps served from linear model recalibrated with GPU timestamp read after given number of milliseconds, Linux only")
 
 /*FEATURE FLAGS*/
 DECLARE_DEBUG_VARIABLE(bool, EnableNV12, true, "Enables NV12 extension")
 DECLARE_DEBUG_VARIABLE(bool, EnablePackedYuv, true, "Enables cl_packed_yuv extension")
 DECLARE_DEBUG_VARIABLE(bool, EnableDeferredDeleter, true, "Enables async deleter")
 DECLARE_DEBUG_VARIABLE(bool, EnableAsyncDestroyAllocations, true, "Enables async destroying graphics allocations in mem obj destructor")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableSmallBufferPool, -1, "Suballocate small buffers from per context pools: -1 - default (disabled), 0 - disabled, 1 - enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, SmallBufferPoolThreshold, -1, "Maximal size in bytes of a buffer suballocated from pool, -1 - default (4KB)")
 DECLARE_DEBUG_VARIABLE(bool, EnableAsyncEventsHandler, true, "Enables async events handler")
 DECLARE_DEBUG_VARIABLE(bool, EnableForcePin, true, "Enables early pinning for memory object")
 DECLARE_DEBUG_VARIABLE(bool, EnableComputeWorkSizeND, true, "Enables diffrent algorithm to compute local work size")
@@ -117,12 +142,14 @@ DECLARE_DEBUG_VARIABLE(bool, MakeAllBuffersResident, false, "Make all buffers re
 DECLARE_DEBUG_VARIABLE(int32_t, EnableIntelVme, -1, "-1: default, 0: disabled, 1: Enables cl_intel_motion_estimation extension")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableIntelAdvancedVme, -1, "-1: default, 0: disabled, 1: Enables cl_intel_advanced_motion_estimation extension")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableBlitterOperationsSupport, -1, "-1: default, 0: disable, 1: enable")
+DECLARE_DEBUG_VARIABLE(int32_t, EnablePerQueueBuiltinKernels, -1, "-1: default - enabled, 0: disabled, 1: enabled. Command queues use their own instances of builtin kernels")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableBlitterOperationsForReadWriteBuffers, -1, "Use Blitter engine for Read/Write Buffers operations. -1: default, 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableCacheFlushAfterWalker, -1, "-1: platform behavior, 0: disabled, 1: enabled. Adds dedicated cache flush command after WALKER command when surfaces used by kernel require to flush the cache")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableLocalMemory, -1, "-1: default behavior, 0: disabled, 1: enabled, Allows allocating graphics memory in Local Memory")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableStatelessToStatefulBufferOffsetOpt, -1, "-1: dont override, 0: disable, 1: enable, Enables buffer-offset improvement of the stateless to stateful optimization")
 DECLARE_DEBUG_VARIABLE(int32_t, CreateMultipleRootDevices, 0, "0: default - disable, 1+: Driver will create multiple (N) devices during initialization.")
 DECLARE_DEBUG_VARIABLE(int32_t, CreateMultipleSubDevices, 0, "0: default - disable, 1+: Driver will create multiple (N) sub devices during initialization.")
+DECLARE_DEBUG_VARIABLE(int32_t, ParallelRootDeviceInitialization, -1, "-1: default - disable, 0: disable, 1+: maximum number of threads used to initialize OS interfaces of root devices, devices are created sequentially")
 DECLARE_DEBUG_VARIABLE(int32_t, LimitAmountOfReturnedDevices, 0, "0: default - disable, 1+: Driver will limit the number of devices returned from clGetDeviceIds to N.")
 DECLARE_DEBUG_VARIABLE(int32_t, Enable64kbpages, -1, "-1: default behaviour, 0 Disables, 1 Enables support for 64KB pages for driver allocated fine grain svm buffers")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideEnableKmdNotify, -1, "-1: dont override, 0: disable, 1: enable")
@@ -131,6 +158,7 @@ DECLARE_DEBUG_VARIABLE(int32_t, OverrideEnableQuickKmdSleep, -1, "-1: dont overr
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideQuickKmdSleepDelayMicroseconds, -1, "-1: dont override, 0: infinite timeout, >0: timeout in microseconds")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideEnableQuickKmdSleepForSporadicWaits, -1, "-1: dont override, 0: disable, 1: enable. It works only when QuickKmdSleep is enabled.")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideDelayQuickKmdSleepForSporadicWaitsMicroseconds, -1, "-1: dont override, >0: timeout in microseconds")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableAdaptiveKmdNotifyWait, -1, "-1: default (disabled), 0: disable, 1: enable. Tune the spin period of KMD Notify waits to the average completion latency of recent waits. It works only when Kmd Notify is enabled.")
 DECLARE_DEBUG_VARIABLE(int32_t, PowerSavingMode, 0, "0: default 1: enable. Whenever driver waits on GPU and its not ready, put waiting thread to sleep and wait for notification.")
 DECLARE_DEBUG_VARIABLE(int32_t, CsrDispatchMode, 0, "Chooses DispatchMode for Csr")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideDefaultFP64Settings, -1, "-1: dont override, 0: disable, 1: enable.")
@@ -38,6 +38,7 @@ Device::~Device() {
     }
 
     for (auto &engine : engines) {
+        engine.commandStreamReceiver->stopImplicitFlushTimer();
         engine.commandStreamReceiver->flushBatchedSubmissions();
     }
 
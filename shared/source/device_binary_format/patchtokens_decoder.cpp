@@ -11,6 +11,7 @@
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/hash.h"
 #include "shared/source/helpers/ptr_math.h"
+#include "shared/source/utilities/parallel_for.h"
 
 #include <algorithm>
 
@@ -570,20 +571,56 @@ inline bool decodeProgramHeader(ProgramFromPatchtokens &decodedProgram) {
     return true;
 }
 
+size_t getKernelsDecodingThreadCount(size_t kernelsCount) {
+    size_t threadCount = std::min(getDefaultParallelForThreadCount(), (kernelsCount + minKernelsPerDecodingThread - 1) / minKernelsPerDecodingThread);
+    if (DebugManager.flags.DeviceBinaryDecodingThreadCount.get() != -1) {
+        threadCount = static_cast<size_t>(std::max(1, DebugManager.flags.DeviceBinaryDecodingThreadCount.get()));
+    }
+    return std::max(static_cast<size_t>(1u), std::min(threadCount, kernelsCount));
+}
+
 inline bool decodeKernels(ProgramFromPatchtokens &decodedProgram) {
     auto numKernels = decodedProgram.header->NumberOfKernels;
-    decodedProgram.kernels.reserve(decodedProgram.header->NumberOfKernels);
     const uint8_t *decodePos = decodedProgram.blobs.kernelsInfo.begin();
-    bool decodeSuccess = true;
     PatchTokensStreamReader stream{decodedProgram.blobs.kernelsInfo};
-    for (uint32_t i = 0; (i < numKernels) && decodeSuccess; i++) {
-        decodedProgram.kernels.resize(decodedProgram.kernels.size() + 1);
-        auto &currKernelInfo = *decodedProgram.kernels.rbegin();
-        auto kernelDataLeft = ArrayRef<const uint8_t>(decodePos, stream.getDataSizeLeft(decodePos));
-        decodeSuccess = decodeKernelFromPatchtokensBlob(kernelDataLeft, currKernelInfo);
-        decodePos = ptrOffset(decodePos, currKernelInfo.blobs.kernelInfo.size());
+
+    // kernel boundaries come from headers only, so they are found upfront and kernels are decoded independently
+    StackVec<const uint8_t *, 32> kernelsBegin;
+    for (uint32_t i = 0; i < numKernels; i++) {
+        kernelsBegin.push_back(decodePos);
+        if (stream.notEnoughDataLeft<SKernelBinaryHeaderCommon>(decodePos)) {
+            break;
+        }
+        auto header = reinterpret_cast<const SKernelBinaryHeaderCommon *>(decodePos);
+        auto kernelInfoBlobSize = sizeof(SKernelBinaryHeaderCommon) + header->KernelNameSize + header->KernelHeapSize + header->GeneralStateHeapSize + header->DynamicStateHeapSize + header->SurfaceStateHeapSize + header->PatchListSize;
+        if (stream.notEnoughDataLeft(decodePos, kernelInfoBlobSize)) {
+            break;
+        }
+        decodePos = ptrOffset(decodePos, kernelInfoBlobSize);
     }
-    return decodeSuccess;
+
+    auto firstKernel = decodedProgram.kernels.size();
+    decodedProgram.kernels.resize(firstKernel + kernelsBegin.size());
+    auto decodeKernel = [&](size_t kernelNum) {
+        auto kernelDataLeft = ArrayRef<const uint8_t>(kernelsBegin[kernelNum], stream.getDataSizeLeft(kernelsBegin[kernelNum]));
+        decodeKernelFromPatchtokensBlob(kernelDataLeft, decodedProgram.kernels[firstKernel + kernelNum]);
+    };
+    auto threadCount = getKernelsDecodingThreadCount(kernelsBegin.size());
+    if (threadCount > 1) {
+        parallelFor(kernelsBegin.size(), threadCount, decodeKernel);
+    } else {
+        for (size_t i = 0; i < kernelsBegin.size(); i++) {
+            decodeKernel(i);
+        }
+    }
+
+    for (size_t i = firstKernel; i < decodedProgram.kernels.size(); i++) {
+        if (decodedProgram.kernels[i].decodeStatus != DecodeError::Success) {
+            decodedProgram.kernels.resize(i + 1);
+            return false;
+        }
+    }
+    return true;
 }
 
 bool decodeProgramFromPatchtokensBlob(ArrayRef<const uint8_t> programBlob, ProgramFromPatchtokens &out) {
@@ -197,6 +197,10 @@ bool decodeProgramFromPatchtokensBlob(ArrayRef<const uint8_t> programBlob, Progr
 uint32_t calcKernelChecksum(const ArrayRef<const uint8_t> kernelBlob);
 bool hasInvalidChecksum(const KernelFromPatchtokens &decodedKernel);
 
+// kernels are decoded, validated and converted to KernelInfos concurrently only in programs with many kernels
+constexpr size_t minKernelsPerDecodingThread = 32;
+size_t getKernelsDecodingThreadCount(size_t kernelsCount);
+
 inline const uint8_t *getInlineData(const SPatchAllocateConstantMemorySurfaceProgramBinaryInfo *ptr) {
     return ptrOffset(reinterpret_cast<const uint8_t *>(ptr), sizeof(SPatchAllocateConstantMemorySurfaceProgramBinaryInfo));
 }
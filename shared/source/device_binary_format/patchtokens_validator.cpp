@@ -9,6 +9,7 @@
 
 #include "shared/source/device_binary_format/patchtokens_decoder.h"
 #include "shared/source/helpers/hw_info.h"
+#include "shared/source/utilities/parallel_for.h"
 
 #include "opencl/source/program/kernel_arg_info.h"
 
@@ -22,6 +23,66 @@ namespace PatchTokenBinary {
 
 bool allowUnhandledTokens = true;
 
+DecodeError validateKernel(const KernelFromPatchtokens &decodedKernel,
+                           std::string &outErrReason, std::string &outWarnings) {
+    if (decodedKernel.decodeStatus != DecodeError::Success) {
+        outErrReason = "KernelFromPatchtokens wasn't successfully decoded";
+        return DecodeError::UnhandledBinary;
+    }
+
+    UNRECOVERABLE_IF(nullptr == decodedKernel.header);
+    if (hasInvalidChecksum(decodedKernel)) {
+        outErrReason = "KernelFromPatchtokens has invalid checksum";
+        return DecodeError::UnhandledBinary;
+    }
+
+    if (nullptr == decodedKernel.tokens.executionEnvironment) {
+        outErrReason = "Missing execution environment";
+        return DecodeError::UnhandledBinary;
+    } else {
+        switch (decodedKernel.tokens.executionEnvironment->LargestCompiledSIMDSize) {
+        case 1:
+            break;
+        case 8:
+            break;
+        case 16:
+            break;
+        case 32:
+            break;
+        default:
+            outErrReason = "Invalid LargestCompiledSIMDSize";
+            return DecodeError::UnhandledBinary;
+        }
+    }
+
+    for (auto &kernelArg : decodedKernel.tokens.kernelArgs) {
+        if (kernelArg.argInfo == nullptr) {
+            continue;
+        }
+        auto argInfoInlineData = getInlineData(kernelArg.argInfo);
+        auto accessQualifier = KernelArgMetadata::parseAccessQualifier(parseLimitedString(argInfoInlineData.accessQualifier.begin(), argInfoInlineData.accessQualifier.size()));
+        if (KernelArgMetadata::AccessUnknown == accessQualifier) {
+            outErrReason = "Unhandled access qualifier";
+            return DecodeError::UnhandledBinary;
+        }
+        auto addressQualifier = KernelArgMetadata::parseAddressSpace(parseLimitedString(argInfoInlineData.addressQualifier.begin(), argInfoInlineData.addressQualifier.size()));
+        if (KernelArgMetadata::AddrUnknown == addressQualifier) {
+            outErrReason = "Unhandled address qualifier";
+            return DecodeError::UnhandledBinary;
+        }
+    }
+
+    for (const auto &unhandledToken : decodedKernel.unhandledTokens) {
+        if (allowUnhandledTokens) {
+            outWarnings = "Unknown kernel-scope Patch Token : " + std::to_string(unhandledToken->Token);
+        } else {
+            outErrReason = "Unhandled required kernel-scope Patch Token : " + std::to_string(unhandledToken->Token);
+            return DecodeError::UnhandledBinary;
+        }
+    }
+    return DecodeError::Success;
+}
+
 DecodeError validate(const ProgramFromPatchtokens &decodedProgram,
                      std::string &outErrReason, std::string &outWarnings) {
     if (decodedProgram.decodeStatus != DecodeError::Success) {
@@ -85,61 +146,34 @@ DecodeError validate(const ProgramFromPatchtokens &decodedProgram,
         return DecodeError::UnhandledBinary;
     }
 
-    for (const auto &decodedKernel : decodedProgram.kernels) {
-        if (decodedKernel.decodeStatus != DecodeError::Success) {
-            outErrReason = "KernelFromPatchtokens wasn't successfully decoded";
-            return DecodeError::UnhandledBinary;
-        }
-
-        UNRECOVERABLE_IF(nullptr == decodedKernel.header);
-        if (hasInvalidChecksum(decodedKernel)) {
-            outErrReason = "KernelFromPatchtokens has invalid checksum";
-            return DecodeError::UnhandledBinary;
-        }
-
-        if (nullptr == decodedKernel.tokens.executionEnvironment) {
-            outErrReason = "Missing execution environment";
-            return DecodeError::UnhandledBinary;
-        } else {
-            switch (decodedKernel.tokens.executionEnvironment->LargestCompiledSIMDSize) {
-            case 1:
-                break;
-            case 8:
-                break;
-            case 16:
-                break;
-            case 32:
-                break;
-            default:
-                outErrReason = "Invalid LargestCompiledSIMDSize";
-                return DecodeError::UnhandledBinary;
-            }
+    struct KernelValidationResult {
+        DecodeError status = DecodeError::Undefined;
+        std::string errReason;
+        std::string warnings;
+    };
+    StackVec<KernelValidationResult, 2> kernelsResults;
+    kernelsResults.resize(decodedProgram.kernels.size());
+    auto validateKernelAt = [&](size_t kernelNum) {
+        auto &result = kernelsResults[kernelNum];
+        result.status = validateKernel(decodedProgram.kernels[kernelNum], result.errReason, result.warnings);
+    };
+    auto threadCount = getKernelsDecodingThreadCount(decodedProgram.kernels.size());
+    if (threadCount > 1) {
+        parallelFor(decodedProgram.kernels.size(), threadCount, validateKernelAt);
+    } else {
+        for (size_t i = 0; i < decodedProgram.kernels.size(); i++) {
+            validateKernelAt(i);
         }
+    }
 
-        for (auto &kernelArg : decodedKernel.tokens.kernelArgs) {
-            if (kernelArg.argInfo == nullptr) {
-                continue;
-            }
-            auto argInfoInlineData = getInlineData(kernelArg.argInfo);
-            auto accessQualifier = KernelArgMetadata::parseAccessQualifier(parseLimitedString(argInfoInlineData.accessQualifier.begin(), argInfoInlineData.accessQualifier.size()));
-            if (KernelArgMetadata::AccessUnknown == accessQualifier) {
-                outErrReason = "Unhandled access qualifier";
-                return DecodeError::UnhandledBinary;
-            }
-            auto addressQualifier = KernelArgMetadata::parseAddressSpace(parseLimitedString(argInfoInlineData.addressQualifier.begin(), argInfoInlineData.addressQualifier.size()));
-            if (KernelArgMetadata::AddrUnknown == addressQualifier) {
-                outErrReason = "Unhandled address qualifier";
-                return DecodeError::UnhandledBinary;
-            }
+    // results are merged in kernels order, so reported error and warnings do not depend on threads count
+    for (auto &result : kernelsResults) {
+        if (false == result.warnings.empty()) {
+            outWarnings = std::move(result.warnings);
         }
-
-        for (const auto &unhandledToken : decodedKernel.unhandledTokens) {
-            if (allowUnhandledTokens) {
-                outWarnings = "Unknown kernel-scope Patch Token : " + std::to_string(unhandledToken->Token);
-            } else {
-                outErrReason = "Unhandled required kernel-scope Patch Token : " + std::to_string(unhandledToken->Token);
-                return DecodeError::UnhandledBinary;
-            }
+        if (result.status != DecodeError::Success) {
+            outErrReason = std::move(result.errReason);
+            return result.status;
         }
     }
 
@@ -17,6 +17,10 @@ namespace PatchTokenBinary {
 extern bool allowUnhandledTokens;
 
 struct ProgramFromPatchtokens;
+struct KernelFromPatchtokens;
+
+DecodeError validateKernel(const KernelFromPatchtokens &decodedKernel,
+                           std::string &outErrReason, std::string &outWarnings);
 
 DecodeError validate(const ProgramFromPatchtokens &decodedProgram,
                      std::string &outErrReason, std::string &outWarnings);
@@ -278,6 +278,11 @@ bool DirectSubmissionHw<GfxFamily>::dispatchCommandBuffer(BatchBuffer &batchBuff
     size_t cycleSize = getSizeSwitchRingBufferSection();
     size_t requiredMinimalSize = dispatchSize + cycleSize + getSizeEnd();
 
+    // buffers have to be resident before GPU is unblocked, nothing is dispatched to the ring when it fails
+    if (ringStart && !handleResidency()) {
+        return false;
+    }
+
     TagData currentTagData;
     bool buffersSwitched = false;
     uint64_t startGpuVa = getCommandBufferPositionGpuAddress(ringCommandStream.getSpace(0));
@@ -301,7 +306,6 @@ bool DirectSubmissionHw<GfxFamily>::dispatchCommandBuffer(BatchBuffer &batchBuff
 
     if (ringStart) {
         cpuCachelineFlush(currentPosition, dispatchSize);
-        handleResidency();
     }
 
     //unblock GPU
@@ -7,11 +7,17 @@
 
 #pragma once
 #include "shared/source/direct_submission/direct_submission_hw.h"
+#include "shared/source/memory_manager/memory_constants.h"
+
+#include "drm/i915_drm.h"
+
+#include <atomic>
+#include <vector>
 
 namespace NEO {
 
-class OsContextWin;
-class Wddm;
+class BufferObject;
+class OsContextLinux;
 
 template <typename GfxFamily>
 class DrmDirectSubmission : public DirectSubmissionHw<GfxFamily> {
@@ -23,6 +29,20 @@ class DrmDirectSubmission : public DirectSubmissionHw<GfxFamily> {
                         std::unique_ptr<Dispatcher> cmdDispatcher,
                         OsContext &osContext);
 
+    ~DrmDirectSubmission();
+
+    void makeResident(BufferObject *const bufferObjects[], size_t count);
+    // Returns false when the ring batch ended without writing the tag, e.g. after GPU hang
+    bool waitForTagValue(uint64_t tagValue);
+    // Stops the ring, so that BOs bound by it in given session can be closed, next dispatch starts it again
+    void releaseResidency(uint64_t session);
+    uint64_t peekRingSession() const { return ringSession; }
+
+    static constexpr size_t tagOffset = MemoryConstants::cacheLineSize;
+    static constexpr size_t residencyBatchOffset = 2 * MemoryConstants::cacheLineSize;
+    static constexpr uint32_t tagWaitSpinCount = 4096u;
+    static constexpr int64_t tagWaitTimeoutNs = 100000;
+
   protected:
     bool allocateOsResources(DirectSubmissionAllocations &allocations) override;
     bool submit(uint64_t gpuAddress, size_t size) override;
@@ -31,5 +51,19 @@ class DrmDirectSubmission : public DirectSubmissionHw<GfxFamily> {
     uint64_t switchRingBuffers() override;
     uint64_t updateTagValue() override;
     void getTagAddressValue(TagData &tagData) override;
+
+    BufferObject *getRingBufferObject() const;
+    void addPendingResidency(std::vector<BufferObject *> &execList, uint64_t session);
+
+    OsContextLinux *osContextLinux;
+
+    std::vector<BufferObject *> pendingResidency;
+    std::vector<drm_i915_gem_exec_object2> execObjectsStorage;
+    BufferObject *submittedBatchBuffer = nullptr;
+    std::atomic<uint64_t> ringSession{0u};
+
+    volatile uint64_t *tagAddress = nullptr;
+    uint64_t currentTagValue = 1u;
+    uint64_t lastSubmittedTagValue = 0u;
 };
 } // namespace NEO
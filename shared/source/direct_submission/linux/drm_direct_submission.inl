@@ -6,46 +6,251 @@
  */
 
 #include "shared/source/command_stream/linear_stream.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/direct_submission/linux/drm_direct_submission.h"
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/os_interface/linux/drm_allocation.h"
+#include "shared/source/os_interface/linux/drm_buffer_object.h"
+#include "shared/source/os_interface/linux/drm_neo.h"
+#include "shared/source/os_interface/linux/os_context_linux.h"
+#include "shared/source/utilities/cpuintrinsics.h"
+
+#include <algorithm>
+#include <errno.h>
 
 namespace NEO {
 
+template <typename GfxFamily>
+constexpr size_t DrmDirectSubmission<GfxFamily>::tagOffset;
+
+template <typename GfxFamily>
+constexpr size_t DrmDirectSubmission<GfxFamily>::residencyBatchOffset;
+
+template <typename GfxFamily>
+constexpr uint32_t DrmDirectSubmission<GfxFamily>::tagWaitSpinCount;
+
+template <typename GfxFamily>
+constexpr int64_t DrmDirectSubmission<GfxFamily>::tagWaitTimeoutNs;
+
 template <typename GfxFamily>
 DrmDirectSubmission<GfxFamily>::DrmDirectSubmission(Device &device,
                                                     std::unique_ptr<Dispatcher> cmdDispatcher,
                                                     OsContext &osContext)
     : DirectSubmissionHw<GfxFamily>(device, std::move(cmdDispatcher), osContext) {
+    osContextLinux = static_cast<OsContextLinux *>(&osContext);
+}
+
+template <typename GfxFamily>
+DrmDirectSubmission<GfxFamily>::~DrmDirectSubmission() {
+    if (this->ringStart) {
+        this->stopRingBuffer();
+        submittedBatchBuffer->wait(-1);
+    }
+    this->deallocateResources();
 }
 
 template <typename GfxFamily>
 bool DrmDirectSubmission<GfxFamily>::allocateOsResources(DirectSubmissionAllocations &allocations) {
-    return false;
+    for (auto &allocation : allocations) {
+        if (static_cast<DrmAllocation *>(allocation)->getBO() == nullptr) {
+            return false;
+        }
+    }
+
+    tagAddress = static_cast<volatile uint64_t *>(ptrOffset(this->semaphorePtr, tagOffset));
+    *tagAddress = 0u;
+
+    // Batch used to bind newly resident BOs while the ring is running
+    auto residencyBatch = static_cast<typename GfxFamily::MI_BATCH_BUFFER_END *>(ptrOffset(this->semaphorePtr, residencyBatchOffset));
+    *residencyBatch = GfxFamily::cmdInitBatchBufferEnd;
+
+    this->cpuCachelineFlush(ptrOffset(this->semaphorePtr, tagOffset), residencyBatchOffset);
+
+    return true;
+}
+
+template <typename GfxFamily>
+BufferObject *DrmDirectSubmission<GfxFamily>::getRingBufferObject() const {
+    return static_cast<DrmAllocation *>(ringCommandStream.getGraphicsAllocation())->getBO();
+}
+
+template <typename GfxFamily>
+void DrmDirectSubmission<GfxFamily>::makeResident(BufferObject *const bufferObjects[], size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        if (bufferObjects[i] != nullptr) {
+            pendingResidency.push_back(bufferObjects[i]);
+        }
+    }
+}
+
+template <typename GfxFamily>
+void DrmDirectSubmission<GfxFamily>::addPendingResidency(std::vector<BufferObject *> &execList, uint64_t session) {
+    for (auto bo : pendingResidency) {
+        if (bo->peekDirectSubmissionSession() != session &&
+            std::find(execList.begin(), execList.end(), bo) == execList.end()) {
+            execList.push_back(bo);
+        }
+    }
+    pendingResidency.clear();
 }
 
 template <typename GfxFamily>
 bool DrmDirectSubmission<GfxFamily>::submit(uint64_t gpuAddress, size_t size) {
-    return false;
+    auto batchBuffer = getRingBufferObject();
+    auto session = BufferObject::acquireDirectSubmissionSession();
+
+    std::vector<BufferObject *> execList;
+    for (auto allocation : {this->ringBuffer, this->ringBuffer2, this->semaphores}) {
+        auto bo = static_cast<DrmAllocation *>(allocation)->getBO();
+        if (bo != batchBuffer) {
+            execList.push_back(bo);
+        }
+    }
+    addPendingResidency(execList, session);
+
+    if (execList.size() + 1 > execObjectsStorage.size()) {
+        execObjectsStorage.resize(execList.size() + 1);
+    }
+
+    auto startOffset = static_cast<size_t>(gpuAddress - ringCommandStream.getGraphicsAllocation()->getGpuAddress());
+    auto drmContextId = osContextLinux->getDrmContextIds()[0];
+
+    int ret = batchBuffer->exec(static_cast<uint32_t>(size), startOffset,
+                                osContextLinux->getEngineFlag() | I915_EXEC_NO_RELOC,
+                                false, drmContextId,
+                                execList.data(), execList.size(),
+                                execObjectsStorage.data());
+    if (ret != 0) {
+        return false;
+    }
+
+    // BOs used by the ring batch stay bound until the ring batch retires
+    for (auto bo : execList) {
+        bo->setDirectSubmissionSession(session);
+    }
+    batchBuffer->setDirectSubmissionSession(session);
+    ringSession = session;
+    submittedBatchBuffer = batchBuffer;
+
+    return true;
 }
 
 template <typename GfxFamily>
 bool DrmDirectSubmission<GfxFamily>::handleResidency() {
-    return false;
+    if (pendingResidency.empty() || !this->ringStart) {
+        return true;
+    }
+
+    std::vector<BufferObject *> execList;
+    addPendingResidency(execList, ringSession);
+    if (execList.empty()) {
+        return true;
+    }
+
+    if (execList.size() + 1 > execObjectsStorage.size()) {
+        execObjectsStorage.resize(execList.size() + 1);
+    }
+
+    // Kernel binds the BOs while handling the exec and keeps them bound until the request retires.
+    // The request is queued behind the running ring, so it retires only after the ring is stopped.
+    auto semaphoreBo = static_cast<DrmAllocation *>(this->semaphores)->getBO();
+    int ret = semaphoreBo->exec(static_cast<uint32_t>(sizeof(typename GfxFamily::MI_BATCH_BUFFER_END)), residencyBatchOffset,
+                                osContextLinux->getEngineFlag() | I915_EXEC_NO_RELOC,
+                                false, osContextLinux->getDrmContextIds()[0],
+                                execList.data(), execList.size(),
+                                execObjectsStorage.data());
+    if (ret != 0) {
+        return false;
+    }
+
+    for (auto bo : execList) {
+        bo->setDirectSubmissionSession(ringSession);
+    }
+    return true;
+}
+
+template <typename GfxFamily>
+bool DrmDirectSubmission<GfxFamily>::waitForTagValue(uint64_t tagValue) {
+    for (uint32_t spin = 0; spin < tagWaitSpinCount; spin++) {
+        if (*tagAddress >= tagValue) {
+            return true;
+        }
+        CpuIntrinsics::pause();
+    }
+    if (submittedBatchBuffer == nullptr) {
+        return *tagAddress >= tagValue;
+    }
+
+    // Ring batch never retires while the ring is running, GEM_WAIT on it sleeps until timeout.
+    // It retires earlier only when the ring was ended, by stop or by reset after GPU hang.
+    auto &drm = osContextLinux->getDrm();
+    while (*tagAddress < tagValue) {
+        drm_i915_gem_wait wait = {};
+        wait.bo_handle = submittedBatchBuffer->peekHandle();
+        wait.timeout_ns = tagWaitTimeoutNs;
+
+        int ret = drm.ioctl(DRM_IOCTL_I915_GEM_WAIT, &wait);
+        if (ret == 0 || drm.getErrno() != ETIME) {
+            if (*tagAddress >= tagValue) {
+                return true;
+            }
+            printDebugString(DebugManager.flags.PrintDebugMessages.get(), stderr,
+                             "Direct submission ring ended before tag %llu was written, GPU hang detected\n",
+                             static_cast<unsigned long long>(tagValue));
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename GfxFamily>
+void DrmDirectSubmission<GfxFamily>::releaseResidency(uint64_t session) {
+    if (!this->ringStart || session != ringSession) {
+        return;
+    }
+
+    // Ring request and residency requests queued behind it retire once the ring batch ends,
+    // BOs are bound again by the new ring request only when they are used after restart
+    this->stopRingBuffer();
+    submittedBatchBuffer->wait(-1);
+    this->ringStart = false;
+    ringSession = 0u;
 }
 
 template <typename GfxFamily>
 uint64_t DrmDirectSubmission<GfxFamily>::switchRingBuffers() {
-    return 0ull;
+    GraphicsAllocation *nextRingBuffer = switchRingBuffersAllocations();
+    void *flushPtr = ringCommandStream.getSpace(0);
+    uint64_t currentBufferGpuVa = this->getCommandBufferPositionGpuAddress(flushPtr);
+
+    // stopped ring is restarted from current position, so it needs the switch section too
+    this->dispatchSwitchRingBufferSection(nextRingBuffer->getGpuAddress());
+    this->cpuCachelineFlush(flushPtr, this->getSizeSwitchRingBufferSection());
+
+    ringCommandStream.replaceBuffer(nextRingBuffer->getUnderlyingBuffer(), ringCommandStream.getMaxAvailableSpace());
+    ringCommandStream.replaceGraphicsAllocation(nextRingBuffer);
+
+    if (this->ringStart) {
+        if (this->completionRingBuffers[this->currentRingBuffer] != 0) {
+            waitForTagValue(this->completionRingBuffers[this->currentRingBuffer]);
+        }
+    }
+
+    return currentBufferGpuVa;
 }
 
 template <typename GfxFamily>
 uint64_t DrmDirectSubmission<GfxFamily>::updateTagValue() {
-    return 0ull;
+    lastSubmittedTagValue = currentTagValue;
+    currentTagValue++;
+    this->completionRingBuffers[this->currentRingBuffer] = lastSubmittedTagValue;
+
+    return lastSubmittedTagValue;
 }
 
 template <typename GfxFamily>
 void DrmDirectSubmission<GfxFamily>::getTagAddressValue(TagData &tagData) {
-    tagData.tagAddress = 0ull;
-    tagData.tagValue = 0ull;
+    tagData.tagAddress = this->semaphoreGpuVa + tagOffset;
+    tagData.tagValue = currentTagValue;
 }
 } // namespace NEO
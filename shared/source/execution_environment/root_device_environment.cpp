@@ -8,6 +8,7 @@
 #include "shared/source/execution_environment/root_device_environment.h"
 
 #include "shared/source/built_ins/built_ins.h"
+#include "shared/source/command_stream/scratch_space_registry.h"
 #include "shared/source/compiler_interface/compiler_interface.h"
 #include "shared/source/compiler_interface/default_cache_config.h"
 #include "shared/source/execution_environment/execution_environment.h"
@@ -23,6 +24,7 @@ namespace NEO {
 
 RootDeviceEnvironment::RootDeviceEnvironment(ExecutionEnvironment &executionEnvironment) : executionEnvironment(executionEnvironment) {
     hwInfo = std::make_unique<HardwareInfo>();
+    scratchSpaceRegistry = std::make_unique<ScratchSpaceRegistry>();
 }
 
 RootDeviceEnvironment::~RootDeviceEnvironment() = default;
@@ -24,6 +24,7 @@ class ExecutionEnvironment;
 class GmmPageTableMngr;
 class MemoryOperationsHandler;
 class OSInterface;
+class ScratchSpaceRegistry;
 struct HardwareInfo;
 class HwDeviceId;
 
@@ -54,6 +55,7 @@ struct RootDeviceEnvironment {
     std::unique_ptr<GmmPageTableMngr> pageTableManager;
     std::unique_ptr<MemoryOperationsHandler> memoryOperationsInterface;
     std::unique_ptr<AubCenter> aubCenter;
+    std::unique_ptr<ScratchSpaceRegistry> scratchSpaceRegistry;
 
     std::unique_ptr<BuiltIns> builtins;
     std::unique_ptr<CompilerInterface> compilerInterface;
@@ -51,7 +51,7 @@ GraphicsAllocation *FlatBatchBufferHelperHw<GfxFamily>::flattenBatchBuffer(uint3
             sizeBatchBuffer = flatBatchBufferProperties.size;
             patchInfoCollection.insert(std::end(patchInfoCollection), std::begin(indirectPatchInfo), std::end(indirectPatchInfo));
         }
-    } else if (dispatchMode == DispatchMode::BatchedDispatch) {
+    } else if (dispatchMode == DispatchMode::BatchedDispatch || dispatchMode == DispatchMode::BatchedDispatchWithCounter) {
         CommandChunk firstChunk;
         for (auto &chunk : commandChunkList) {
             bool found = false;
@@ -9,10 +9,22 @@
 
 #include "shared/source/debug_settings/debug_settings_manager.h"
 
+#include <algorithm>
 #include <cstdint>
 
 using namespace NEO;
 
+KmdNotifyHelper::~KmdNotifyHelper() {
+    if (isAdaptiveWaitEnabled()) {
+        auto statistics = getWaitStatistics();
+        printDebugString(DebugManager.flags.PrintDebugMessages.get(), stdout,
+                         "Adaptive wait: waits %llu, completed during spin %llu, after sleep %llu, spin decisions %llu, sleep decisions %llu, average latency %lld us\n",
+                         static_cast<unsigned long long>(statistics.waitsCount), static_cast<unsigned long long>(statistics.completedDuringSpin),
+                         static_cast<unsigned long long>(statistics.completedAfterSleep), static_cast<unsigned long long>(statistics.adaptiveSpinDecisions),
+                         static_cast<unsigned long long>(statistics.adaptiveSleepDecisions), static_cast<long long>(statistics.averageWaitLatencyUs));
+    }
+}
+
 bool KmdNotifyHelper::obtainTimeoutParams(int64_t &timeoutValueOutput,
                                           bool quickKmdSleepRequest,
                                           uint32_t currentHwTag,
@@ -43,6 +55,10 @@ bool KmdNotifyHelper::obtainTimeoutParams(int64_t &timeoutValueOutput,
         timeoutValueOutput = getBaseTimeout(multiplier);
     }
 
+    if (properties->enableKmdNotify && acLineConnected && isAdaptiveWaitEnabled()) {
+        applyAdaptiveTimeout(timeoutValueOutput);
+    }
+
     return (properties->enableKmdNotify || !acLineConnected);
 }
 
@@ -56,6 +72,50 @@ bool KmdNotifyHelper::applyQuickKmdSleepForSporadicWait() const {
     return false;
 }
 
+void KmdNotifyHelper::applyAdaptiveTimeout(int64_t &timeoutValueOutput) {
+    if (waitsCount < KmdNotifyConstants::adaptiveWaitMinimumSamples) {
+        return;
+    }
+
+    auto expectedLatency = averageWaitLatencyUs.load();
+    if (expectedLatency > timeoutValueOutput) {
+        // completion is not expected within the spin period, go to KMD sleep right away
+        timeoutValueOutput = 0;
+        adaptiveSleepDecisions++;
+    } else {
+        timeoutValueOutput = std::min(timeoutValueOutput, std::max(static_cast<int64_t>(1), expectedLatency * KmdNotifyConstants::adaptiveWaitSpinMultiplier));
+        adaptiveSpinDecisions++;
+    }
+}
+
+void KmdNotifyHelper::updateWaitStatistics(int64_t waitStartTimestampUs, bool completedDuringSpin) {
+    auto latency = std::max(static_cast<int64_t>(0), getMicrosecondsSinceEpoch() - waitStartTimestampUs);
+    if (waitsCount++ == 0) {
+        averageWaitLatencyUs = latency;
+    } else {
+        auto average = averageWaitLatencyUs.load();
+        averageWaitLatencyUs = average + ((latency - average) >> KmdNotifyConstants::adaptiveWaitLatencyWeightShift);
+    }
+    if (completedDuringSpin) {
+        this->completedDuringSpin++;
+    }
+}
+
+KmdNotifyWaitStatistics KmdNotifyHelper::getWaitStatistics() const {
+    KmdNotifyWaitStatistics statistics;
+    statistics.waitsCount = waitsCount;
+    statistics.completedDuringSpin = completedDuringSpin;
+    statistics.completedAfterSleep = statistics.waitsCount - statistics.completedDuringSpin;
+    statistics.adaptiveSpinDecisions = adaptiveSpinDecisions;
+    statistics.adaptiveSleepDecisions = adaptiveSleepDecisions;
+    statistics.averageWaitLatencyUs = averageWaitLatencyUs;
+    return statistics;
+}
+
+bool KmdNotifyHelper::isAdaptiveWaitEnabled() {
+    return DebugManager.flags.EnableAdaptiveKmdNotifyWait.get() == 1;
+}
+
 void KmdNotifyHelper::updateLastWaitForCompletionTimestamp() {
     lastWaitForCompletionTimestampUs = getMicrosecondsSinceEpoch();
 }
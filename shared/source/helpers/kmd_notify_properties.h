@@ -28,13 +28,25 @@ struct KmdNotifyProperties {
 namespace KmdNotifyConstants {
 constexpr int64_t timeoutInMicrosecondsForDisconnectedAcLine = 10000;
 constexpr uint32_t minimumTaskCountDiffToCheckAcLine = 10;
+constexpr uint32_t adaptiveWaitMinimumSamples = 4;
+constexpr int64_t adaptiveWaitSpinMultiplier = 2;
+constexpr int64_t adaptiveWaitLatencyWeightShift = 3;
 } // namespace KmdNotifyConstants
 
+struct KmdNotifyWaitStatistics {
+    uint64_t waitsCount = 0;
+    uint64_t completedDuringSpin = 0;
+    uint64_t completedAfterSleep = 0;
+    uint64_t adaptiveSpinDecisions = 0;
+    uint64_t adaptiveSleepDecisions = 0;
+    int64_t averageWaitLatencyUs = 0;
+};
+
 class KmdNotifyHelper {
   public:
     KmdNotifyHelper() = delete;
     KmdNotifyHelper(const KmdNotifyProperties *properties) : properties(properties){};
-    MOCKABLE_VIRTUAL ~KmdNotifyHelper() = default;
+    MOCKABLE_VIRTUAL ~KmdNotifyHelper();
 
     bool obtainTimeoutParams(int64_t &timeoutValueOutput,
                              bool quickKmdSleepRequest,
@@ -47,16 +59,29 @@ class KmdNotifyHelper {
     MOCKABLE_VIRTUAL void updateLastWaitForCompletionTimestamp();
     MOCKABLE_VIRTUAL void updateAcLineStatus();
 
+    // Records the latency of a wait that was not completed on entry. Once enough waits are recorded,
+    // the exponentially weighted average latency chooses between spinning and going straight to KMD sleep.
+    void updateWaitStatistics(int64_t waitStartTimestampUs, bool completedDuringSpin);
+    KmdNotifyWaitStatistics getWaitStatistics() const;
+    static bool isAdaptiveWaitEnabled();
+    int64_t getMicrosecondsSinceEpoch() const;
+
     static void overrideFromDebugVariable(int32_t debugVariableValue, int64_t &destination);
     static void overrideFromDebugVariable(int32_t debugVariableValue, bool &destination);
 
   protected:
     bool applyQuickKmdSleepForSporadicWait() const;
     int64_t getBaseTimeout(const int64_t &multiplier) const;
-    int64_t getMicrosecondsSinceEpoch() const;
+    void applyAdaptiveTimeout(int64_t &timeoutValueOutput);
 
     const KmdNotifyProperties *properties = nullptr;
     std::atomic<int64_t> lastWaitForCompletionTimestampUs{0};
     std::atomic<bool> acLineConnected{true};
+
+    std::atomic<int64_t> averageWaitLatencyUs{0};
+    std::atomic<uint64_t> waitsCount{0};
+    std::atomic<uint64_t> completedDuringSpin{0};
+    std::atomic<uint64_t> adaptiveSpinDecisions{0};
+    std::atomic<uint64_t> adaptiveSleepDecisions{0};
 };
 } // namespace NEO
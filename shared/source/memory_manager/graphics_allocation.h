@@ -146,6 +146,13 @@ class GraphicsAllocation : public IDNode<GraphicsAllocation> {
     bool isAubWritable(uint32_t banks) const;
     void setTbxWritable(bool writable, uint32_t banks);
     bool isTbxWritable(uint32_t banks) const;
+
+    struct PageHashes {
+        std::vector<uint64_t> hashes;
+        uint64_t streamId = 0u;
+    };
+    PageHashes &getAubPageHashes() { return aubInfo.aubPageHashes; }
+    PageHashes &getTbxPageHashes() { return aubInfo.tbxPageHashes; }
     void setAllocDumpable(bool dumpable) { aubInfo.allocDumpable = dumpable; }
     bool isAllocDumpable() const { return aubInfo.allocDumpable; }
     bool isMemObjectsAllocationWithWritableFlags() const { return aubInfo.memObjectsAllocationWithWritableFlags; }
@@ -237,6 +244,8 @@ class GraphicsAllocation : public IDNode<GraphicsAllocation> {
         uint32_t tbxWritable = std::numeric_limits<uint32_t>::max();
         bool allocDumpable = false;
         bool memObjectsAllocationWithWritableFlags = false;
+        PageHashes aubPageHashes;
+        PageHashes tbxPageHashes;
     };
     struct SharingInfo {
         uint32_t reuseCount = 0;
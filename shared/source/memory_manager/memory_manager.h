@@ -74,6 +74,9 @@ class MemoryManager {
 
     virtual GraphicsAllocation *createGraphicsAllocationFromNTHandle(void *handle, uint32_t rootDeviceIndex) = 0;
 
+    // Maps CPU pages of host allocation owned by another root device at GPU address equal to their CPU address, host ptr manager is not involved
+    virtual GraphicsAllocation *createGraphicsAllocationFromHostPtrMapping(const AllocationProperties &properties, void *hostPtr) { return nullptr; }
+
     virtual bool mapAuxGpuVA(GraphicsAllocation *graphicsAllocation);
 
     void *lockResource(GraphicsAllocation *graphicsAllocation);
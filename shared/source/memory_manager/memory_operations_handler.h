@@ -7,8 +7,11 @@
 
 #pragma once
 #include "shared/source/memory_manager/memory_operations_status.h"
+#include "shared/source/memory_manager/residency_container.h"
 #include "shared/source/utilities/arrayref.h"
 
+#include <mutex>
+
 namespace NEO {
 
 class GraphicsAllocation;
@@ -21,5 +24,11 @@ class MemoryOperationsHandler {
     virtual MemoryOperationsStatus makeResident(ArrayRef<GraphicsAllocation *> gfxAllocations) = 0;
     virtual MemoryOperationsStatus evict(GraphicsAllocation &gfxAllocation) = 0;
     virtual MemoryOperationsStatus isResident(GraphicsAllocation &gfxAllocation) = 0;
+
+    // Appends explicitly resident allocations missing in submission residency, used where OS has no persistent residency.
+    // Returned lock keeps them from being evicted and freed, it has to be held until they are submitted.
+    virtual std::unique_lock<std::mutex> mergeWithResidencyContainer(const ResidencyContainer &allocationsForResidency, ResidencyContainer &residentAllocations) {
+        return std::unique_lock<std::mutex>();
+    }
 };
 } // namespace NEO
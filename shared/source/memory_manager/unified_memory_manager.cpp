@@ -15,6 +15,16 @@
 
 namespace NEO {
 
+GraphicsAllocation *SvmAllocationData::getGraphicsAllocation(uint32_t rootDeviceIndex) const {
+    if (gpuAllocation->getRootDeviceIndex() == rootDeviceIndex) {
+        return gpuAllocation;
+    }
+    if (rootDeviceIndex < rootDeviceAllocations.size()) {
+        return rootDeviceAllocations[rootDeviceIndex];
+    }
+    return nullptr;
+}
+
 void SVMAllocsManager::MapBasedAllocationTracker::insert(SvmAllocationData allocationsPair) {
     allocations.insert(std::make_pair(reinterpret_cast<void *>(allocationsPair.gpuAllocation->getGpuAddress()), allocationsPair));
 }
@@ -70,10 +80,31 @@ SvmMapOperation *SVMAllocsManager::MapOperationsTracker::get(const void *regionP
 }
 
 void SVMAllocsManager::makeInternalAllocationsResident(CommandStreamReceiver &commandStreamReceiver, uint32_t requestedTypesMask) {
-    std::unique_lock<SpinLock> lock(mtx);
-    for (auto &allocation : this->SVMAllocs.allocations) {
-        if (allocation.second.memoryType & requestedTypesMask) {
-            commandStreamReceiver.makeResident(*allocation.second.gpuAllocation);
+    auto rootDeviceIndex = commandStreamReceiver.getRootDeviceIndex();
+    std::vector<const void *> unmappedAllocations;
+    {
+        std::unique_lock<SpinLock> lock(mtx);
+        for (auto &allocation : this->SVMAllocs.allocations) {
+            if (allocation.second.memoryType & requestedTypesMask) {
+                auto graphicsAllocation = allocation.second.getGraphicsAllocation(rootDeviceIndex);
+                if (graphicsAllocation == nullptr && !isMappedAcrossRootDevices(*allocation.second.gpuAllocation)) {
+                    graphicsAllocation = allocation.second.gpuAllocation;
+                }
+                if (graphicsAllocation) {
+                    commandStreamReceiver.makeResident(*graphicsAllocation);
+                } else {
+                    unmappedAllocations.push_back(allocation.first);
+                }
+            }
+        }
+    }
+    for (auto ptr : unmappedAllocations) {
+        auto svmData = getSVMAlloc(ptr);
+        if (svmData) {
+            auto graphicsAllocation = obtainGraphicsAllocation(*svmData, rootDeviceIndex);
+            if (graphicsAllocation) {
+                commandStreamReceiver.makeResident(*graphicsAllocation);
+            }
         }
     }
 }
@@ -170,12 +201,18 @@ bool SVMAllocsManager::freeSVMAlloc(void *ptr, bool blocking) {
                 this->memoryManager->waitForEnginesCompletion(*svmData->cpuAllocation);
             }
             this->memoryManager->waitForEnginesCompletion(*svmData->gpuAllocation);
+            for (auto rootDeviceAllocation : svmData->rootDeviceAllocations) {
+                if (rootDeviceAllocation) {
+                    this->memoryManager->waitForEnginesCompletion(*rootDeviceAllocation);
+                }
+            }
         }
 
         auto pageFaultManager = this->memoryManager->getPageFaultManager();
         if (pageFaultManager) {
             pageFaultManager->removeAllocation(ptr);
         }
+        freeRootDeviceAllocations(*svmData);
         std::unique_lock<SpinLock> lock(mtx);
         if (svmData->gpuAllocation->getAllocationType() == GraphicsAllocation::AllocationType::SVM_ZERO_COPY) {
             freeZeroCopySvmAllocation(svmData);
@@ -262,6 +299,67 @@ void SVMAllocsManager::freeSvmAllocationWithDeviceStorage(SvmAllocationData *svm
     memoryManager->freeGraphicsMemory(cpuAllocation);
 }
 
+GraphicsAllocation *SVMAllocsManager::obtainGraphicsAllocation(SvmAllocationData &svmData, uint32_t rootDeviceIndex) {
+    GraphicsAllocation *primaryAllocation = nullptr;
+    {
+        std::unique_lock<SpinLock> lock(mtx);
+        auto graphicsAllocation = svmData.getGraphicsAllocation(rootDeviceIndex);
+        if (graphicsAllocation) {
+            return graphicsAllocation;
+        }
+        primaryAllocation = svmData.gpuAllocation;
+    }
+    if (!isMappedAcrossRootDevices(*primaryAllocation)) {
+        return primaryAllocation;
+    }
+
+    // mapping issues ioctls, it is created without holding the lock
+    AllocationProperties properties{rootDeviceIndex, false, primaryAllocation->getUnderlyingBufferSize(), primaryAllocation->getAllocationType(), false};
+    auto graphicsAllocation = memoryManager->createGraphicsAllocationFromHostPtrMapping(properties, primaryAllocation->getUnderlyingBuffer());
+    if (graphicsAllocation && graphicsAllocation->getGpuAddress() != primaryAllocation->getGpuAddress()) {
+        // pointer is passed to kernels as is, every root device has to map CPU backing store at the same GPU address
+        memoryManager->freeGraphicsMemory(graphicsAllocation);
+        graphicsAllocation = nullptr;
+    }
+    if (!graphicsAllocation) {
+        return nullptr;
+    }
+    graphicsAllocation->setMemObjectsAllocationWithWritableFlags(primaryAllocation->isMemObjectsAllocationWithWritableFlags());
+    graphicsAllocation->setCoherent(primaryAllocation->isCoherent());
+
+    GraphicsAllocation *concurrentAllocation = nullptr;
+    {
+        std::unique_lock<SpinLock> lock(mtx);
+        concurrentAllocation = svmData.getGraphicsAllocation(rootDeviceIndex);
+        if (concurrentAllocation == nullptr) {
+            if (svmData.rootDeviceAllocations.size() <= rootDeviceIndex) {
+                svmData.rootDeviceAllocations.resize(rootDeviceIndex + 1, nullptr);
+            }
+            svmData.rootDeviceAllocations[rootDeviceIndex] = graphicsAllocation;
+            return graphicsAllocation;
+        }
+    }
+    memoryManager->freeGraphicsMemory(graphicsAllocation);
+    return concurrentAllocation;
+}
+
+bool SVMAllocsManager::isMappedAcrossRootDevices(const GraphicsAllocation &primaryAllocation) {
+    auto allocationType = primaryAllocation.getAllocationType();
+    return allocationType == GraphicsAllocation::AllocationType::BUFFER_HOST_MEMORY ||
+           allocationType == GraphicsAllocation::AllocationType::SVM_ZERO_COPY;
+}
+
+void SVMAllocsManager::freeRootDeviceAllocations(SvmAllocationData &svmData) {
+    std::vector<GraphicsAllocation *> rootDeviceAllocations;
+    {
+        std::unique_lock<SpinLock> lock(mtx);
+        rootDeviceAllocations.swap(svmData.rootDeviceAllocations);
+    }
+    for (auto rootDeviceAllocation : rootDeviceAllocations) {
+        memoryManager->freeGraphicsMemory(rootDeviceAllocation);
+    }
+}
+
 SvmMapOperation *SVMAllocsManager::getSvmMapOperation(const void *ptr) {
     std::unique_lock<SpinLock> lock(mtx);
     return svmMapOperations.get(ptr);
@@ -15,6 +15,7 @@
 #include <cstdint>
 #include <map>
 #include <mutex>
+#include <vector>
 
 namespace NEO {
 class CommandStreamReceiver;
@@ -22,8 +23,12 @@ class GraphicsAllocation;
 class MemoryManager;
 
 struct SvmAllocationData {
+    GraphicsAllocation *getGraphicsAllocation(uint32_t rootDeviceIndex) const;
+
     GraphicsAllocation *cpuAllocation = nullptr;
     GraphicsAllocation *gpuAllocation = nullptr;
+    // Allocations of other root devices mapping CPU backing store of gpuAllocation, indexed by root device
+    std::vector<GraphicsAllocation *> rootDeviceAllocations;
     size_t size = 0;
     InternalMemoryType memoryType = InternalMemoryType::SVM;
     MemoryPropertiesFlags allocationFlagsProperty;
@@ -96,9 +101,13 @@ class SVMAllocsManager {
     void makeInternalAllocationsResident(CommandStreamReceiver &commandStreamReceiver, uint32_t requestedTypesMask);
     void *createUnifiedAllocationWithDeviceStorage(uint32_t rootDeviceIndex, size_t size, const SvmAllocationProperties &svmProperties, const UnifiedMemoryProperties &unifiedMemoryProperties);
     void freeSvmAllocationWithDeviceStorage(SvmAllocationData *svmData);
+    // Host and zero copy SVM allocations are mapped to other root devices on first use, other allocations are returned as is
+    GraphicsAllocation *obtainGraphicsAllocation(SvmAllocationData &svmData, uint32_t rootDeviceIndex);
 
   protected:
     void *createZeroCopySvmAllocation(uint32_t rootDeviceIndex, size_t size, const SvmAllocationProperties &svmProperties);
+    static bool isMappedAcrossRootDevices(const GraphicsAllocation &primaryAllocation);
+    void freeRootDeviceAllocations(SvmAllocationData &svmData);
 
     void freeZeroCopySvmAllocation(SvmAllocationData *svmData);
 
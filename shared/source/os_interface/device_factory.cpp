@@ -15,11 +15,14 @@
 #include "shared/source/os_interface/aub_memory_operations_handler.h"
 #include "shared/source/os_interface/hw_info_config.h"
 #include "shared/source/os_interface/os_interface.h"
+#include "shared/source/utilities/parallel_for.h"
 
 #include "opencl/source/aub/aub_center.h"
 
 #include "hw_device_id.h"
 
+#include <algorithm>
+
 namespace NEO {
 
 bool DeviceFactory::getDevicesForProductFamilyOverride(size_t &numDevices, ExecutionEnvironment &executionEnvironment) {
@@ -96,10 +99,13 @@ bool DeviceFactory::getDevices(size_t &totalNumRootDevices, ExecutionEnvironment
 
     executionEnvironment.prepareRootDeviceEnvironments(static_cast<uint32_t>(totalNumRootDevices));
 
-    uint32_t rootDeviceIndex = 0u;
+    std::vector<uint8_t> osInterfaceInitialized(totalNumRootDevices, 0u);
+    parallelFor(totalNumRootDevices, getRootDeviceInitializationThreadCount(totalNumRootDevices), [&](size_t rootDeviceIndex) {
+        osInterfaceInitialized[rootDeviceIndex] = executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->initOsInterface(std::move(hwDeviceIds[rootDeviceIndex]));
+    });
 
-    for (auto &hwDeviceId : hwDeviceIds) {
-        if (!executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->initOsInterface(std::move(hwDeviceId))) {
+    for (uint32_t rootDeviceIndex = 0u; rootDeviceIndex < totalNumRootDevices; rootDeviceIndex++) {
+        if (!osInterfaceInitialized[rootDeviceIndex]) {
             return false;
         }
 
@@ -107,8 +113,6 @@ bool DeviceFactory::getDevices(size_t &totalNumRootDevices, ExecutionEnvironment
             executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->getMutableHardwareInfo()->capabilityTable.gpuAddressSpace =
                 maxNBitValue(static_cast<uint64_t>(DebugManager.flags.OverrideGpuAddressSpace.get()));
         }
-
-        rootDeviceIndex++;
     }
 
     executionEnvironment.calculateMaxOsContextCount();
@@ -124,6 +128,7 @@ std::vector<std::unique_ptr<Device>> DeviceFactory::createDevices(ExecutionEnvir
         return devices;
     }
     executionEnvironment.initializeMemoryManager();
+    // engines of all root devices are registered in shared memory manager, devices are created sequentially
     for (uint32_t rootDeviceIndex = 0u; rootDeviceIndex < executionEnvironment.rootDeviceEnvironments.size(); rootDeviceIndex++) {
         auto device = createRootDeviceFunc(executionEnvironment, rootDeviceIndex);
         if (device) {
@@ -133,6 +138,14 @@ std::vector<std::unique_ptr<Device>> DeviceFactory::createDevices(ExecutionEnvir
     return devices;
 }
 
+size_t DeviceFactory::getRootDeviceInitializationThreadCount(size_t numRootDevices) {
+    size_t maxThreads = 1u;
+    if (DebugManager.flags.ParallelRootDeviceInitialization.get() > 0) {
+        maxThreads = static_cast<size_t>(DebugManager.flags.ParallelRootDeviceInitialization.get());
+    }
+    return std::min(numRootDevices, maxThreads);
+}
+
 std::unique_ptr<Device> (*DeviceFactory::createRootDeviceFunc)(ExecutionEnvironment &, uint32_t) = [](ExecutionEnvironment &executionEnvironment, uint32_t rootDeviceIndex) -> std::unique_ptr<Device> {
     return std::unique_ptr<Device>(Device::create<RootDevice>(&executionEnvironment, rootDeviceIndex));
 };
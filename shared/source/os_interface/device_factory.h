@@ -21,6 +21,7 @@ class DeviceFactory {
     static bool getDevicesForProductFamilyOverride(size_t &numDevices, ExecutionEnvironment &executionEnvironment);
     static std::vector<std::unique_ptr<Device>> createDevices(ExecutionEnvironment &executionEnvironment);
     static bool isHwModeSelected();
+    static size_t getRootDeviceInitializationThreadCount(size_t numRootDevices);
 
     static std::unique_ptr<Device> (*createRootDeviceFunc)(ExecutionEnvironment &executionEnvironment, uint32_t rootDeviceIndex);
 };
@@ -126,6 +126,12 @@ int BufferObject::exec(uint32_t used, size_t startOffset, unsigned int flags, bo
     return err;
 }
 
+uint64_t BufferObject::acquireDirectSubmissionSession() {
+    // Globally unique, so that a BO bound by one ring is never mistaken as bound by another one
+    static std::atomic<uint64_t> lastSession{0u};
+    return ++lastSession;
+}
+
 int BufferObject::pin(BufferObject *const boToPin[], size_t numberOfBos, uint32_t drmContextId) {
     reinterpret_cast<uint32_t *>(this->gpuAddress)[0] = 0x05000000;
     reinterpret_cast<uint32_t *>(this->gpuAddress)[1] = 0x00000000;
@@ -50,6 +50,9 @@ class BufferObject {
     uint64_t peekUnmapSize() const { return unmapSize; }
     bool peekIsReusableAllocation() const { return this->isReused; }
     uint32_t peekRootDeviceIndex() { return rootDeviceIndex; }
+    uint64_t peekDirectSubmissionSession() const { return directSubmissionSession; }
+    void setDirectSubmissionSession(uint64_t session) { directSubmissionSession = session; }
+    static uint64_t acquireDirectSubmissionSession();
 
   protected:
     Drm *drm = nullptr;
@@ -71,5 +74,8 @@ class BufferObject {
     void *lockedAddress; // CPU side virtual address
 
     uint64_t unmapSize = 0;
+
+    // last direct submission ring session in which this BO was bound to the GPU
+    std::atomic<uint64_t> directSubmissionSession{0u};
 };
 } // namespace NEO
@@ -0,0 +1,161 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/linux/drm_capabilities_snapshot.h"
+
+#include "shared/source/helpers/file_io.h"
+#include "shared/source/helpers/hash.h"
+#include "shared/source/helpers/string.h"
+
+#include "drm/i915_drm.h"
+#include "os_inc.h"
+
+#include <cstdio>
+#include <iomanip>
+#include <sstream>
+#include <unistd.h>
+#include <vector>
+
+namespace NEO {
+
+constexpr uint32_t DrmCapabilitiesSnapshot::magic;
+constexpr uint32_t DrmCapabilitiesSnapshot::formatVersion;
+constexpr const char *DrmCapabilitiesSnapshot::fileExtension;
+
+DrmCapabilitiesSnapshot::DrmCapabilitiesSnapshot(const std::string &directory, const std::string &key)
+    : directory(directory), key(key) {}
+
+DrmCapabilitiesSnapshot::Capability DrmCapabilitiesSnapshot::getCapabilityForParam(int param) {
+    switch (param) {
+    case I915_PARAM_EU_TOTAL:
+        return Capability::EuTotal;
+    case I915_PARAM_SUBSLICE_TOTAL:
+        return Capability::SubsliceTotal;
+    case I915_PARAM_HAS_EXEC_SOFTPIN:
+        return Capability::ExecSoftPin;
+    case I915_PARAM_HAS_POOLED_EU:
+        return Capability::PooledEu;
+    case I915_PARAM_MIN_EU_IN_POOL:
+        return Capability::MinEuInPool;
+    case I915_PARAM_HAS_SCHEDULER:
+        return Capability::Scheduler;
+    default:
+        return Capability::Count;
+    }
+}
+
+std::string DrmCapabilitiesSnapshot::getFileName() const {
+    Hash hash;
+    hash.update(key.c_str(), key.size());
+    auto res = hash.finish();
+
+    std::stringstream stream;
+    stream << directory << PATH_SEPARATOR
+           << std::setfill('0') << std::setw(sizeof(res) * 2) << std::hex << res
+           << fileExtension;
+    return stream.str();
+}
+
+bool DrmCapabilitiesSnapshot::load() {
+    size_t size = 0;
+    auto data = loadDataFromFile(getFileName().c_str(), size);
+    if (!data || size < sizeof(Header)) {
+        return false;
+    }
+
+    Header header;
+    memcpy_s(&header, sizeof(Header), data.get(), sizeof(Header));
+    if (header.magic != magic || header.formatVersion != formatVersion ||
+        size != sizeof(Header) + header.keySize + header.sysFsPciPathSize) {
+        return false;
+    }
+
+    // Hash collision or snapshot of different device / driver
+    auto storedKey = data.get() + sizeof(Header);
+    if (header.keySize != key.size() || key.compare(0, key.size(), storedKey, header.keySize) != 0) {
+        return false;
+    }
+
+    sysFsPciPath.assign(storedKey + header.keySize, header.sysFsPciPathSize);
+    validMask = header.validMask;
+    for (size_t i = 0; i < values.size(); i++) {
+        values[i] = header.values[i];
+    }
+    dirty = false;
+    return true;
+}
+
+bool DrmCapabilitiesSnapshot::save() {
+    Header header = {};
+    header.magic = magic;
+    header.formatVersion = formatVersion;
+    header.keySize = static_cast<uint32_t>(key.size());
+    header.sysFsPciPathSize = static_cast<uint32_t>(sysFsPciPath.size());
+    header.validMask = validMask;
+    for (size_t i = 0; i < values.size(); i++) {
+        header.values[i] = values[i];
+    }
+
+    std::vector<char> data(sizeof(Header) + key.size() + sysFsPciPath.size());
+    memcpy_s(data.data(), data.size(), &header, sizeof(Header));
+    memcpy_s(data.data() + sizeof(Header), data.size() - sizeof(Header), key.c_str(), key.size());
+    memcpy_s(data.data() + sizeof(Header) + key.size(), sysFsPciPath.size(), sysFsPciPath.c_str(), sysFsPciPath.size());
+
+    // Many processes may start at once, write to private file and rename it, so readers never see partial snapshot
+    auto fileName = getFileName();
+    auto tempFileName = fileName + "." + std::to_string(getpid()) + ".tmp";
+    if (writeDataToFile(tempFileName.c_str(), data.data(), data.size()) != data.size()) {
+        std::remove(tempFileName.c_str());
+        return false;
+    }
+    if (std::rename(tempFileName.c_str(), fileName.c_str()) != 0) {
+        std::remove(tempFileName.c_str());
+        return false;
+    }
+    dirty = false;
+    return true;
+}
+
+bool DrmCapabilitiesSnapshot::get(Capability capability, int64_t &value) const {
+    auto index = static_cast<uint32_t>(capability);
+    if (capability == Capability::Count || !(validMask & (1u << index))) {
+        return false;
+    }
+    value = values[index];
+    return true;
+}
+
+void DrmCapabilitiesSnapshot::set(Capability capability, int64_t value) {
+    auto index = static_cast<uint32_t>(capability);
+    if (capability == Capability::Count) {
+        return;
+    }
+    if ((validMask & (1u << index)) && values[index] == value) {
+        return;
+    }
+    values[index] = value;
+    validMask |= 1u << index;
+    dirty = true;
+}
+
+bool DrmCapabilitiesSnapshot::getSysFsPciPath(std::string &path) const {
+    if (sysFsPciPath.empty()) {
+        return false;
+    }
+    path = sysFsPciPath;
+    return true;
+}
+
+void DrmCapabilitiesSnapshot::setSysFsPciPath(const std::string &path) {
+    if (path.empty() || path == sysFsPciPath) {
+        return;
+    }
+    sysFsPciPath = path;
+    dirty = true;
+}
+
+} // namespace NEO
@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <array>
+#include <cstdint>
+#include <string>
+
+namespace NEO {
+
+// On-disk copy of DRM probe results (GETPARAMs, context params, sysfs lookups), which are static for given device and kernel driver.
+// Snapshot is keyed by PCI id, revision, PCI location and kernel driver version, processes which find
+// matching snapshot skip the probing. Values which can change at runtime (e.g. frequency limits) are not stored.
+class DrmCapabilitiesSnapshot {
+  public:
+    enum class Capability : uint32_t {
+        EuTotal = 0,
+        SubsliceTotal,
+        ExecSoftPin,
+        PooledEu,
+        MinEuInPool,
+        Scheduler,
+        GttSize,
+        PersistentContexts,
+        Count
+    };
+
+    static constexpr uint32_t magic = 0x4e534344u; // "DCSN"
+    static constexpr uint32_t formatVersion = 1u;
+    static constexpr const char *fileExtension = ".drm_caps";
+
+    DrmCapabilitiesSnapshot(const std::string &directory, const std::string &key);
+
+    static Capability getCapabilityForParam(int param);
+
+    bool load();
+    bool save();
+
+    bool get(Capability capability, int64_t &value) const;
+    void set(Capability capability, int64_t value);
+
+    bool getSysFsPciPath(std::string &path) const;
+    void setSysFsPciPath(const std::string &path);
+
+    bool isDirty() const { return dirty; }
+    const std::string &getKey() const { return key; }
+    std::string getFileName() const;
+
+  protected:
+    struct Header {
+        uint32_t magic;
+        uint32_t formatVersion;
+        uint32_t keySize;
+        uint32_t sysFsPciPathSize;
+        uint32_t validMask;
+        uint32_t reserved;
+        int64_t values[static_cast<uint32_t>(Capability::Count)];
+    };
+
+    std::string directory;
+    std::string key;
+    std::string sysFsPciPath;
+    std::array<int64_t, static_cast<uint32_t>(Capability::Count)> values = {};
+    uint32_t validMask = 0u;
+    bool dirty = false;
+};
+
+} // namespace NEO
@@ -17,6 +17,7 @@
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/helpers/surface_format_info.h"
 #include "shared/source/memory_manager/host_ptr_manager.h"
+#include "shared/source/memory_manager/memory_operations_handler.h"
 #include "shared/source/memory_manager/residency.h"
 #include "shared/source/os_interface/linux/allocator_helper.h"
 #include "shared/source/os_interface/linux/os_context_linux.h"
@@ -114,6 +115,7 @@ uint32_t DrmMemoryManager::unreference(NEO::BufferObject *bo, bool synchronousDe
             eraseSharedBufferObject(bo);
         }
 
+        releaseDirectSubmissionResidency(bo);
         bo->close();
 
         if (lock) {
@@ -125,6 +127,17 @@ uint32_t DrmMemoryManager::unreference(NEO::BufferObject *bo, bool synchronousDe
     return r;
 }
 
+void DrmMemoryManager::releaseDirectSubmissionResidency(BufferObject *bo) {
+    auto session = bo->peekDirectSubmissionSession();
+    if (session == 0u) {
+        return;
+    }
+    // closed or unmapped buffer object would be kept alive by the running ring
+    for (auto &engine : registeredEngines) {
+        engine.commandStreamReceiver->releaseDirectSubmissionResidency(session);
+    }
+}
+
 uint64_t DrmMemoryManager::acquireGpuRange(size_t &size, bool specificBitness, uint32_t rootDeviceIndex) {
     auto gfxPartition = getGfxPartition(rootDeviceIndex);
     if (specificBitness && this->force32bitAllocations) {
@@ -278,6 +291,34 @@ DrmAllocation *DrmMemoryManager::allocateGraphicsMemoryForNonSvmHostPtr(const Al
     return allocation;
 }
 
+GraphicsAllocation *DrmMemoryManager::createGraphicsAllocationFromHostPtrMapping(const AllocationProperties &properties, void *hostPtr) {
+    if (isLimitedRange(properties.rootDeviceIndex) || properties.size == 0 || hostPtr == nullptr) {
+        return nullptr;
+    }
+
+    auto alignedPtr = alignDown(hostPtr, MemoryConstants::pageSize);
+    auto alignedSize = alignSizeWholePage(hostPtr, properties.size);
+
+    // own userptr BO of this root device, fragments of host ptr manager are keyed by CPU pointer only and cannot be shared across root devices
+    BufferObject *bo = allocUserptr(reinterpret_cast<uintptr_t>(alignedPtr), alignedSize, 0, properties.rootDeviceIndex);
+    if (!bo) {
+        return nullptr;
+    }
+
+    if (validateHostPtrMemory) {
+        int result = pinBBs.at(properties.rootDeviceIndex)->pin(&bo, 1, getDefaultDrmContextId());
+        if (result != SUCCESS) {
+            unreference(bo, true);
+            return nullptr;
+        }
+    }
+
+    auto allocation = new DrmAllocation(properties.rootDeviceIndex, properties.allocationType, bo, hostPtr, castToUint64(alignedPtr),
+                                        properties.size, MemoryPool::System4KBPages);
+    allocation->setAllocationOffset(ptrDiff(hostPtr, alignedPtr));
+    return allocation;
+}
+
 DrmAllocation *DrmMemoryManager::allocateGraphicsMemory64kb(const AllocationData &allocationData) {
     return nullptr;
 }
@@ -547,6 +588,11 @@ void DrmMemoryManager::removeAllocationFromHostPtrManager(GraphicsAllocation *gf
 }
 
 void DrmMemoryManager::freeGraphicsMemoryImpl(GraphicsAllocation *gfxAllocation) {
+    auto memoryOperationsInterface = executionEnvironment.rootDeviceEnvironments[gfxAllocation->getRootDeviceIndex()]->memoryOperationsInterface.get();
+    if (memoryOperationsInterface) {
+        memoryOperationsInterface->evict(*gfxAllocation);
+    }
+
     for (auto handleId = 0u; handleId < EngineLimits::maxHandleCount; handleId++) {
         if (gfxAllocation->getGmm(handleId)) {
             delete gfxAllocation->getGmm(handleId);
@@ -572,7 +618,9 @@ void DrmMemoryManager::freeGraphicsMemoryImpl(GraphicsAllocation *gfxAllocation)
 }
 
 void DrmMemoryManager::handleFenceCompletion(GraphicsAllocation *allocation) {
-    static_cast<DrmAllocation *>(allocation)->getBO()->wait(-1);
+    auto bo = static_cast<DrmAllocation *>(allocation)->getBO();
+    releaseDirectSubmissionResidency(bo);
+    bo->wait(-1);
 }
 
 uint64_t DrmMemoryManager::getSystemSharedMemory(uint32_t rootDeviceIndex) {
@@ -637,6 +685,7 @@ void DrmMemoryManager::cleanOsHandles(OsHandleStorage &handleStorage, uint32_t r
         if (handleStorage.fragmentStorageData[i].freeTheFragment) {
             if (handleStorage.fragmentStorageData[i].osHandleStorage->bo) {
                 BufferObject *search = handleStorage.fragmentStorageData[i].osHandleStorage->bo;
+                releaseDirectSubmissionResidency(search);
                 search->wait(-1);
                 auto refCount = unreference(search, true);
                 DEBUG_BREAK_IF(refCount != 1u);
@@ -13,15 +13,50 @@ DrmMemoryOperationsHandler::DrmMemoryOperationsHandler() {
 }
 
 MemoryOperationsStatus DrmMemoryOperationsHandler::makeResident(ArrayRef<GraphicsAllocation *> gfxAllocations) {
-    return MemoryOperationsStatus::UNSUPPORTED;
+    std::lock_guard<std::mutex> lock(mutex);
+    for (const auto &allocation : gfxAllocations) {
+        residency.insert({allocation, mergeCount});
+    }
+    return MemoryOperationsStatus::SUCCESS;
 }
 
 MemoryOperationsStatus DrmMemoryOperationsHandler::evict(GraphicsAllocation &gfxAllocation) {
-    return MemoryOperationsStatus::UNSUPPORTED;
+    std::lock_guard<std::mutex> lock(mutex);
+    if (residency.erase(&gfxAllocation) == 0) {
+        return MemoryOperationsStatus::MEMORY_NOT_FOUND;
+    }
+    return MemoryOperationsStatus::SUCCESS;
 }
 
 MemoryOperationsStatus DrmMemoryOperationsHandler::isResident(GraphicsAllocation &gfxAllocation) {
-    return MemoryOperationsStatus::UNSUPPORTED;
+    std::lock_guard<std::mutex> lock(mutex);
+    if (residency.find(&gfxAllocation) == residency.end()) {
+        return MemoryOperationsStatus::MEMORY_NOT_FOUND;
+    }
+    return MemoryOperationsStatus::SUCCESS;
+}
+
+std::unique_lock<std::mutex> DrmMemoryOperationsHandler::mergeWithResidencyContainer(const ResidencyContainer &allocationsForResidency, ResidencyContainer &residentAllocations) {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (residency.empty()) {
+        // without explicit residency submissions don't need to be serialized with evict
+        return std::unique_lock<std::mutex>();
+    }
+
+    // exec rejects duplicated buffer objects, allocations already in submission residency are marked and skipped
+    auto currentMerge = ++mergeCount;
+    for (auto allocation : allocationsForResidency) {
+        auto residentAllocation = residency.find(allocation);
+        if (residentAllocation != residency.end()) {
+            residentAllocation->second = currentMerge;
+        }
+    }
+    for (auto &residentAllocation : residency) {
+        if (residentAllocation.second != currentMerge) {
+            residentAllocations.push_back(residentAllocation.first);
+        }
+    }
+    return lock;
 }
 
 } // namespace NEO
@@ -8,6 +8,9 @@
 #pragma once
 #include "shared/source/memory_manager/memory_operations_handler.h"
 
+#include <mutex>
+#include <unordered_map>
+
 namespace NEO {
 
 class DrmMemoryOperationsHandler : public MemoryOperationsHandler {
@@ -18,5 +21,12 @@ class DrmMemoryOperationsHandler : public MemoryOperationsHandler {
     MemoryOperationsStatus makeResident(ArrayRef<GraphicsAllocation *> gfxAllocations) override;
     MemoryOperationsStatus evict(GraphicsAllocation &gfxAllocation) override;
     MemoryOperationsStatus isResident(GraphicsAllocation &gfxAllocation) override;
+    std::unique_lock<std::mutex> mergeWithResidencyContainer(const ResidencyContainer &allocationsForResidency, ResidencyContainer &residentAllocations) override;
+
+  protected:
+    std::mutex mutex;
+    // Resident allocation with number of last merge it was already part of submission residency in
+    std::unordered_map<GraphicsAllocation *, uint64_t> residency;
+    uint64_t mergeCount = 0u;
 };
 } // namespace NEO
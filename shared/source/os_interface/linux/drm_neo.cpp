@@ -21,6 +21,10 @@
 #include <cstring>
 #include <fstream>
 #include <linux/limits.h>
+#include <sstream>
+#include <sys/stat.h>
+#include <sys/sysmacros.h>
+#include <sys/utsname.h>
 
 namespace NEO {
 
@@ -67,6 +71,13 @@ int Drm::ioctl(unsigned long request, void *arg) {
 }
 
 int Drm::getParamIoctl(int param, int *dstValue) {
+    auto capability = DrmCapabilitiesSnapshot::getCapabilityForParam(param);
+    int64_t snapshotValue = 0;
+    if (capabilitiesSnapshot && capabilitiesSnapshot->get(capability, snapshotValue)) {
+        *dstValue = static_cast<int>(snapshotValue);
+        return 0;
+    }
+
     drm_i915_getparam_t getParam = {};
     getParam.param = param;
     getParam.value = dstValue;
@@ -77,6 +88,10 @@ int Drm::getParamIoctl(int param, int *dstValue) {
                      "\nDRM_IOCTL_I915_GETPARAM: param: %s, output value: %d, retCode: %d\n",
                      IoctlHelper::getIoctlParamString(param), *getParam.value, retVal);
 
+    // Only successful queries are stored, failures are probed again with errno available to callers
+    if (capabilitiesSnapshot && retVal == 0) {
+        capabilitiesSnapshot->set(capability, *dstValue);
+    }
     return retVal;
 }
 
@@ -132,6 +147,11 @@ int Drm::getMaxGpuFrequency(int &maxGpuFrequency) {
 
 std::string Drm::getSysFsPciPath(int deviceID) {
     std::string nullPath;
+    std::string snapshotPath;
+    if (capabilitiesSnapshot && capabilitiesSnapshot->getSysFsPciPath(snapshotPath)) {
+        return snapshotPath;
+    }
+
     std::string sysFsPciDirectory = Os::sysFsPciPath;
     std::vector<std::string> files = Directory::getFiles(sysFsPciDirectory);
 
@@ -147,6 +167,9 @@ std::string Drm::getSysFsPciPath(int deviceID) {
                 configFile.close();
                 continue;
             }
+            if (capabilitiesSnapshot) {
+                capabilitiesSnapshot->setSysFsPciPath(sysfsPath);
+            }
             return sysfsPath;
         }
     }
@@ -154,12 +177,21 @@ std::string Drm::getSysFsPciPath(int deviceID) {
 }
 
 int Drm::queryGttSize(uint64_t &gttSizeOutput) {
+    int64_t snapshotValue = 0;
+    if (capabilitiesSnapshot && capabilitiesSnapshot->get(DrmCapabilitiesSnapshot::Capability::GttSize, snapshotValue)) {
+        gttSizeOutput = static_cast<uint64_t>(snapshotValue);
+        return 0;
+    }
+
     drm_i915_gem_context_param contextParam = {0};
     contextParam.param = I915_CONTEXT_PARAM_GTT_SIZE;
 
     int ret = ioctl(DRM_IOCTL_I915_GEM_CONTEXT_GETPARAM, &contextParam);
     if (ret == 0) {
         gttSizeOutput = contextParam.value;
+        if (capabilitiesSnapshot) {
+            capabilitiesSnapshot->set(DrmCapabilitiesSnapshot::Capability::GttSize, static_cast<int64_t>(contextParam.value));
+        }
     }
 
     return ret;
@@ -217,10 +249,19 @@ bool Drm::setQueueSliceCount(uint64_t sliceCount) {
 }
 
 void Drm::checkNonPersistentContextsSupport() {
+    int64_t snapshotValue = 0;
+    if (capabilitiesSnapshot && capabilitiesSnapshot->get(DrmCapabilitiesSnapshot::Capability::PersistentContexts, snapshotValue)) {
+        nonPersistentContextsSupported = (snapshotValue == 1);
+        return;
+    }
+
     drm_i915_gem_context_param contextParam = {};
     contextParam.param = I915_CONTEXT_PARAM_PERSISTENCE;
 
     auto retVal = ioctl(DRM_IOCTL_I915_GEM_CONTEXT_GETPARAM, &contextParam);
+    if (retVal == 0 && capabilitiesSnapshot) {
+        capabilitiesSnapshot->set(DrmCapabilitiesSnapshot::Capability::PersistentContexts, static_cast<int64_t>(contextParam.value));
+    }
     if (retVal == 0 && contextParam.value == 1) {
         nonPersistentContextsSupported = true;
     } else {
@@ -352,6 +393,63 @@ bool Drm::isi915Version(int fileDescriptor) {
     return strcmp(name, "i915") == 0;
 }
 
+bool Drm::getCapabilitiesSnapshotKey(std::string &key) {
+    char date[64] = {};
+    drm_version_t version = {};
+    version.date = date;
+    version.date_len = sizeof(date) - 1;
+    if (ioctl(DRM_IOCTL_VERSION, &version) != 0) {
+        return false;
+    }
+
+    struct utsname kernelInfo = {};
+    if (uname(&kernelInfo) != 0) {
+        return false;
+    }
+
+    // PCI location distinguishes devices with same id, but different fusing
+    struct stat st = {};
+    if (fstat(getFileDescriptor(), &st) != 0 || !S_ISCHR(st.st_mode)) {
+        return false;
+    }
+    char devicePath[PATH_MAX] = {};
+    char pciLocation[PATH_MAX] = {};
+    snprintf(devicePath, PATH_MAX, "/sys/dev/char/%u:%u/device", major(st.st_rdev), minor(st.st_rdev));
+    if (readlink(devicePath, pciLocation, PATH_MAX - 1) < 0) {
+        return false;
+    }
+
+    std::stringstream stream;
+    stream << std::hex << deviceId << ";" << revisionId << ";" << pciLocation << ";"
+           << std::dec << version.version_major << "." << version.version_minor << "." << version.version_patchlevel << ";" << date << ";"
+           << kernelInfo.release << ";" << kernelInfo.version;
+    key = stream.str();
+    return true;
+}
+
+void Drm::setupCapabilitiesSnapshot() {
+    auto directory = DebugManager.flags.DeviceCapabilitiesSnapshotDir.get();
+    if (directory == "unk" || DebugManager.flags.EnableNullHardware.get()) {
+        return;
+    }
+
+    std::string key;
+    if (!getCapabilitiesSnapshotKey(key)) {
+        return;
+    }
+    capabilitiesSnapshot = std::make_unique<DrmCapabilitiesSnapshot>(directory, key);
+    auto loaded = capabilitiesSnapshot->load();
+    printDebugString(DebugManager.flags.PrintDebugMessages.get(), stdout,
+                     "\nDRM capabilities snapshot %s: %s\n", capabilitiesSnapshot->getFileName().c_str(), loaded ? "loaded" : "not found");
+}
+
+bool Drm::saveCapabilitiesSnapshot() {
+    if (!capabilitiesSnapshot || !capabilitiesSnapshot->isDirty()) {
+        return false;
+    }
+    return capabilitiesSnapshot->save();
+}
+
 Drm::~Drm() = default;
 
 } // namespace NEO
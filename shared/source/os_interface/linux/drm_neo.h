@@ -7,6 +7,7 @@
 
 #pragma once
 #include "shared/source/helpers/basic_math.h"
+#include "shared/source/os_interface/linux/drm_capabilities_snapshot.h"
 #include "shared/source/os_interface/linux/engine_info.h"
 #include "shared/source/os_interface/linux/hw_device_id.h"
 #include "shared/source/os_interface/linux/memory_info.h"
@@ -85,6 +86,10 @@ class Drm {
     void checkNonPersistentContextsSupport();
     void setNonPersistentContext(uint32_t drmContextId);
 
+    void setupCapabilitiesSnapshot();
+    bool saveCapabilitiesSnapshot();
+    DrmCapabilitiesSnapshot *getCapabilitiesSnapshot() const { return capabilitiesSnapshot.get(); }
+
     MemoryInfo *getMemoryInfo() const {
         return memoryInfo.get();
     }
@@ -106,8 +111,10 @@ class Drm {
     Drm(std::unique_ptr<HwDeviceId> hwDeviceIdIn, RootDeviceEnvironment &rootDeviceEnvironment) : hwDeviceId(std::move(hwDeviceIdIn)), rootDeviceEnvironment(rootDeviceEnvironment) {}
     std::unique_ptr<EngineInfo> engineInfo;
     std::unique_ptr<MemoryInfo> memoryInfo;
+    std::unique_ptr<DrmCapabilitiesSnapshot> capabilitiesSnapshot;
 
     std::string getSysFsPciPath(int deviceID);
+    bool getCapabilitiesSnapshotKey(std::string &key);
     void *query(uint32_t queryId);
 
 #pragma pack(1)
@@ -58,6 +58,7 @@ bool RootDeviceEnvironment::initOsInterface(std::unique_ptr<HwDeviceId> &&hwDevi
     if (hwConfig->configureHwInfo(hardwareInfo, hardwareInfo, osInterface.get())) {
         return false;
     }
+    drm->saveCapabilitiesSnapshot();
     return true;
 }
 } // namespace NEO
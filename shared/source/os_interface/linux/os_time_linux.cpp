@@ -7,15 +7,20 @@
 
 #include "shared/source/os_interface/linux/os_time_linux.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/os_interface/linux/drm_neo.h"
 #include "shared/source/os_interface/linux/os_interface.h"
 
 #include "drm/i915_drm.h"
 
+#include <cmath>
 #include <time.h>
 
 namespace NEO {
 
+// GPU and CPU clocks drift in ppm range, bigger difference of measured rate comes from counter reset or delayed register read
+constexpr double maxCpuGpuClockDrift = 0.01;
+
 OSTimeLinux::OSTimeLinux(OSInterface *osInterface) {
     this->osInterface = osInterface;
     resolutionFunc = &clock_getres;
@@ -117,6 +122,15 @@ bool OSTimeLinux::getCpuGpuTime(TimeStampData *pGpuCpuTime) {
     if (nullptr == this->getGpuTime) {
         return false;
     }
+
+    auto recalibrationPeriod = DebugManager.flags.CpuGpuTimeModelRecalibrationPeriodMs.get();
+    if (recalibrationPeriod > 0) {
+        return getCpuGpuTimeFromModel(pGpuCpuTime, static_cast<uint64_t>(recalibrationPeriod) * 1000000u);
+    }
+    return readCpuGpuTime(pGpuCpuTime);
+}
+
+bool OSTimeLinux::readCpuGpuTime(TimeStampData *pGpuCpuTime) {
     if (!(this->*getGpuTime)(&pGpuCpuTime->GPUTimeStamp)) {
         return false;
     }
@@ -127,6 +141,80 @@ bool OSTimeLinux::getCpuGpuTime(TimeStampData *pGpuCpuTime) {
     return true;
 }
 
+bool OSTimeLinux::getCpuGpuTimeFromModel(TimeStampData *pGpuCpuTime, uint64_t recalibrationPeriod) {
+    std::lock_guard<std::mutex> lock(cpuGpuTimeModelMutex);
+    auto &model = cpuGpuTimeModel;
+
+    uint64_t cpuTime = 0u;
+    if (!getCpuTime(&cpuTime)) {
+        return false;
+    }
+
+    // without known GPU timestamp frequency every query reads the register
+    if (!model.calibrated || model.gpuTicksPerNs == 0.0 || cpuTime - model.baseCpuTime >= recalibrationPeriod) {
+        TimeStampData sample = {};
+        if (!readCpuGpuTime(&sample)) {
+            return false;
+        }
+        recalibrateCpuGpuTimeModel(sample);
+        pGpuCpuTime->CPUTimeinNS = sample.CPUTimeinNS;
+        pGpuCpuTime->GPUTimeStamp = clampToLastGpuTimeStamp(sample.GPUTimeStamp);
+        return true;
+    }
+
+    auto gpuTicks = static_cast<uint64_t>(static_cast<double>(cpuTime - model.baseCpuTime) * model.gpuTicksPerNs);
+    pGpuCpuTime->CPUTimeinNS = cpuTime;
+    pGpuCpuTime->GPUTimeStamp = clampToLastGpuTimeStamp((model.baseGpuTimeStamp + gpuTicks) & getGpuTimeStampMask());
+    return true;
+}
+
+void OSTimeLinux::recalibrateCpuGpuTimeModel(const TimeStampData &sample) {
+    auto &model = cpuGpuTimeModel;
+
+    if (!model.calibrated) {
+        drm_i915_getparam_t getParam = {};
+        int frequency = 0;
+
+        getParam.param = I915_PARAM_CS_TIMESTAMP_FREQUENCY;
+        getParam.value = &frequency;
+        if (pDrm->ioctl(DRM_IOCTL_I915_GETPARAM, &getParam) == 0 && frequency > 0) {
+            model.nominalGpuTicksPerNs = static_cast<double>(frequency) / NSEC_PER_SEC;
+        }
+        model.gpuTicksPerNs = model.nominalGpuTicksPerNs;
+        model.lastGpuTimeStamp = sample.GPUTimeStamp;
+    } else if (model.gpuTicksPerNs != 0.0 && sample.CPUTimeinNS > model.baseCpuTime) {
+        auto cpuDelta = static_cast<double>(sample.CPUTimeinNS - model.baseCpuTime);
+        auto gpuDelta = static_cast<double>((sample.GPUTimeStamp - model.baseGpuTimeStamp) & getGpuTimeStampMask());
+        auto measuredGpuTicksPerNs = gpuDelta / cpuDelta;
+
+        printDebugString(DebugManager.flags.PrintDebugMessages.get(), stdout, "CPU GPU time model error: %f GPU ticks\n",
+                         gpuDelta - cpuDelta * model.gpuTicksPerNs);
+
+        if (std::abs(measuredGpuTicksPerNs - model.nominalGpuTicksPerNs) <= model.nominalGpuTicksPerNs * maxCpuGpuClockDrift) {
+            model.gpuTicksPerNs = measuredGpuTicksPerNs;
+        }
+    }
+
+    model.baseCpuTime = sample.CPUTimeinNS;
+    model.baseGpuTimeStamp = sample.GPUTimeStamp;
+    model.calibrated = true;
+}
+
+uint64_t OSTimeLinux::clampToLastGpuTimeStamp(uint64_t gpuTimeStamp) {
+    // model error corrected at recalibration must not move timestamps backwards, counter wrap is not a step back
+    auto mask = getGpuTimeStampMask();
+    auto backwardDistance = (cpuGpuTimeModel.lastGpuTimeStamp - gpuTimeStamp) & mask;
+    if (backwardDistance < (mask >> 1)) {
+        gpuTimeStamp = cpuGpuTimeModel.lastGpuTimeStamp;
+    }
+    cpuGpuTimeModel.lastGpuTimeStamp = gpuTimeStamp;
+    return gpuTimeStamp;
+}
+
+uint64_t OSTimeLinux::getGpuTimeStampMask() const {
+    return (1ull << timestampSizeInBits) - 1;
+}
+
 std::unique_ptr<OSTime> OSTime::create(OSInterface *osInterface) {
     return std::unique_ptr<OSTime>(new OSTimeLinux(osInterface));
 }
@@ -9,6 +9,8 @@
 #include "shared/source/os_interface/linux/drm_neo.h"
 #include "shared/source/os_interface/os_time.h"
 
+#include <mutex>
+
 #define OCLRT_NUM_TIMESTAMP_BITS (36)
 #define OCLRT_NUM_TIMESTAMP_BITS_FALLBACK (32)
 #define TIMESTAMP_HIGH_REG 0x0235C
@@ -33,12 +35,30 @@ class OSTimeLinux : public OSTime {
     uint64_t getCpuRawTimestamp() override;
 
   protected:
+    // Linear model of GPU timestamp in function of CPU time, serves timestamps without REG_READ ioctl between recalibrations
+    struct CpuGpuTimeModel {
+        uint64_t baseCpuTime = 0u;
+        uint64_t baseGpuTimeStamp = 0u;
+        uint64_t lastGpuTimeStamp = 0u;
+        double gpuTicksPerNs = 0.0;
+        double nominalGpuTicksPerNs = 0.0;
+        bool calibrated = false;
+    };
+
+    bool readCpuGpuTime(TimeStampData *pGpuCpuTime);
+    bool getCpuGpuTimeFromModel(TimeStampData *pGpuCpuTime, uint64_t recalibrationPeriod);
+    void recalibrateCpuGpuTimeModel(const TimeStampData &sample);
+    uint64_t clampToLastGpuTimeStamp(uint64_t gpuTimeStamp);
+    uint64_t getGpuTimeStampMask() const;
+
     typedef int (*resolutionFunc_t)(clockid_t, struct timespec *);
     typedef int (*getTimeFunc_t)(clockid_t, struct timespec *);
     Drm *pDrm = nullptr;
     unsigned timestampSizeInBits;
     resolutionFunc_t resolutionFunc;
     getTimeFunc_t getTimeFunc;
+    std::mutex cpuGpuTimeModelMutex;
+    CpuGpuTimeModel cpuGpuTimeModel;
 };
 
 } // namespace NEO
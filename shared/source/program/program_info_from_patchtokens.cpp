@@ -11,6 +11,7 @@
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device_binary_format/patchtokens_decoder.h"
 #include "shared/source/program/program_info.h"
+#include "shared/source/utilities/parallel_for.h"
 
 #include "opencl/source/program/kernel_info.h"
 #include "opencl/source/program/kernel_info_from_patchtokens.h"
@@ -26,12 +27,9 @@ bool requiresLocalMemoryWindowVA(const PatchTokenBinary::ProgramFromPatchtokens
     return false;
 }
 
-void populateSingleKernelInfo(ProgramInfo &dst, const PatchTokenBinary::ProgramFromPatchtokens &decodedProgram, uint32_t kernelNum) {
-    auto kernelInfo = std::make_unique<KernelInfo>();
+void populateSingleKernelInfo(ProgramInfo &dst, const PatchTokenBinary::ProgramFromPatchtokens &decodedProgram, uint32_t kernelNum, std::unique_ptr<KernelInfo> kernelInfo) {
     const PatchTokenBinary::KernelFromPatchtokens &decodedKernel = decodedProgram.kernels[kernelNum];
 
-    NEO::populateKernelInfo(*kernelInfo, decodedKernel, decodedProgram.header->GPUPointerSizeInBytes);
-
     if (decodedKernel.tokens.programSymbolTable) {
         dst.prepareLinkerInputStorage();
         dst.linkerInput->decodeExportedFunctionsSymbolTable(decodedKernel.tokens.programSymbolTable + 1, decodedKernel.tokens.programSymbolTable->NumEntries, kernelNum);
@@ -46,8 +44,23 @@ void populateSingleKernelInfo(ProgramInfo &dst, const PatchTokenBinary::ProgramF
 }
 
 void populateProgramInfo(ProgramInfo &dst, const PatchTokenBinary::ProgramFromPatchtokens &src) {
+    // KernelInfos are independent and populated concurrently, linker input is shared and filled in kernels order
+    std::vector<std::unique_ptr<KernelInfo>> kernelInfos(src.kernels.size());
+    auto populateKernelInfoAt = [&](size_t kernelNum) {
+        kernelInfos[kernelNum] = std::make_unique<KernelInfo>();
+        NEO::populateKernelInfo(*kernelInfos[kernelNum], src.kernels[kernelNum], src.header->GPUPointerSizeInBytes);
+    };
+    auto threadCount = PatchTokenBinary::getKernelsDecodingThreadCount(src.kernels.size());
+    if (threadCount > 1) {
+        parallelFor(src.kernels.size(), threadCount, populateKernelInfoAt);
+    } else {
+        for (size_t i = 0; i < src.kernels.size(); ++i) {
+            populateKernelInfoAt(i);
+        }
+    }
+
     for (uint32_t i = 0; i < src.kernels.size(); ++i) {
-        populateSingleKernelInfo(dst, src, i);
+        populateSingleKernelInfo(dst, src, i, std::move(kernelInfos[i]));
     }
 
     if (src.programScopeTokens.allocateConstantMemorySurface.empty() == false) {
@@ -29,7 +29,10 @@ class HeapAllocator {
     HeapAllocator(uint64_t address, uint64_t size) : HeapAllocator(address, size, 4 * MemoryConstants::megaByte) {
     }
 
-    HeapAllocator(uint64_t address, uint64_t size, size_t threshold) : size(size), availableSize(size), sizeThreshold(threshold) {
+    HeapAllocator(uint64_t address, uint64_t size, size_t threshold) : HeapAllocator(address, size, threshold, MemoryConstants::pageSize) {
+    }
+
+    HeapAllocator(uint64_t address, uint64_t size, size_t threshold, size_t allocationAlignment) : size(size), availableSize(size), sizeThreshold(threshold), allocationAlignment(allocationAlignment) {
         pLeftBound = address;
         pRightBound = address + size;
         freedChunksBig.reserve(10);
@@ -124,7 +127,7 @@ class HeapAllocator {
     uint64_t pLeftBound;
     uint64_t pRightBound;
     const size_t sizeThreshold;
-    size_t allocationAlignment = MemoryConstants::pageSize;
+    size_t allocationAlignment;
 
     std::vector<HeapChunk> freedChunksSmall;
     std::vector<HeapChunk> freedChunksBig;
@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/parallel_for.h"
+
+#include "shared/source/os_interface/os_thread.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace NEO {
+
+namespace {
+struct ParallelForContext {
+    const ParallelForTask &task;
+    size_t count;
+    std::atomic<size_t> nextIndex{0};
+};
+
+void *parallelForWorker(void *arg) {
+    auto context = reinterpret_cast<ParallelForContext *>(arg);
+    for (auto index = context->nextIndex++; index < context->count; index = context->nextIndex++) {
+        context->task(index);
+    }
+    return nullptr;
+}
+} // namespace
+
+void parallelFor(size_t count, size_t maxThreads, const ParallelForTask &task) {
+    auto numThreads = std::min(count, maxThreads);
+    if (numThreads <= 1) {
+        for (size_t index = 0; index < count; index++) {
+            task(index);
+        }
+        return;
+    }
+
+    ParallelForContext context{task, count};
+    std::vector<std::unique_ptr<Thread>> workers;
+    workers.reserve(numThreads - 1);
+    for (size_t i = 0; i < numThreads - 1; i++) {
+        workers.push_back(Thread::create(parallelForWorker, reinterpret_cast<void *>(&context)));
+    }
+
+    parallelForWorker(&context);
+
+    for (auto &worker : workers) {
+        worker->join();
+    }
+}
+
+size_t getDefaultParallelForThreadCount() {
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+} // namespace NEO
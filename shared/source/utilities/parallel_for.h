@@ -0,0 +1,21 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <cstddef>
+#include <functional>
+
+namespace NEO {
+
+using ParallelForTask = std::function<void(size_t index)>;
+
+// Executes task for every index in [0, count) using at most maxThreads threads (calling thread included).
+// Indices are handed out dynamically, so tasks must not depend on execution order; returns when all indices are processed.
+void parallelFor(size_t count, size_t maxThreads, const ParallelForTask &task);
+
+size_t getDefaultParallelForThreadCount();
+} // namespace NEO
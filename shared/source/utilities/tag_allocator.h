@@ -6,11 +6,14 @@
  */
 
 #pragma once
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/utilities/idlist.h"
 
+#include <algorithm>
+#include <array>
 #include <atomic>
 #include <cstdint>
 #include <mutex>
@@ -48,6 +51,7 @@ struct TagNode : public IDNode<TagNode<TagType>> {
     TagAllocator<TagType> *allocator = nullptr;
     GraphicsAllocation *gfxAllocation = nullptr;
     uint64_t gpuAddress = 0;
+    size_t chunkIndex = 0;
     std::atomic<uint32_t> refCount{0};
     bool doNotReleaseNodes = false;
 
@@ -60,6 +64,10 @@ class TagAllocator {
   public:
     using NodeType = TagNode<TagType>;
 
+    static constexpr size_t magazinesCount = 8;
+    static constexpr size_t magazineCapacity = 16;
+    static constexpr uint32_t idlePassesBeforeTrim = 3;
+
     TagAllocator(uint32_t rootDeviceIndex, MemoryManager *memMngr, size_t tagCount,
                  size_t tagAlignment, size_t tagSize, bool doNotReleaseNodes) : rootDeviceIndex(rootDeviceIndex),
                                                                                 memoryManager(memMngr),
@@ -68,6 +76,8 @@ class TagAllocator {
                                                                                 doNotReleaseNodes(doNotReleaseNodes) {
 
         this->tagSize = alignUp(tagSize, tagAlignment);
+        useMagazines = DebugManager.flags.EnableTagAllocatorMagazines.get() != 0;
+        trimIdleChunksEnabled = DebugManager.flags.EnableTagAllocatorTrimming.get() != 0;
         populateFreeTags();
     }
 
@@ -76,6 +86,10 @@ class TagAllocator {
     }
 
     void cleanUpResources() {
+        for (auto &magazine : magazines) {
+            std::lock_guard<std::mutex> lock(magazine.mtx);
+            magazine.count = 0;
+        }
         for (auto gfxAllocation : gfxAllocations) {
             memoryManager->freeGraphicsMemory(gfxAllocation);
         }
@@ -85,19 +99,31 @@ class TagAllocator {
             delete[] nodesMemory;
         }
         tagPoolMemory.clear();
+        chunkIdlePasses.clear();
     }
 
     NodeType *getTag() {
-        if (freeTags.peekIsEmpty()) {
-            releaseDeferredTags();
+        NodeType *node = nullptr;
+        if (useMagazines) {
+            node = getTagFromMagazine();
+        }
+        if (!node) {
+            if (freeTags.peekIsEmpty()) {
+                releaseDeferredTags();
+            }
+            node = freeTags.removeFrontOne().release();
         }
-        NodeType *node = freeTags.removeFrontOne().release();
         if (!node) {
             std::unique_lock<std::mutex> lock(allocatorMutex);
-            populateFreeTags();
             node = freeTags.removeFrontOne().release();
+            if (!node) {
+                populateFreeTags();
+                node = freeTags.removeFrontOne().release();
+            }
+        }
+        if (!useMagazines) {
+            usedTags.pushFrontOne(*node);
         }
-        usedTags.pushFrontOne(*node);
         node->incRefCount();
         node->tagForCpuAccess->initialize();
         return node;
@@ -110,15 +136,136 @@ class TagAllocator {
             } else {
                 returnTagToDeferredPool(node);
             }
+
+            if (trimIdleChunksEnabled && ++returnedTagsSinceTrim >= tagCount) {
+                returnedTagsSinceTrim = 0;
+                trimIdleChunks();
+            }
+        }
+    }
+
+    // Frees graphics allocations (other than the initial one) whose tags were all free in idlePassesBeforeTrim consecutive passes
+    void trimIdleChunks() {
+        std::unique_lock<std::mutex> lock(allocatorMutex);
+        if (gfxAllocations.size() <= 1) {
+            return;
+        }
+
+        drainMagazines();
+        auto freeNodes = freeTags.detachNodes();
+
+        std::vector<size_t> freeNodesPerChunk(gfxAllocations.size(), 0u);
+        for (auto node = freeNodes; node != nullptr; node = node->next) {
+            freeNodesPerChunk[node->chunkIndex]++;
+        }
+
+        bool anyChunkToTrim = false;
+        for (size_t i = 1; i < gfxAllocations.size(); i++) {
+            if (freeNodesPerChunk[i] == tagCount) {
+                chunkIdlePasses[i]++;
+            } else {
+                chunkIdlePasses[i] = 0;
+            }
+            anyChunkToTrim |= chunkIdlePasses[i] >= idlePassesBeforeTrim;
+        }
+        if (!anyChunkToTrim) {
+            if (freeNodes) {
+                freeTags.splice(*freeNodes);
+            }
+            return;
+        }
+
+        IDList<NodeType, false> remainingFreeTags;
+        auto node = freeNodes;
+        while (node != nullptr) {
+            auto nextNode = node->next;
+            if (chunkIdlePasses[node->chunkIndex] < idlePassesBeforeTrim) {
+                remainingFreeTags.pushTailOne(*node);
+            }
+            node = nextNode;
         }
+        if (!remainingFreeTags.peekIsEmpty()) {
+            freeTags.splice(*remainingFreeTags.detachNodes());
+        }
+
+        size_t remainingChunks = 1;
+        for (size_t i = 1; i < gfxAllocations.size(); i++) {
+            if (chunkIdlePasses[i] >= idlePassesBeforeTrim) {
+                memoryManager->checkGpuUsageAndDestroyGraphicsAllocations(gfxAllocations[i]);
+                delete[] tagPoolMemory[i];
+                continue;
+            }
+            if (remainingChunks != i) {
+                gfxAllocations[remainingChunks] = gfxAllocations[i];
+                tagPoolMemory[remainingChunks] = tagPoolMemory[i];
+                chunkIdlePasses[remainingChunks] = chunkIdlePasses[i];
+                for (size_t j = 0; j < tagCount; j++) {
+                    tagPoolMemory[remainingChunks][j].chunkIndex = remainingChunks;
+                }
+            }
+            remainingChunks++;
+        }
+        gfxAllocations.resize(remainingChunks);
+        tagPoolMemory.resize(remainingChunks);
+        chunkIdlePasses.resize(remainingChunks);
     }
 
   protected:
+    // Per thread cache of free tags prefetched from freeTags, threads are spread over magazines round-robin.
+    // Magazine is guarded by a mutex rather than being lock-free: it is only contended when more threads than magazinesCount
+    // acquire tags concurrently, and refilling it goes through the lock based freeTags list anyway.
+    struct Magazine {
+        std::mutex mtx;
+        std::array<NodeType *, magazineCapacity> nodes;
+        size_t count = 0;
+    };
+
+    static size_t getMagazineIndex() {
+        static std::atomic<size_t> nextMagazineIndex{0};
+        thread_local size_t magazineIndex = nextMagazineIndex++ % magazinesCount;
+        return magazineIndex;
+    }
+
+    NodeType *getTagFromMagazine() {
+        auto &magazine = magazines[getMagazineIndex()];
+        std::lock_guard<std::mutex> lock(magazine.mtx);
+        if (magazine.count == 0) {
+            if (freeTags.peekIsEmpty()) {
+                releaseDeferredTags();
+            }
+            while (magazine.count < magazineCapacity) {
+                auto node = freeTags.removeFrontOne().release();
+                if (!node) {
+                    break;
+                }
+                magazine.nodes[magazine.count++] = node;
+            }
+            // keep order of freeTags
+            std::reverse(magazine.nodes.begin(), magazine.nodes.begin() + magazine.count);
+        }
+        if (magazine.count == 0) {
+            return nullptr;
+        }
+        return magazine.nodes[--magazine.count];
+    }
+
+    void drainMagazines() {
+        for (auto &magazine : magazines) {
+            std::lock_guard<std::mutex> lock(magazine.mtx);
+            for (size_t i = 0; i < magazine.count; i++) {
+                freeTags.pushFrontOne(*magazine.nodes[i]);
+            }
+            magazine.count = 0;
+        }
+    }
+
     IDList<NodeType> freeTags;
+    // Only maintained when magazines are disabled, magazines exist to avoid shared list locking on every get and return
     IDList<NodeType> usedTags;
     IDList<NodeType> deferredTags;
     std::vector<GraphicsAllocation *> gfxAllocations;
     std::vector<NodeType *> tagPoolMemory;
+    std::vector<uint32_t> chunkIdlePasses;
 
     const uint32_t rootDeviceIndex;
     MemoryManager *memoryManager;
@@ -126,20 +273,29 @@ class TagAllocator {
     size_t tagAlignment;
     size_t tagSize;
     bool doNotReleaseNodes = false;
+    bool useMagazines = true;
+    bool trimIdleChunksEnabled = true;
 
+    std::array<Magazine, magazinesCount> magazines;
+    std::atomic<size_t> returnedTagsSinceTrim{0};
     std::mutex allocatorMutex;
 
     MOCKABLE_VIRTUAL void returnTagToFreePool(NodeType *node) {
-        NodeType *usedNode = usedTags.removeOne(*node).release();
-        DEBUG_BREAK_IF(usedNode == nullptr);
-        UNUSED_VARIABLE(usedNode);
+        if (!useMagazines) {
+            NodeType *usedNode = usedTags.removeOne(*node).release();
+            DEBUG_BREAK_IF(usedNode == nullptr);
+            UNUSED_VARIABLE(usedNode);
+        }
         freeTags.pushFrontOne(*node);
     }
 
     void returnTagToDeferredPool(NodeType *node) {
-        NodeType *usedNode = usedTags.removeOne(*node).release();
-        DEBUG_BREAK_IF(!usedNode);
-        deferredTags.pushFrontOne(*usedNode);
+        if (!useMagazines) {
+            NodeType *usedNode = usedTags.removeOne(*node).release();
+            DEBUG_BREAK_IF(!usedNode);
+            UNUSED_VARIABLE(usedNode);
+        }
+        deferredTags.pushFrontOne(*node);
     }
 
     void populateFreeTags() {
@@ -148,6 +304,8 @@ class TagAllocator {
         auto allocationType = TagType::getAllocationType();
         GraphicsAllocation *graphicsAllocation = memoryManager->allocateGraphicsMemoryWithProperties({rootDeviceIndex, allocationSizeRequired, allocationType});
         gfxAllocations.push_back(graphicsAllocation);
+        chunkIdlePasses.push_back(0u);
+        auto chunkIndex = gfxAllocations.size() - 1;
 
         uint64_t gpuBaseAddress = graphicsAllocation->getGpuAddress();
         uintptr_t Size = graphicsAllocation->getUnderlyingBufferSize();
@@ -159,6 +317,7 @@ class TagAllocator {
         for (size_t i = 0; i < tagCount; ++i) {
             nodesMemory[i].allocator = this;
             nodesMemory[i].gfxAllocation = graphicsAllocation;
+            nodesMemory[i].chunkIndex = chunkIndex;
             nodesMemory[i].tagForCpuAccess = reinterpret_cast<TagType *>(Start);
             nodesMemory[i].gpuAddress = gpuBaseAddress + (i * tagSize);
             nodesMemory[i].setDoNotReleaseNodes(doNotReleaseNodes);
@@ -193,4 +352,13 @@ class TagAllocator {
         }
     }
 };
+
+template <typename TagType>
+constexpr size_t TagAllocator<TagType>::magazinesCount;
+
+template <typename TagType>
+constexpr size_t TagAllocator<TagType>::magazineCapacity;
+
+template <typename TagType>
+constexpr uint32_t TagAllocator<TagType>::idlePassesBeforeTrim;
 } // namespace NEO
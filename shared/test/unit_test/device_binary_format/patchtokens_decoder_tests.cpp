@@ -7,6 +7,8 @@
 
 #include "shared/source/device_binary_format/patchtokens_decoder.h"
 #include "shared/source/helpers/hash.h"
+#include "shared/source/utilities/parallel_for.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
 
 #include "test.h"
 
@@ -1212,3 +1214,70 @@ TEST(ProgramDecoder, GivenProgramWithMultipleKernelsWhenFailsToDecodeKernelThenD
     EXPECT_EQ(2U, decodedProgram.header->NumberOfKernels);
     EXPECT_EQ(1U, decodedProgram.kernels.size());
 }
+
+TEST(ProgramDecoder, GivenKernelsCountWhenGettingDecodingThreadCountThenSmallProgramsAreDecodedOnSingleThread) {
+    DebugManagerStateRestore restorer;
+    EXPECT_EQ(1U, NEO::PatchTokenBinary::getKernelsDecodingThreadCount(0U));
+    EXPECT_EQ(1U, NEO::PatchTokenBinary::getKernelsDecodingThreadCount(NEO::PatchTokenBinary::minKernelsPerDecodingThread));
+    EXPECT_LE(NEO::PatchTokenBinary::getKernelsDecodingThreadCount(64 * NEO::PatchTokenBinary::minKernelsPerDecodingThread), NEO::getDefaultParallelForThreadCount());
+
+    NEO::DebugManager.flags.DeviceBinaryDecodingThreadCount.set(4);
+    EXPECT_EQ(4U, NEO::PatchTokenBinary::getKernelsDecodingThreadCount(8U));
+    EXPECT_EQ(2U, NEO::PatchTokenBinary::getKernelsDecodingThreadCount(2U));
+}
+
+TEST(ProgramDecoder, GivenProgramWithManyKernelsWhenDecodingOnMultipleThreadsThenResultIsSameAsWhenDecodingOnSingleThread) {
+    DebugManagerStateRestore restorer;
+    constexpr uint32_t numKernels = 100;
+    PatchTokensTestData::ValidProgramWithKernelUsingSlm programToEncode;
+    programToEncode.headerMutable->NumberOfKernels = numKernels;
+    std::vector<uint8_t> kernelBlob(programToEncode.kernels[0].blobs.kernelInfo.begin(), programToEncode.kernels[0].blobs.kernelInfo.end());
+    for (uint32_t i = 1; i < numKernels; ++i) {
+        programToEncode.storage.insert(programToEncode.storage.end(), kernelBlob.begin(), kernelBlob.end());
+    }
+
+    NEO::DebugManager.flags.DeviceBinaryDecodingThreadCount.set(1);
+    NEO::PatchTokenBinary::ProgramFromPatchtokens serialProgram;
+    EXPECT_TRUE(NEO::PatchTokenBinary::decodeProgramFromPatchtokensBlob(programToEncode.storage, serialProgram));
+
+    NEO::DebugManager.flags.DeviceBinaryDecodingThreadCount.set(4);
+    NEO::PatchTokenBinary::ProgramFromPatchtokens parallelProgram;
+    EXPECT_TRUE(NEO::PatchTokenBinary::decodeProgramFromPatchtokensBlob(programToEncode.storage, parallelProgram));
+
+    ASSERT_EQ(numKernels, serialProgram.kernels.size());
+    ASSERT_EQ(numKernels, parallelProgram.kernels.size());
+    for (uint32_t i = 0; i < numKernels; ++i) {
+        EXPECT_EQ(NEO::DecodeError::Success, parallelProgram.kernels[i].decodeStatus);
+        EXPECT_EQ(serialProgram.kernels[i].header, parallelProgram.kernels[i].header);
+        EXPECT_EQ(serialProgram.kernels[i].blobs.kernelInfo.begin(), parallelProgram.kernels[i].blobs.kernelInfo.begin());
+        EXPECT_EQ(serialProgram.kernels[i].blobs.kernelInfo.size(), parallelProgram.kernels[i].blobs.kernelInfo.size());
+        EXPECT_EQ(serialProgram.kernels[i].tokens.allocateLocalSurface, parallelProgram.kernels[i].tokens.allocateLocalSurface);
+        EXPECT_NE(nullptr, parallelProgram.kernels[i].tokens.allocateLocalSurface);
+    }
+    EXPECT_EQ(ptrOffset(parallelProgram.kernels[0].blobs.kernelInfo.begin(), kernelBlob.size()), parallelProgram.kernels[1].blobs.kernelInfo.begin());
+}
+
+TEST(ProgramDecoder, GivenProgramWithManyKernelsWhenDecodingOnMultipleThreadsFailsForOneOfKernelsThenKernelsAfterFailedOneAreDropped) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.DeviceBinaryDecodingThreadCount.set(4);
+    constexpr uint32_t numKernels = 16;
+    constexpr uint32_t failingKernel = 5;
+    PatchTokensTestData::ValidProgramWithKernelUsingSlm programToEncode;
+    programToEncode.headerMutable->NumberOfKernels = numKernels;
+    auto slmOffset = ptrDiff(programToEncode.slmMutable, programToEncode.storage.data());
+    std::vector<uint8_t> kernelBlob(programToEncode.kernels[0].blobs.kernelInfo.begin(), programToEncode.kernels[0].blobs.kernelInfo.end());
+    for (uint32_t i = 1; i < numKernels; ++i) {
+        programToEncode.storage.insert(programToEncode.storage.end(), kernelBlob.begin(), kernelBlob.end());
+    }
+    auto failingSlmToken = reinterpret_cast<iOpenCL::SPatchItemHeader *>(programToEncode.storage.data() + slmOffset + failingKernel * kernelBlob.size());
+    failingSlmToken->Size = 0U;
+
+    NEO::PatchTokenBinary::ProgramFromPatchtokens decodedProgram;
+    EXPECT_FALSE(NEO::PatchTokenBinary::decodeProgramFromPatchtokensBlob(programToEncode.storage, decodedProgram));
+    EXPECT_EQ(NEO::DecodeError::InvalidBinary, decodedProgram.decodeStatus);
+    ASSERT_EQ(failingKernel + 1, decodedProgram.kernels.size());
+    for (uint32_t i = 0; i < failingKernel; ++i) {
+        EXPECT_EQ(NEO::DecodeError::Success, decodedProgram.kernels[i].decodeStatus);
+    }
+    EXPECT_EQ(NEO::DecodeError::InvalidBinary, decodedProgram.kernels[failingKernel].decodeStatus);
+}
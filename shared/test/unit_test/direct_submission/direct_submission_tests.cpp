@@ -464,6 +464,27 @@ HWTEST_F(DirectSubmissionDispatchBufferTest,
     EXPECT_TRUE(directSubmission.ringStart);
 }
 
+HWTEST_F(DirectSubmissionDispatchBufferTest,
+         givenDirectSubmissionRingStartedAndHandleResidencyFailsWhenDispatchingCommandBufferThenNothingIsDispatchedAndGpuIsNotUnblocked) {
+    FlushStampTracker flushStamp(true);
+
+    MockDirectSubmissionHw<FamilyType> directSubmission(*pDevice,
+                                                        std::make_unique<RenderDispatcher<FamilyType>>(),
+                                                        *osContext.get());
+
+    bool ret = directSubmission.initialize(true);
+    EXPECT_TRUE(ret);
+
+    size_t sizeUsed = directSubmission.ringCommandStream.getUsed();
+    directSubmission.handleResidencyReturn = false;
+    ret = directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp);
+    EXPECT_FALSE(ret);
+    EXPECT_EQ(2u, directSubmission.handleResidencyCount);
+    EXPECT_EQ(0u, directSubmission.semaphoreData->QueueWorkCount);
+    EXPECT_EQ(1u, directSubmission.currentQueueWorkCount);
+    EXPECT_EQ(sizeUsed, directSubmission.ringCommandStream.getUsed());
+}
+
 HWTEST_F(DirectSubmissionDispatchBufferTest,
          givenDirectSubmissionRingNotStartAndSwitchBuffersWhenDispatchingCommandBufferThenExpectDispatchInCommandBufferQueueCountIncreaseAndSubmitToGpu) {
     FlushStampTracker flushStamp(true);
@@ -7,28 +7,65 @@
 
 #include "shared/source/direct_submission/dispatchers/render_dispatcher.h"
 #include "shared/source/direct_submission/linux/drm_direct_submission.h"
+#include "shared/source/execution_environment/root_device_environment.h"
+#include "shared/source/helpers/flush_stamp.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/os_interface/linux/drm_allocation.h"
+#include "shared/source/os_interface/linux/drm_buffer_object.h"
+#include "shared/source/os_interface/linux/drm_memory_manager.h"
 #include "shared/source/os_interface/linux/os_context_linux.h"
+#include "shared/source/os_interface/linux/os_interface.h"
 
-#include "opencl/test/unit_test/fixtures/device_fixture.h"
-#include "opencl/test/unit_test/os_interface/linux/drm_mock.h"
+#include "opencl/test/unit_test/mocks/mock_device.h"
+#include "opencl/test/unit_test/mocks/mock_execution_environment.h"
+#include "opencl/test/unit_test/os_interface/linux/device_command_stream_fixture.h"
 #include "test.h"
 
+#include <cerrno>
 #include <memory>
 
-struct DrmDirectSubmissionFixture : public DeviceFixture {
+using namespace NEO;
+
+struct DrmDirectSubmissionFixture {
     void SetUp() {
-        DeviceFixture::SetUp();
+        executionEnvironment = new MockExecutionEnvironment();
+        executionEnvironment->incRefInternal();
+        executionEnvironment->initGmm();
 
-        osContext = std::make_unique<OsContextLinux>(drmMock, 0u, 0u, aub_stream::ENGINE_RCS,
+        drm = new DrmMockCustom();
+        executionEnvironment->rootDeviceEnvironments[0]->osInterface = std::make_unique<OSInterface>();
+        executionEnvironment->rootDeviceEnvironments[0]->osInterface->get()->setDrm(drm);
+        executionEnvironment->memoryManager.reset(new DrmMemoryManager(gemCloseWorkerMode::gemCloseWorkerInactive, false, false, *executionEnvironment));
+        device.reset(MockDevice::create<MockDevice>(executionEnvironment, 0u));
+
+        osContext = std::make_unique<OsContextLinux>(*drm, 0u, 1u, aub_stream::ENGINE_RCS,
                                                      PreemptionMode::ThreadGroup, false, false, false);
+
+        const AllocationProperties commandBufferProperties{device->getRootDeviceIndex(),
+                                                           true, 0x1000,
+                                                           GraphicsAllocation::AllocationType::COMMAND_BUFFER,
+                                                           false};
+        commandBuffer = executionEnvironment->memoryManager->allocateGraphicsMemoryWithProperties(commandBufferProperties);
+        batchBuffer.endCmdPtr = &bbStart[0];
+        batchBuffer.commandBufferAllocation = commandBuffer;
+        batchBuffer.usedSize = 0x40;
+        drm->ioctl_cnt.reset();
     }
 
     void TearDown() {
-        DeviceFixture::TearDown();
+        executionEnvironment->memoryManager->freeGraphicsMemory(commandBuffer);
+        osContext.reset();
+        device.reset();
+        executionEnvironment->decRefInternal();
     }
 
+    MockExecutionEnvironment *executionEnvironment = nullptr;
+    DrmMockCustom *drm = nullptr;
+    std::unique_ptr<MockDevice> device;
     std::unique_ptr<OsContextLinux> osContext;
-    DrmMock drmMock;
+    GraphicsAllocation *commandBuffer = nullptr;
+    BatchBuffer batchBuffer;
+    uint8_t bbStart[64];
 };
 
 template <typename GfxFamily>
@@ -40,37 +77,159 @@ struct MockDrmDirectSubmission : public DrmDirectSubmission<GfxFamily> {
     }
     using BaseClass = DrmDirectSubmission<GfxFamily>;
     using BaseClass::allocateOsResources;
+    using BaseClass::completionRingBuffers;
+    using BaseClass::currentRingBuffer;
     using BaseClass::getTagAddressValue;
     using BaseClass::handleResidency;
+    using BaseClass::pendingResidency;
+    using BaseClass::ringBuffer;
+    using BaseClass::ringBuffer2;
+    using BaseClass::ringStart;
+    using BaseClass::semaphoreGpuVa;
+    using BaseClass::semaphorePtr;
+    using BaseClass::semaphores;
     using BaseClass::submit;
     using BaseClass::switchRingBuffers;
+    using BaseClass::tagAddress;
     using BaseClass::updateTagValue;
+    using typename BaseClass::RingBufferUse;
 };
 
 using DrmDirectSubmissionTest = Test<DrmDirectSubmissionFixture>;
 
-using namespace NEO;
+HWTEST_F(DrmDirectSubmissionTest, givenDrmDirectSubmissionWhenInitializedWithSubmitOnInitThenRingIsExecutedOnceWithAllRingBufferObjects) {
+    MockDrmDirectSubmission<FamilyType> drmDirectSubmission(*device,
+                                                            std::make_unique<RenderDispatcher<FamilyType>>(),
+                                                            *osContext);
+
+    EXPECT_TRUE(drmDirectSubmission.initialize(true));
+    EXPECT_TRUE(drmDirectSubmission.ringStart);
+    EXPECT_EQ(1, drm->ioctl_cnt.execbuffer2);
+
+    auto ringBo = static_cast<DrmAllocation *>(drmDirectSubmission.ringBuffer)->getBO();
+    auto execObjects = reinterpret_cast<drm_i915_gem_exec_object2 *>(drm->execBuffer.buffers_ptr);
+    EXPECT_EQ(3u, drm->execBuffer.buffer_count);
+    EXPECT_EQ(0u, drm->execBuffer.batch_start_offset);
+    EXPECT_EQ(static_cast<uint32_t>(ringBo->peekHandle()), execObjects[2].handle);
+    EXPECT_EQ(osContext->getDrmContextIds()[0], drm->execBuffer.rsvd1);
+    EXPECT_NE(0u, drm->execBuffer.flags & I915_EXEC_NO_RELOC);
+}
 
-HWTEST_F(DrmDirectSubmissionTest, givenDrmDirectSubmissionWhenCallingLinuxImplementationThenExpectAllFailAsNotImplemented) {
-    MockDrmDirectSubmission<FamilyType> drmDirectSubmission(*pDevice,
+HWTEST_F(DrmDirectSubmissionTest, givenRingStartedWhenDispatchingCommandBuffersThenNoExecIsCalled) {
+    MockDrmDirectSubmission<FamilyType> drmDirectSubmission(*device,
                                                             std::make_unique<RenderDispatcher<FamilyType>>(),
-                                                            *osContext.get());
+                                                            *osContext);
+    FlushStampTracker flushStamp(true);
 
-    DirectSubmissionAllocations allocations;
-    EXPECT_FALSE(drmDirectSubmission.allocateOsResources(allocations));
+    EXPECT_TRUE(drmDirectSubmission.initialize(true));
+    drm->ioctl_cnt.reset();
+
+    EXPECT_TRUE(drmDirectSubmission.dispatchCommandBuffer(batchBuffer, flushStamp));
+    EXPECT_TRUE(drmDirectSubmission.dispatchCommandBuffer(batchBuffer, flushStamp));
+    EXPECT_EQ(0, drm->ioctl_cnt.execbuffer2);
+    EXPECT_EQ(2u, flushStamp.peekStamp());
+}
+
+HWTEST_F(DrmDirectSubmissionTest, givenRingStartedWhenNewBufferObjectIsMadeResidentThenItIsBoundOnlyOnceInRingSession) {
+    MockDrmDirectSubmission<FamilyType> drmDirectSubmission(*device,
+                                                            std::make_unique<RenderDispatcher<FamilyType>>(),
+                                                            *osContext);
+    FlushStampTracker flushStamp(true);
+
+    EXPECT_TRUE(drmDirectSubmission.initialize(true));
+    drm->ioctl_cnt.reset();
+
+    size_t residencyBatchOffset = DrmDirectSubmission<FamilyType>::residencyBatchOffset;
+    BufferObject *bo = static_cast<DrmAllocation *>(commandBuffer)->getBO();
+    drmDirectSubmission.makeResident(&bo, 1u);
+    EXPECT_TRUE(drmDirectSubmission.dispatchCommandBuffer(batchBuffer, flushStamp));
+    EXPECT_EQ(1, drm->ioctl_cnt.execbuffer2);
+    EXPECT_EQ(2u, drm->execBuffer.buffer_count);
+    EXPECT_EQ(residencyBatchOffset, drm->execBuffer.batch_start_offset);
+    EXPECT_TRUE(drmDirectSubmission.pendingResidency.empty());
+
+    drmDirectSubmission.makeResident(&bo, 1u);
+    EXPECT_TRUE(drmDirectSubmission.dispatchCommandBuffer(batchBuffer, flushStamp));
+    EXPECT_EQ(1, drm->ioctl_cnt.execbuffer2);
+    EXPECT_TRUE(drmDirectSubmission.pendingResidency.empty());
+}
+
+HWTEST_F(DrmDirectSubmissionTest, givenRingNotStartedWhenDispatchingCommandBufferThenPendingBufferObjectsAreSubmittedWithRing) {
+    MockDrmDirectSubmission<FamilyType> drmDirectSubmission(*device,
+                                                            std::make_unique<RenderDispatcher<FamilyType>>(),
+                                                            *osContext);
+    FlushStampTracker flushStamp(true);
+
+    EXPECT_TRUE(drmDirectSubmission.initialize(false));
+    EXPECT_FALSE(drmDirectSubmission.ringStart);
+    EXPECT_EQ(0, drm->ioctl_cnt.execbuffer2);
+
+    BufferObject *bo = static_cast<DrmAllocation *>(commandBuffer)->getBO();
+    drmDirectSubmission.makeResident(&bo, 1u);
+    EXPECT_TRUE(drmDirectSubmission.dispatchCommandBuffer(batchBuffer, flushStamp));
+    EXPECT_TRUE(drmDirectSubmission.ringStart);
+    EXPECT_EQ(1, drm->ioctl_cnt.execbuffer2);
+    EXPECT_EQ(4u, drm->execBuffer.buffer_count);
+}
 
-    uint64_t gpuAddress = 0x1000;
-    size_t size = 0x1000;
-    EXPECT_FALSE(drmDirectSubmission.submit(gpuAddress, size));
+HWTEST_F(DrmDirectSubmissionTest, givenDrmDirectSubmissionWhenUpdatingTagThenTagIsPlacedInSemaphorePageAndValueIncreases) {
+    MockDrmDirectSubmission<FamilyType> drmDirectSubmission(*device,
+                                                            std::make_unique<RenderDispatcher<FamilyType>>(),
+                                                            *osContext);
+    EXPECT_TRUE(drmDirectSubmission.initialize(false));
 
-    EXPECT_FALSE(drmDirectSubmission.handleResidency());
+    size_t tagOffset = DrmDirectSubmission<FamilyType>::tagOffset;
+    EXPECT_EQ(ptrOffset(drmDirectSubmission.semaphorePtr, tagOffset), drmDirectSubmission.tagAddress);
+    EXPECT_EQ(0u, *drmDirectSubmission.tagAddress);
 
-    EXPECT_EQ(0ull, drmDirectSubmission.switchRingBuffers());
+    TagData tagData;
+    drmDirectSubmission.getTagAddressValue(tagData);
+    EXPECT_EQ(drmDirectSubmission.semaphoreGpuVa + tagOffset, tagData.tagAddress);
+    EXPECT_EQ(1u, tagData.tagValue);
 
-    EXPECT_EQ(0ull, drmDirectSubmission.updateTagValue());
+    EXPECT_EQ(1u, drmDirectSubmission.updateTagValue());
+    EXPECT_EQ(1u, drmDirectSubmission.completionRingBuffers[drmDirectSubmission.currentRingBuffer]);
 
-    TagData tagData = {1ull, 1ull};
     drmDirectSubmission.getTagAddressValue(tagData);
-    EXPECT_EQ(0ull, tagData.tagAddress);
-    EXPECT_EQ(0ull, tagData.tagValue);
+    EXPECT_EQ(2u, tagData.tagValue);
+}
+
+HWTEST_F(DrmDirectSubmissionTest, givenRingStartedWhenSwitchingRingBuffersThenReturnPreviousPositionAndWaitForNextBufferCompletion) {
+    MockDrmDirectSubmission<FamilyType> drmDirectSubmission(*device,
+                                                            std::make_unique<RenderDispatcher<FamilyType>>(),
+                                                            *osContext);
+    EXPECT_TRUE(drmDirectSubmission.initialize(true));
+
+    auto ringCommandStream = &drmDirectSubmission.ringCommandStream;
+    uint64_t expectedGpuVa = drmDirectSubmission.ringBuffer->getGpuAddress() + ringCommandStream->getUsed();
+    drmDirectSubmission.completionRingBuffers[MockDrmDirectSubmission<FamilyType>::RingBufferUse::SecondBuffer] = 5u;
+    *drmDirectSubmission.tagAddress = 5u;
+
+    EXPECT_EQ(expectedGpuVa, drmDirectSubmission.switchRingBuffers());
+    EXPECT_EQ(drmDirectSubmission.ringBuffer2, ringCommandStream->getGraphicsAllocation());
+    EXPECT_EQ(MockDrmDirectSubmission<FamilyType>::RingBufferUse::SecondBuffer, drmDirectSubmission.currentRingBuffer);
+}
+
+HWTEST_F(DrmDirectSubmissionTest, givenRingStartedWhenDestroyingDirectSubmissionThenRingIsStoppedAndWaitedFor) {
+    {
+        MockDrmDirectSubmission<FamilyType> drmDirectSubmission(*device,
+                                                                std::make_unique<RenderDispatcher<FamilyType>>(),
+                                                                *osContext);
+        EXPECT_TRUE(drmDirectSubmission.initialize(true));
+        drm->ioctl_cnt.reset();
+    }
+    EXPECT_EQ(0, drm->ioctl_cnt.execbuffer2);
+    EXPECT_EQ(1, drm->ioctl_cnt.gemWait);
+}
+
+HWTEST_F(DrmDirectSubmissionTest, givenExecFailsWhenSubmittingRingThenRingIsNotStarted) {
+    MockDrmDirectSubmission<FamilyType> drmDirectSubmission(*device,
+                                                            std::make_unique<RenderDispatcher<FamilyType>>(),
+                                                            *osContext);
+    drm->ioctl_res = -1;
+    drm->errnoValue = EINVAL;
+    EXPECT_FALSE(drmDirectSubmission.initialize(true));
+    EXPECT_FALSE(drmDirectSubmission.ringStart);
+    drm->ioctl_res = 0;
+    drm->errnoValue = 0;
 }
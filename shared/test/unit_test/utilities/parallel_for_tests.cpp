@@ -0,0 +1,56 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/parallel_for.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+TEST(ParallelForTest, givenSingleThreadWhenParallelForIsCalledThenAllIndicesAreProcessedInOrderOnCallingThread) {
+    std::vector<size_t> processed;
+    auto callingThread = std::this_thread::get_id();
+    parallelFor(5u, 1u, [&](size_t index) {
+        EXPECT_EQ(callingThread, std::this_thread::get_id());
+        processed.push_back(index);
+    });
+
+    std::vector<size_t> expected = {0u, 1u, 2u, 3u, 4u};
+    EXPECT_EQ(expected, processed);
+}
+
+TEST(ParallelForTest, givenMultipleThreadsWhenParallelForIsCalledThenEachIndexIsProcessedExactlyOnce) {
+    constexpr size_t count = 1000u;
+    std::vector<std::atomic<uint32_t>> visits(count);
+    for (auto &visit : visits) {
+        visit = 0u;
+    }
+
+    parallelFor(count, 4u, [&](size_t index) {
+        visits[index]++;
+    });
+
+    for (auto &visit : visits) {
+        EXPECT_EQ(1u, visit.load());
+    }
+}
+
+TEST(ParallelForTest, givenZeroCountWhenParallelForIsCalledThenTaskIsNotCalled) {
+    bool called = false;
+    parallelFor(0u, 4u, [&](size_t index) {
+        called = true;
+    });
+    EXPECT_FALSE(called);
+}
+
+TEST(ParallelForTest, whenGettingDefaultThreadCountThenAtLeastOneIsReturned) {
+    EXPECT_LE(1u, getDefaultParallelForThreadCount());
+}